@@ -175,11 +175,17 @@ struct OrderRequest {
 
 struct ExecutionReport {
     std::string order_id;
+    std::string symbol;
+    OrderSide side;
+    OrderType type;
+    double quantity;
+    double price;
     OrderStatus old_status;
     OrderStatus new_status;
     double filled_quantity;
     double remaining_quantity;
     double execution_price;
+    std::chrono::system_clock::time_point created_time;
     std::chrono::system_clock::time_point timestamp;
     std::string rejection_reason;  // If status == REJECTED
 };
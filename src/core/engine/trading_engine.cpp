@@ -5,12 +5,15 @@
 #include "../models/instrument.hpp"
 #include "../models/market_tick.hpp"
 #include "../../utils/logging.hpp"
+#include "../../utils/async_logging.hpp"
 #include "../../utils/exceptions.hpp"
 
 #include <sstream>
 #include <algorithm>
 #include <iomanip>
 #include <random>
+#include <charconv>
+#include <limits>
 
 namespace trading {
 
@@ -22,17 +25,25 @@ TradingEngine::TradingEngine(
     is_running_(false),
     should_stop_(false),
     order_sequence_(0),
-    trade_sequence_(0) {
+    trade_sequence_(0),
+    snapshot_interval_(0),
+    position_flush_interval_(0),
+    kill_switch_callback_id_(0),
+    mass_cancel_pending_(false) {
 
     if (!risk_manager_) {
         throw TradingException("Risk manager is required");
     }
 
+    kill_switch_callback_id_ = risk_manager_->get_kill_switch().add_trip_callback(
+        [this](const std::string& /*reason*/) { on_kill_switch_engaged(); });
+
     log_engine_event("Trading engine initialized");
 }
 
 TradingEngine::~TradingEngine() {
     shutdown();
+    risk_manager_->get_kill_switch().remove_trip_callback(kill_switch_callback_id_);
 }
 
 bool TradingEngine::initialize() {
@@ -44,18 +55,17 @@ bool TradingEngine::initialize() {
     }
 
     try {
-        // Load existing positions from persistence if available
-        if (persistence_service_) {
-            auto saved_positions = persistence_service_->load_all_positions();
-            for (const auto& position : saved_positions) {
-                positions_[position->get_instrument_symbol()] = position;
-            }
-            log_engine_event("Loaded " + std::to_string(saved_positions.size()) + " positions from persistence");
-        }
+        recover_state();
 
         // Start order processing thread
         should_stop_.store(false);
         order_processing_thread_ = std::thread(&TradingEngine::process_orders, this);
+        if (snapshot_store_ && snapshot_interval_.count() > 0) {
+            snapshot_thread_ = std::thread(&TradingEngine::snapshot_loop, this);
+        }
+        if (position_flush_interval_.count() > 0) {
+            position_flush_thread_ = std::thread(&TradingEngine::position_flush_loop, this);
+        }
 
         is_running_.store(true);
         log_engine_event("Trading engine started successfully");
@@ -83,6 +93,35 @@ void TradingEngine::shutdown() {
         order_processing_thread_.join();
     }
 
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    }
+    snapshot_cv_.notify_all();
+    if (snapshot_thread_.joinable()) {
+        snapshot_thread_.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(position_flush_mutex_);
+    }
+    position_flush_cv_.notify_all();
+    if (position_flush_thread_.joinable()) {
+        position_flush_thread_.join();
+    }
+    flush_dirty_positions();
+
+    if (event_journal_ && !event_journal_->flush()) {
+        log_engine_event("Timed out flushing event journal");
+    }
+    if (async_persistence_ && !async_persistence_->flush()) {
+        log_engine_event("Timed out flushing write-behind persistence");
+    }
+
+    // A clean shutdown leaves nothing to replay
+    if (snapshot_store_) {
+        write_snapshot();
+    }
+
     is_running_.store(false);
     log_engine_event("Trading engine shutdown complete");
 }
@@ -102,34 +141,64 @@ std::string TradingEngine::submit_order(const OrderRequest& request) {
         throw TradingException("Failed to create order");
     }
 
-    // Risk validation
-    if (!risk_manager_->validate_order(request)) {
-        std::string reason = risk_manager_->get_rejection_reason(request);
-        reject_order(order, reason);
+    // Kill switch - one load of the state word; any later change means a trip fenced this order
+    const KillSwitch& kill_switch = risk_manager_->get_kill_switch();
+    const uint64_t kill_switch_state = kill_switch.get_state();
+    if (KillSwitch::is_engaged(kill_switch_state)) {
+        reject_order(order, "Kill switch engaged");
         return order->get_order_id();
     }
 
-    // Accept order and add to processing queue
-    accept_order(order);
+    // Rate throttles, then risk validation, then the notional budget (consumed only by orders that pass);
+    // throttled orders count as rejects for the circuit breaker
+    std::string rejection_reason;
+    double acquired_notional = 0.0;
+    bool risk_passed = risk_manager_->acquire_order_throttle(request.instrument_symbol, rejection_reason) &&
+                       risk_manager_->validate_order(request, rejection_reason) &&
+                       risk_manager_->acquire_notional_throttle(request, rejection_reason, &acquired_notional);
+    risk_manager_->record_order_outcome(!risk_passed);
+    if (!risk_passed) {
+        reject_order(order, rejection_reason);
+        return order->get_order_id();
+    }
 
-    // Queue order for processing
+    // Accept order and add to processing queue - never block the caller; a full queue rejects instead
     std::string order_id = order->get_order_id();
-    order_processing_queue_.push([this, order_id]() {
-        auto order_iter = orders_.find(order_id);
-        if (order_iter != orders_.end()) {
-            auto order = order_iter->second;
-            if (order->get_type() == OrderType::MARKET) {
-                execute_market_order(order);
+    bool queued = accept_order(order, [this, order_id, kill_switch_state]() {
+        if (risk_manager_->get_kill_switch().get_state() != kill_switch_state) {
+            return; // Fenced: the order stays working until the mass cancel reaches it
+        }
+
+        auto queued_order = get_order(order_id);
+        if (queued_order) {
+            if (queued_order->get_type() == OrderType::MARKET) {
+                execute_market_order(queued_order);
             } else {
-                execute_limit_order(order);
+                execute_limit_order(queued_order);
             }
         }
     });
+    if (!queued) {
+        // Never reached the market, so it does not use up rate or notional budget
+        risk_manager_->release_order_throttle(request.instrument_symbol);
+        risk_manager_->release_notional_throttle(acquired_notional);
+        reject_order(order, "Order queue full");
+        return order_id;
+    }
+
+    if (kill_switch.get_state() != kill_switch_state) {
+        // Tripped while this order was being accepted; the mass cancel may already have run
+        cancel_order_internal(order_id, false);
+    }
 
-    return order->get_order_id();
+    return order_id;
 }
 
 bool TradingEngine::cancel_order(const std::string& order_id) {
+    return cancel_order_internal(order_id, true);
+}
+
+bool TradingEngine::cancel_order_internal(const std::string& order_id, bool apply_throttle) {
     std::lock_guard<std::mutex> lock(engine_mutex_);
 
     auto it = orders_.find(order_id);
@@ -146,9 +215,16 @@ bool TradingEngine::cancel_order(const std::string& order_id) {
         return false;
     }
 
+    std::string throttle_reason;
+    if (apply_throttle && !risk_manager_->acquire_cancel_throttle(order->get_instrument_symbol(), throttle_reason)) {
+        log_order_rejection("Cancel rejected", throttle_reason, order);
+        return false;
+    }
+
     // Update order status
     OrderStatus old_status = order->get_status();
     order->cancel();
+    risk_manager_->remove_working_order(order_id);
 
     persist_order(order);
     notify_order_update(order, old_status);
@@ -282,6 +358,80 @@ void TradingEngine::set_market_data_provider(std::shared_ptr<IMarketDataProvider
     market_data_provider_ = std::move(provider);
 }
 
+void TradingEngine::set_async_persistence(std::shared_ptr<AsyncPersistenceWriter> writer) {
+    std::lock_guard<std::mutex> lock(engine_mutex_);
+    async_persistence_ = std::move(writer);
+}
+
+void TradingEngine::set_event_journal(std::shared_ptr<EventJournal> journal) {
+    std::lock_guard<std::mutex> lock(engine_mutex_);
+    event_journal_ = std::move(journal);
+}
+
+void TradingEngine::set_binary_event_log(std::shared_ptr<BinaryEventLog> event_log) {
+    std::lock_guard<std::mutex> lock(engine_mutex_);
+    binary_event_log_ = std::move(event_log);
+}
+
+void TradingEngine::set_snapshot_store(std::shared_ptr<SnapshotStore> store, std::chrono::seconds interval) {
+    std::lock_guard<std::mutex> lock(engine_mutex_);
+    snapshot_store_ = std::move(store);
+    snapshot_interval_ = interval;
+}
+
+void TradingEngine::set_position_flush_interval(std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock(engine_mutex_);
+    position_flush_interval_ = interval;
+}
+
+size_t TradingEngine::flush_dirty_positions() {
+    std::lock_guard<std::mutex> lock(engine_mutex_);
+    return flush_dirty_positions_locked();
+}
+
+bool TradingEngine::write_snapshot() {
+    if (!snapshot_store_) {
+        return false;
+    }
+
+    SnapshotStore::EncodedSnapshot encoded;
+    {
+        // Every journal append happens under engine_mutex_, so this sequence matches the captured state.
+        // Encode before unlocking: a fill after journal_sequence must not reach the snapshot's positions,
+        // or replaying its TRADE record would apply it twice.
+        std::lock_guard<std::mutex> lock(engine_mutex_);
+        EngineSnapshot snapshot;
+        flush_dirty_positions_locked();
+        snapshot.journal_sequence = event_journal_ ? event_journal_->get_appended_sequence() : 0;
+        snapshot.order_sequence = order_sequence_.load();
+        snapshot.trade_sequence = trade_sequence_.load();
+        snapshot.orders.reserve(orders_.size());
+        for (const auto& [order_id, order] : orders_) {
+            snapshot.orders.push_back(order);
+        }
+        snapshot.trades = trades_;
+        snapshot.positions.reserve(positions_.size());
+        for (const auto& [symbol, position] : positions_) {
+            snapshot.positions.push_back(position);
+        }
+        encoded = SnapshotStore::encode(snapshot);
+    }
+
+    // Never claim journal sequences that could still be lost
+    if (event_journal_ && !event_journal_->wait_for_durable(encoded.journal_sequence, std::chrono::milliseconds(5000))) {
+        log_engine_event("Snapshot skipped: journal not durable through sequence " +
+                         std::to_string(encoded.journal_sequence));
+        return false;
+    }
+    if (!snapshot_store_->write(encoded)) {
+        return false;
+    }
+    if (event_journal_) {
+        event_journal_->mark_snapshot(encoded.journal_sequence);
+    }
+    return true;
+}
+
 // Helper methods implementation
 
 std::string TradingEngine::generate_order_id() {
@@ -324,15 +474,22 @@ std::shared_ptr<Order> TradingEngine::create_order(const OrderRequest& request)
     return order;
 }
 
-bool TradingEngine::accept_order(std::shared_ptr<Order> order) {
+bool TradingEngine::accept_order(std::shared_ptr<Order> order, std::function<void()> work) {
     std::lock_guard<std::mutex> lock(engine_mutex_);
 
+    // Take the queue slot first: a full queue rejects the order before anyone has seen it accepted.
+    // The work cannot run ahead of the acceptance, since it needs engine_mutex_ to find the order.
+    if (!order_processing_queue_.try_push(std::move(work))) {
+        return false;
+    }
+
     OrderStatus old_status = order->get_status();
     order->accept();
 
     // Store order
     orders_[order->get_order_id()] = order;
     add_order_to_symbol_index(order->get_instrument_symbol(), order->get_order_id());
+    risk_manager_->add_working_order(order);
 
     persist_order(order);
     notify_order_update(order, old_status);
@@ -348,11 +505,12 @@ bool TradingEngine::reject_order(std::shared_ptr<Order> order, const std::string
     order->reject(reason);
 
     orders_[order->get_order_id()] = order;
+    risk_manager_->remove_working_order(order->get_order_id());
 
     persist_order(order);
     notify_order_update(order, old_status);
 
-    log_order_event("Order rejected: " + reason, order);
+    log_order_rejection("Order rejected", reason, order);
     return true;
 }
 
@@ -389,7 +547,7 @@ bool TradingEngine::can_execute_order(std::shared_ptr<Order> order, double marke
 }
 
 bool TradingEngine::execute_order(const std::string& order_id, double quantity, double price) {
-    std::lock_guard<std::mutex> lock(engine_mutex_);
+    std::unique_lock<std::mutex> lock(engine_mutex_);
 
     auto it = orders_.find(order_id);
     if (it == orders_.end()) {
@@ -413,17 +571,33 @@ bool TradingEngine::execute_order(const std::string& order_id, double quantity,
     OrderStatus old_status = order->get_status();
     if (trade_type == TradeType::FULL_FILL) {
         order->fill(quantity, price);
+        risk_manager_->remove_working_order(order_id);
     } else {
         order->partial_fill(quantity, price);
     }
 
-    // Process the trade
-    process_trade(trade);
+    // Process the trade; its notifications are held until the fill is durable
+    uint64_t journal_sequence = process_trade(trade);
+    persist_order(order);
 
     // Notify about order update
     notify_order_update(order, old_status);
+    hold_for_sequence_ = 0;
 
     log_trade_event("Order executed", trade);
+    if (journal_sequence == 0) {
+        return true;
+    }
+
+    // Wait for the group commit without the engine lock, so submits, cancels and queries carry on
+    lock.unlock();
+    if (!event_journal_->wait_for_durable(journal_sequence, std::chrono::milliseconds(1000))) {
+        // The venue has filled it either way; publish it, but stop trading on a journal that cannot keep up
+        log_engine_event("Fill " + trade->get_trade_id() + " not durable in event journal");
+        risk_manager_->get_kill_switch().engage("Event journal not durable through fill " + trade->get_trade_id());
+    }
+    lock.lock();
+    release_notifications_locked(journal_sequence);
     return true;
 }
 
@@ -446,30 +620,53 @@ std::shared_ptr<Trade> TradingEngine::create_trade(
     return trade;
 }
 
-void TradingEngine::process_trade(std::shared_ptr<Trade> trade) {
+uint64_t TradingEngine::process_trade(std::shared_ptr<Trade> trade) {
     // Store trade
-    trades_.push_back(trade);
-    trades_by_order_[trade->get_order_id()].push_back(trade);
-    trades_by_symbol_[trade->get_instrument_symbol()].push_back(trade);
+    index_trade(trade);
+
+    // Persist before the position change it causes, so journal replay can re-apply
+    // fills made after a symbol's last position record
+    uint64_t journal_sequence = persist_trade(trade);
+    hold_for_sequence_ = journal_sequence;
 
     // Update position
     update_position(trade);
 
-    // Persist
-    persist_trade(trade);
-
     // Notify
     notify_trade(trade);
+    return journal_sequence;
+}
+
+void TradingEngine::index_trade(std::shared_ptr<Trade> trade) {
+    trades_.push_back(trade);
+    trades_by_order_[trade->get_order_id()].push_back(trade);
+    trades_by_symbol_[trade->get_instrument_symbol()].push_back(trade);
 }
 
 void TradingEngine::update_position(std::shared_ptr<Trade> trade) {
     auto position = get_or_create_position(trade->get_instrument_symbol());
     PositionCalculator::update_position_with_trade(*position, *trade);
+    risk_manager_->update_position(position);
+    publish_daily_pnl();
 
-    persist_position(position);
+    if (position_flush_interval_.count() > 0) {
+        dirty_positions_.insert(position->get_instrument_symbol());
+    } else {
+        persist_position(position);
+    }
     notify_position_update(position);
 }
 
+void TradingEngine::publish_daily_pnl() {
+    double realized_pnl = 0.0;
+    double unrealized_pnl = 0.0;
+    for (const auto& [symbol, position] : positions_) {
+        realized_pnl += position->get_realized_pnl();
+        unrealized_pnl += position->get_unrealized_pnl();
+    }
+    risk_manager_->update_daily_pnl(realized_pnl, unrealized_pnl);
+}
+
 std::shared_ptr<Position> TradingEngine::get_or_create_position(const std::string& symbol) {
     auto it = positions_.find(symbol);
     if (it != positions_.end()) {
@@ -514,42 +711,262 @@ void TradingEngine::process_orders() {
                     task();
                 }
             }
+
+            if (mass_cancel_pending_.exchange(false)) {
+                cancel_all_orders("Kill switch: " + risk_manager_->get_kill_switch().get_reason());
+            }
+            risk_manager_->check_circuit_breakers();
         } catch (const std::exception& e) {
             log_engine_event("Error in order processing: " + std::string(e.what()));
         }
     }
 }
 
-// Notification methods
+// Recovery
+void TradingEngine::recover_state() {
+    auto start = std::chrono::steady_clock::now();
+
+    EngineSnapshot snapshot;
+    bool have_snapshot = snapshot_store_ && snapshot_store_->load_latest(snapshot);
+    if (have_snapshot) {
+        for (const auto& order : snapshot.orders) {
+            orders_[order->get_order_id()] = order;
+            add_order_to_symbol_index(order->get_instrument_symbol(), order->get_order_id());
+        }
+        for (const auto& trade : snapshot.trades) {
+            index_trade(trade);
+        }
+        for (const auto& position : snapshot.positions) {
+            positions_[position->get_instrument_symbol()] = position;
+        }
+        order_sequence_.store(static_cast<size_t>(snapshot.order_sequence));
+        trade_sequence_.store(static_cast<size_t>(snapshot.trade_sequence));
+    } else if (persistence_service_) {
+        // No snapshot: fall back to the positions SQLite holds
+        for (const auto& position : persistence_service_->load_all_positions()) {
+            positions_[position->get_instrument_symbol()] = position;
+        }
+    }
+
+    size_t replayed = 0;
+    if (event_journal_) {
+        uint64_t from_sequence = have_snapshot ? snapshot.journal_sequence + 1 : 1;
+        uint64_t first_sequence = event_journal_->get_first_sequence();
+        if (from_sequence < first_sequence) {
+            if (have_snapshot) {
+                log_engine_event("Journal starts at " + std::to_string(first_sequence) + ", after snapshot sequence " +
+                                 std::to_string(snapshot.journal_sequence) + "; replaying what remains");
+            }
+            from_sequence = first_sequence;
+        }
+
+        std::unordered_set<std::string> trade_ids;
+        trade_ids.reserve(trades_.size());
+        for (const auto& trade : trades_) {
+            trade_ids.insert(trade->get_trade_id());
+        }
+        replayed = event_journal_->for_each_record(from_sequence, std::numeric_limits<size_t>::max(),
+            [this, &trade_ids](const JournalRecord& record) { apply_journal_record(record, trade_ids); });
+
+        if (have_snapshot) {
+            event_journal_->mark_snapshot(snapshot.journal_sequence);
+        }
+    }
+
+    // Rebuild risk state from the recovered book
+    for (const auto& [symbol, position] : positions_) {
+        risk_manager_->update_position(position);
+    }
+    for (const auto& [order_id, order] : orders_) {
+        if (OrderManager::is_working_status(order->get_status())) {
+            risk_manager_->add_working_order(order);
+        }
+    }
+    if (!positions_.empty()) {
+        publish_daily_pnl();
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    log_engine_event("Recovered " + std::to_string(orders_.size()) + " orders, " + std::to_string(trades_.size()) +
+                     " trades, " + std::to_string(positions_.size()) + " positions" +
+                     (have_snapshot ? " from snapshot at sequence " + std::to_string(snapshot.journal_sequence) : "") +
+                     " + " + std::to_string(replayed) + " journal records in " + std::to_string(elapsed.count()) + "ms");
+}
+
+void TradingEngine::apply_journal_record(const JournalRecord& record, std::unordered_set<std::string>& trade_ids) {
+    // Order and position records carry full state, so the last one applied wins
+    switch (record.type) {
+        case JournalRecordType::ORDER: {
+            auto order = EventJournal::decode_order(record);
+            auto [it, inserted] = orders_.try_emplace(order->get_order_id(), order);
+            if (inserted) {
+                add_order_to_symbol_index(order->get_instrument_symbol(), order->get_order_id());
+            } else {
+                it->second = order;
+            }
+            advance_sequence_past(order_sequence_, order->get_order_id(), "ORD");
+            break;
+        }
+        case JournalRecordType::TRADE: {
+            auto trade = EventJournal::decode_trade(record);
+            if (trade_ids.insert(trade->get_trade_id()).second) {
+                index_trade(trade);
+                // Fills precede the position records that include them, so a later record supersedes this
+                PositionCalculator::update_position_with_trade(*get_or_create_position(trade->get_instrument_symbol()),
+                                                               *trade);
+            }
+            advance_sequence_past(trade_sequence_, trade->get_trade_id(), "TRD");
+            break;
+        }
+        case JournalRecordType::POSITION: {
+            auto position = EventJournal::decode_position(record);
+            positions_[position->get_instrument_symbol()] = position;
+            break;
+        }
+        case JournalRecordType::NONE:
+            break;
+    }
+}
+
+void TradingEngine::advance_sequence_past(std::atomic<size_t>& sequence, const std::string& id, const char* prefix) {
+    // Ids look like ORD00000042_<millis>; the next generated id must not reuse 42
+    const size_t prefix_length = std::char_traits<char>::length(prefix);
+    if (id.compare(0, prefix_length, prefix) != 0) {
+        return;
+    }
+    size_t value = 0;
+    auto result = std::from_chars(id.data() + prefix_length, id.data() + id.size(), value);
+    if (result.ec == std::errc() && value + 1 > sequence.load()) {
+        sequence.store(value + 1);
+    }
+}
+
+void TradingEngine::snapshot_loop() {
+    std::unique_lock<std::mutex> lock(snapshot_mutex_);
+    while (!should_stop_.load()) {
+        snapshot_cv_.wait_for(lock, snapshot_interval_, [this] { return should_stop_.load(); });
+        if (should_stop_.load()) {
+            break;
+        }
+        lock.unlock();
+        write_snapshot();
+        lock.lock();
+    }
+}
+
+void TradingEngine::position_flush_loop() {
+    std::unique_lock<std::mutex> lock(position_flush_mutex_);
+    while (!should_stop_.load()) {
+        position_flush_cv_.wait_for(lock, position_flush_interval_, [this] { return should_stop_.load(); });
+        if (should_stop_.load()) {
+            break;
+        }
+        lock.unlock();
+        flush_dirty_positions();
+        lock.lock();
+    }
+}
+
+void TradingEngine::on_kill_switch_engaged() {
+    // May run on any thread, possibly one holding engine_mutex_, so defer the cancel to the processing thread
+    mass_cancel_pending_.store(true);
+    order_processing_queue_.try_push([]{});
+}
+
+size_t TradingEngine::cancel_all_orders(const std::string& reason) {
+    std::lock_guard<std::mutex> lock(engine_mutex_);
+
+    size_t canceled = 0;
+    for (const auto& [order_id, order] : orders_) {
+        if (!OrderManager::is_working_status(order->get_status())) {
+            continue;
+        }
+
+        OrderStatus old_status = order->get_status();
+        if (order->cancel()) {
+            risk_manager_->remove_working_order(order_id);
+            persist_order(order);
+            notify_order_update(order, old_status);
+            ++canceled;
+        }
+    }
+
+    log_engine_event("Mass cancel (" + reason + "): " + std::to_string(canceled) + " orders canceled");
+    return canceled;
+}
+
+// Notification methods (caller holds engine_mutex_)
+bool TradingEngine::holding_notifications() const {
+    // Anything raised behind a held fill waits with it, so subscribers see events in order
+    return hold_for_sequence_ != 0 || !held_notifications_.empty();
+}
+
+void TradingEngine::release_notifications_locked(uint64_t through_sequence) {
+    // A fill that timed out is released by its own caller; later ones still wait for the journal
+    uint64_t released = std::max(through_sequence, event_journal_ ? event_journal_->get_durable_sequence() : 0);
+    while (!held_notifications_.empty() && held_notifications_.front().first <= released) {
+        auto notification = std::move(held_notifications_.front().second);
+        held_notifications_.pop_front();
+        notification();
+    }
+}
+
 void TradingEngine::notify_order_update(std::shared_ptr<Order> order, OrderStatus old_status) {
     if (order_update_callback_) {
         ExecutionReport report;
         report.order_id = order->get_order_id();
+        report.symbol = order->get_instrument_symbol();
+        report.side = order->get_side();
+        report.type = order->get_type();
+        report.quantity = order->get_quantity();
+        report.price = order->get_price();
         report.old_status = old_status;
         report.new_status = order->get_status();
         report.filled_quantity = order->get_filled_quantity();
         report.remaining_quantity = order->get_remaining_quantity();
+        report.created_time = order->get_created_time();
         report.timestamp = order->get_last_modified();
         report.rejection_reason = order->get_rejection_reason();
 
-        order_update_callback_(report);
+        if (holding_notifications()) {
+            held_notifications_.emplace_back(hold_for_sequence_,
+                                             [this, report = std::move(report)]() { order_update_callback_(report); });
+        } else {
+            order_update_callback_(report);
+        }
     }
 }
 
 void TradingEngine::notify_trade(std::shared_ptr<Trade> trade) {
     if (trade_callback_) {
-        trade_callback_(*trade);
+        if (holding_notifications()) {
+            held_notifications_.emplace_back(hold_for_sequence_, [this, trade]() { trade_callback_(*trade); });
+        } else {
+            trade_callback_(*trade);
+        }
     }
 }
 
 void TradingEngine::notify_position_update(std::shared_ptr<Position> position) {
     if (position_update_callback_) {
-        position_update_callback_(*position);
+        if (holding_notifications()) {
+            held_notifications_.emplace_back(hold_for_sequence_,
+                                             [this, position]() { position_update_callback_(*position); });
+        } else {
+            position_update_callback_(*position);
+        }
     }
 }
 
 // Persistence methods
 void TradingEngine::persist_order(std::shared_ptr<Order> order) {
+    // Journal first, then write-behind; falls back to a synchronous write if neither accepts the row
+    if (event_journal_ && event_journal_->append_order(*order) != 0) {
+        return;
+    }
+    if (async_persistence_ && async_persistence_->enqueue_order(*order) != 0) {
+        return;
+    }
     if (persistence_service_) {
         try {
             persistence_service_->save_order(*order);
@@ -559,7 +976,17 @@ void TradingEngine::persist_order(std::shared_ptr<Order> order) {
     }
 }
 
-void TradingEngine::persist_trade(std::shared_ptr<Trade> trade) {
+uint64_t TradingEngine::persist_trade(std::shared_ptr<Trade> trade) {
+    // A journaled fill is acknowledged once its group commit is durable (see execute_order)
+    if (event_journal_) {
+        uint64_t sequence = event_journal_->append_trade(*trade);
+        if (sequence != 0) {
+            return sequence;
+        }
+    }
+    if (async_persistence_ && async_persistence_->enqueue_trade(*trade) != 0) {
+        return 0;
+    }
     if (persistence_service_) {
         try {
             persistence_service_->save_trade(*trade);
@@ -567,9 +994,16 @@ void TradingEngine::persist_trade(std::shared_ptr<Trade> trade) {
             log_engine_event("Failed to persist trade: " + std::string(e.what()));
         }
     }
+    return 0;
 }
 
 void TradingEngine::persist_position(std::shared_ptr<Position> position) {
+    if (event_journal_ && event_journal_->append_position(*position) != 0) {
+        return;
+    }
+    if (async_persistence_ && async_persistence_->enqueue_position(*position) != 0) {
+        return;
+    }
     if (persistence_service_) {
         try {
             persistence_service_->update_position(*position);
@@ -579,6 +1013,19 @@ void TradingEngine::persist_position(std::shared_ptr<Position> position) {
     }
 }
 
+size_t TradingEngine::flush_dirty_positions_locked() {
+    size_t flushed = 0;
+    for (const auto& symbol : dirty_positions_) {
+        auto it = positions_.find(symbol);
+        if (it != positions_.end()) {
+            persist_position(it->second);
+            ++flushed;
+        }
+    }
+    dirty_positions_.clear();
+    return flushed;
+}
+
 // Utility methods
 void TradingEngine::add_order_to_symbol_index(const std::string& symbol, const std::string& order_id) {
     orders_by_symbol_[symbol].push_back(order_id);
@@ -590,18 +1037,40 @@ void TradingEngine::remove_order_from_symbol_index(const std::string& symbol, co
 }
 
 // Logging methods
-void TradingEngine::log_order_event(const std::string& event, std::shared_ptr<Order> order) const {
-    Logger::info("TradingEngine: " + event + " - Order ID: " + order->get_order_id() +
-                 ", Symbol: " + order->get_instrument_symbol() +
-                 ", Status: " + order_status_to_string(order->get_status()));
-}
-
-void TradingEngine::log_trade_event(const std::string& event, std::shared_ptr<Trade> trade) const {
-    Logger::info("TradingEngine: " + event + " - Trade ID: " + trade->get_trade_id() +
-                 ", Order ID: " + trade->get_order_id() +
-                 ", Symbol: " + trade->get_instrument_symbol() +
-                 ", Quantity: " + std::to_string(trade->get_quantity()) +
-                 ", Price: " + std::to_string(trade->get_price()));
+void TradingEngine::log_order_event(const char* event, const std::shared_ptr<Order>& order) const {
+    ASYNC_LOG_INFO("TradingEngine: {} - Order ID: {}, Symbol: {}, Status: {}", event, order->get_order_id(),
+                   order->get_instrument_symbol(), order_status_to_string(order->get_status()));
+    record_order_event(order);
+}
+
+void TradingEngine::log_order_rejection(const char* event, const std::string& reason,
+                                        const std::shared_ptr<Order>& order) const {
+    // Throttled or rejected floods are summarised instead of logged one by one
+    ASYNC_LOG_RATE_LIMITED(Logger::Level::INFO, 100, "TradingEngine: {}: {} - Order ID: {}, Symbol: {}, Status: {}",
+                           event, reason, order->get_order_id(), order->get_instrument_symbol(),
+                           order_status_to_string(order->get_status()));
+    // The binary log keeps every rejection; it is cheap enough not to need the limiter
+    record_order_event(order);
+}
+
+void TradingEngine::log_trade_event(const char* event, const std::shared_ptr<Trade>& trade) const {
+    ASYNC_LOG_INFO("TradingEngine: {} - Trade ID: {}, Order ID: {}, Symbol: {}, Quantity: {}, Price: {}", event,
+                   trade->get_trade_id(), trade->get_order_id(), trade->get_instrument_symbol(),
+                   trade->get_quantity(), trade->get_price());
+    if (binary_event_log_) {
+        binary_event_log_->log_trade(trade->get_trade_id(), trade->get_order_id(), trade->get_instrument_symbol(),
+                                     static_cast<int>(trade->get_side()), static_cast<int>(trade->get_type()),
+                                     trade->get_quantity(), trade->get_price());
+    }
+}
+
+void TradingEngine::record_order_event(const std::shared_ptr<Order>& order) const {
+    if (binary_event_log_) {
+        binary_event_log_->log_order(order->get_order_id(), order->get_instrument_symbol(),
+                                     static_cast<int>(order->get_side()), static_cast<int>(order->get_type()),
+                                     static_cast<int>(order->get_status()), order->get_quantity(), order->get_price(),
+                                     order->get_filled_quantity());
+    }
 }
 
 void TradingEngine::log_engine_event(const std::string& event) const {
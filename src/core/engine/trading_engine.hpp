@@ -8,6 +8,10 @@
 #include "../risk/risk_manager.hpp"
 #include "../messaging/message_queue.hpp"
 #include "infrastructure/persistence/sqlite_service.hpp"
+#include "infrastructure/persistence/async_persistence_writer.hpp"
+#include "infrastructure/persistence/event_journal.hpp"
+#include "infrastructure/persistence/snapshot_store.hpp"
+#include "utils/binary_event_log.hpp"
 
 #include <memory>
 #include <string>
@@ -18,6 +22,10 @@
 #include <thread>
 #include <functional>
 #include <chrono>
+#include <condition_variable>
+#include <unordered_set>
+#include <deque>
+#include <utility>
 
 namespace trading {
 
@@ -69,6 +77,25 @@ public:
     // Additional functionality
     void set_market_data_provider(std::shared_ptr<class IMarketDataProvider> provider);
 
+    // Route persistence through a write-behind writer (nullptr restores synchronous writes)
+    void set_async_persistence(std::shared_ptr<AsyncPersistenceWriter> writer);
+
+    // Journal every order event, fill and position change first; fills are acknowledged once durable
+    void set_event_journal(std::shared_ptr<EventJournal> journal);
+
+    // Record order events and fills as binary records for offline analysis. Call before initialize().
+    void set_binary_event_log(std::shared_ptr<BinaryEventLog> event_log);
+
+    // Periodic full-state snapshots; initialize() recovers from the latest one plus journal replay.
+    // Call before initialize(); a final snapshot is written on shutdown.
+    void set_snapshot_store(std::shared_ptr<SnapshotStore> store, std::chrono::seconds interval);
+    bool write_snapshot();
+
+    // Coalesce position writes: fills mark the symbol dirty and its latest state is persisted every
+    // interval, before each snapshot and on shutdown (0 = persist every change). Call before initialize().
+    void set_position_flush_interval(std::chrono::milliseconds interval);
+    size_t flush_dirty_positions();
+
     // Statistics
     size_t get_order_count() const;
     size_t get_trade_count() const;
@@ -81,10 +108,17 @@ public:
     // Manual execution (for testing/simulation)
     bool execute_order(const std::string& order_id, double quantity, double price);
 
+    // Mass cancel of every working order (used by the kill switch)
+    size_t cancel_all_orders(const std::string& reason);
+
 private:
     // Dependencies
     std::shared_ptr<RiskManager> risk_manager_;
     std::shared_ptr<SQLiteService> persistence_service_;
+    std::shared_ptr<AsyncPersistenceWriter> async_persistence_;
+    std::shared_ptr<EventJournal> event_journal_;
+    std::shared_ptr<SnapshotStore> snapshot_store_;
+    std::shared_ptr<BinaryEventLog> binary_event_log_;
     std::shared_ptr<class IMarketDataProvider> market_data_provider_;
 
     // Engine state
@@ -111,18 +145,41 @@ private:
     std::function<void(const Trade&)> trade_callback_;
     std::function<void(const Position&)> position_update_callback_;
 
+    // Notifications held back until a fill's journal record is durable, in the order they were raised;
+    // each carries the journal sequence it waits for (0 = none of its own). Guarded by engine_mutex_.
+    std::deque<std::pair<uint64_t, std::function<void()>>> held_notifications_;
+    uint64_t hold_for_sequence_ = 0;
+
     // Message processing
     MessageQueue<std::function<void()>> order_processing_queue_;
     std::thread order_processing_thread_;
 
+    // Snapshot thread
+    std::chrono::seconds snapshot_interval_;
+    std::thread snapshot_thread_;
+    std::mutex snapshot_mutex_;
+    std::condition_variable snapshot_cv_;
+
+    // Coalesced position persistence (dirty_positions_ guarded by engine_mutex_)
+    std::chrono::milliseconds position_flush_interval_;
+    std::unordered_set<std::string> dirty_positions_;
+    std::thread position_flush_thread_;
+    std::mutex position_flush_mutex_;
+    std::condition_variable position_flush_cv_;
+
+    // Kill switch integration
+    size_t kill_switch_callback_id_;
+    std::atomic<bool> mass_cancel_pending_;
+
     // Helper methods
     std::string generate_order_id();
     std::string generate_trade_id();
 
     // Order lifecycle
     bool validate_order_request(const OrderRequest& request) const;
+    bool cancel_order_internal(const std::string& order_id, bool apply_throttle);
     std::shared_ptr<Order> create_order(const OrderRequest& request);
-    bool accept_order(std::shared_ptr<Order> order);
+    bool accept_order(std::shared_ptr<Order> order, std::function<void()> work);   // False when the queue is full
     bool reject_order(std::shared_ptr<Order> order, const std::string& reason);
 
     // Order execution
@@ -137,24 +194,37 @@ private:
         double price,
         TradeType type = TradeType::FULL_FILL
     );
-    void process_trade(std::shared_ptr<Trade> trade);
+    uint64_t process_trade(std::shared_ptr<Trade> trade);   // Returns the fill's journal sequence, 0 if none
+    void index_trade(std::shared_ptr<Trade> trade);
 
     // Position management
     void update_position(std::shared_ptr<Trade> trade);
     std::shared_ptr<Position> get_or_create_position(const std::string& symbol);
+    void publish_daily_pnl();
 
     // Event notifications
     void notify_order_update(std::shared_ptr<Order> order, OrderStatus old_status);
     void notify_trade(std::shared_ptr<Trade> trade);
     void notify_position_update(std::shared_ptr<Position> position);
+    bool holding_notifications() const;
+    void release_notifications_locked(uint64_t through_sequence);
 
     // Persistence
     void persist_order(std::shared_ptr<Order> order);
-    void persist_trade(std::shared_ptr<Trade> trade);
+    uint64_t persist_trade(std::shared_ptr<Trade> trade);
     void persist_position(std::shared_ptr<Position> position);
+    size_t flush_dirty_positions_locked();
+    void position_flush_loop();
+
+    // Recovery (caller holds engine_mutex_)
+    void recover_state();
+    void apply_journal_record(const JournalRecord& record, std::unordered_set<std::string>& trade_ids);
+    void advance_sequence_past(std::atomic<size_t>& sequence, const std::string& id, const char* prefix);
+    void snapshot_loop();
 
     // Order processing thread
     void process_orders();
+    void on_kill_switch_engaged();
 
     // Market data integration
     double get_market_price(const std::string& symbol, OrderType order_type) const;
@@ -163,9 +233,11 @@ private:
     void add_order_to_symbol_index(const std::string& symbol, const std::string& order_id);
     void remove_order_from_symbol_index(const std::string& symbol, const std::string& order_id);
 
-    // Logging
-    void log_order_event(const std::string& event, std::shared_ptr<Order> order) const;
-    void log_trade_event(const std::string& event, std::shared_ptr<Trade> trade) const;
+    // Logging - order and trade events go through the async logger without building strings
+    void log_order_event(const char* event, const std::shared_ptr<Order>& order) const;
+    void log_order_rejection(const char* event, const std::string& reason, const std::shared_ptr<Order>& order) const;
+    void log_trade_event(const char* event, const std::shared_ptr<Trade>& trade) const;
+    void record_order_event(const std::shared_ptr<Order>& order) const;
     void log_engine_event(const std::string& event) const;
 };
 
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace trading {
+
+/**
+ * Bounded lock-free multi-producer/multi-consumer queue
+ * Features:
+ * - Fixed power-of-two ring of sequenced cells (Vyukov), no allocation after construction
+ * - Non-blocking try_push/try_pop only; callers choose their own backoff
+ * - Items are dequeued in enqueue-position order, which try_push can report
+ */
+template<typename T>
+class LockFreeQueue {
+public:
+    explicit LockFreeQueue(size_t capacity = 1024);
+    ~LockFreeQueue() = default;
+
+    // Non-copyable, non-movable (producers hold references into the ring)
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    // Push operations - false when the queue is full
+    bool try_push(T&& item);
+    bool try_push(const T& item);
+    // position receives the item's zero-based place in the overall enqueue order
+    bool try_push(T&& item, uint64_t& position);
+
+    // Pop operations - false when the queue is empty
+    bool try_pop(T& item);
+
+    // Query operations (approximate while producers/consumers are active)
+    size_t size() const;
+    bool empty() const { return size() == 0; }
+    size_t capacity() const { return capacity_; }
+
+private:
+    struct Cell {
+        std::atomic<uint64_t> sequence;
+        T data;
+    };
+
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    const size_t capacity_;
+    const uint64_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> enqueue_position_{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> dequeue_position_{0};
+
+    static size_t round_up_to_power_of_two(size_t value);
+};
+
+// Implementation
+
+template<typename T>
+LockFreeQueue<T>::LockFreeQueue(size_t capacity)
+    : capacity_(round_up_to_power_of_two(capacity))
+    , mask_(static_cast<uint64_t>(capacity_ - 1))
+    , cells_(new Cell[capacity_]) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Queue size must be positive");
+    }
+    for (size_t i = 0; i < capacity_; ++i) {
+        cells_[i].sequence.store(static_cast<uint64_t>(i), std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+bool LockFreeQueue<T>::try_push(T&& item) {
+    uint64_t position = 0;
+    return try_push(std::move(item), position);
+}
+
+template<typename T>
+bool LockFreeQueue<T>::try_push(const T& item) {
+    T copy(item);
+    return try_push(std::move(copy));
+}
+
+template<typename T>
+bool LockFreeQueue<T>::try_push(T&& item, uint64_t& position) {
+    uint64_t pos = enqueue_position_.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells_[pos & mask_];
+        uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<int64_t>(sequence - pos);
+        if (diff == 0) {
+            if (enqueue_position_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.data = std::move(item);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                position = pos;
+                return true;
+            }
+        } else if (diff < 0) {
+            return false; // Full
+        } else {
+            pos = enqueue_position_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename T>
+bool LockFreeQueue<T>::try_pop(T& item) {
+    uint64_t pos = dequeue_position_.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells_[pos & mask_];
+        uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<int64_t>(sequence - (pos + 1));
+        if (diff == 0) {
+            if (dequeue_position_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                item = std::move(cell.data);
+                cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false; // Empty (or the next item is still being written)
+        } else {
+            pos = dequeue_position_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename T>
+size_t LockFreeQueue<T>::size() const {
+    uint64_t enqueued = enqueue_position_.load(std::memory_order_relaxed);
+    uint64_t dequeued = dequeue_position_.load(std::memory_order_relaxed);
+    return enqueued > dequeued ? static_cast<size_t>(enqueued - dequeued) : 0;
+}
+
+template<typename T>
+size_t LockFreeQueue<T>::round_up_to_power_of_two(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+} // namespace trading
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace trading {
+
+/**
+ * Lock-free single-producer/single-consumer triple buffer
+ * Features:
+ * - The producer edits its own back slot and publishes it with one atomic exchange
+ * - The consumer takes the most recent publication with one atomic exchange; older ones are skipped
+ * - Neither side ever waits for the other, and slots are reused so steady state does not allocate
+ * Each slot keeps its contents between uses, so a producer can bring a stale slot up to
+ * date incrementally (e.g. append only what it is missing) instead of rebuilding it.
+ */
+template<typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+
+    // Non-copyable, non-movable (both sides hold references into the slots)
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Producer side: update(T& back) edits the back slot, which is then published
+    template<typename Update>
+    void write(Update&& update);
+
+    // Consumer side: true if a newer publication replaced the front slot
+    bool update_front();
+    const T& front() const { return slots_[front_]; }
+    T& front() { return slots_[front_]; }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t DIRTY = 0x4;     // Middle slot holds an unread publication
+
+    std::array<T, 3> slots_{};
+    alignas(64) std::atomic<uint8_t> middle_{1};
+    alignas(64) uint8_t back_ = 0;            // Producer-owned
+    alignas(64) uint8_t front_ = 2;           // Consumer-owned
+};
+
+// Implementation
+
+template<typename T>
+template<typename Update>
+void TripleBuffer<T>::write(Update&& update) {
+    std::forward<Update>(update)(slots_[back_]);
+    back_ = middle_.exchange(static_cast<uint8_t>(back_ | DIRTY), std::memory_order_acq_rel) & INDEX_MASK;
+}
+
+template<typename T>
+bool TripleBuffer<T>::update_front() {
+    if ((middle_.load(std::memory_order_relaxed) & DIRTY) == 0) {
+        return false;
+    }
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX_MASK;
+    return true;
+}
+
+} // namespace trading
@@ -5,9 +5,15 @@ namespace trading {
 
 Order::Order(const std::string& order_id, const std::string& instrument_symbol,
              OrderSide side, OrderType type, double quantity, double price)
+    : Order(order_id, instrument_symbol, side, type, quantity, price, std::chrono::system_clock::now()) {
+}
+
+Order::Order(const std::string& order_id, const std::string& instrument_symbol,
+             OrderSide side, OrderType type, double quantity, double price,
+             std::chrono::system_clock::time_point created_time)
     : order_id_(order_id), instrument_symbol_(instrument_symbol),
       side_(side), type_(type), quantity_(quantity), price_(price),
-      created_time_(std::chrono::system_clock::now()),
+      created_time_(created_time),
       status_(OrderStatus::NEW), filled_quantity_(0.0), total_fill_value_(0.0),
       last_modified_(created_time_) {
 
@@ -68,12 +74,12 @@ bool Order::is_fully_filled() const {
 
 bool Order::is_working() const {
     std::lock_guard<std::mutex> lock(state_mutex_);
-    return status_ == OrderStatus::ACCEPTED || status_ == OrderStatus::PARTIALLY_FILLED;
+    return is_working_unlocked();
 }
 
 bool Order::is_cancelable() const {
     std::lock_guard<std::mutex> lock(state_mutex_);
-    return is_working();
+    return is_working_unlocked();
 }
 
 bool Order::accept() {
@@ -99,7 +105,7 @@ bool Order::reject(const std::string& reason) {
 
 bool Order::cancel() {
     std::lock_guard<std::mutex> lock(state_mutex_);
-    if (is_working()) {
+    if (is_working_unlocked()) {
         status_ = OrderStatus::CANCELED;
         update_last_modified();
         return true;
@@ -109,7 +115,7 @@ bool Order::cancel() {
 
 bool Order::fill(double quantity, double price) {
     std::lock_guard<std::mutex> lock(state_mutex_);
-    if (!is_working()) {
+    if (!is_working_unlocked()) {
         return false;
     }
 
@@ -139,6 +145,17 @@ bool Order::partial_fill(double quantity, double price) {
     return fill(quantity, price);
 }
 
+void Order::restore_state(OrderStatus status, double filled_quantity, double total_fill_value,
+                          std::chrono::system_clock::time_point last_modified,
+                          const std::string& rejection_reason) {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    status_ = status;
+    filled_quantity_ = filled_quantity;
+    total_fill_value_ = total_fill_value;
+    last_modified_ = last_modified;
+    rejection_reason_ = rejection_reason;
+}
+
 bool Order::is_valid() const {
     return !order_id_.empty() &&
            !instrument_symbol_.empty() &&
@@ -174,6 +191,10 @@ bool Order::is_status_transition_valid(OrderStatus new_status) const {
     }
 }
 
+bool Order::is_working_unlocked() const {
+    return status_ == OrderStatus::ACCEPTED || status_ == OrderStatus::PARTIALLY_FILLED;
+}
+
 void Order::update_last_modified() {
     last_modified_ = std::chrono::system_clock::now();
 }
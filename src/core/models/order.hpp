@@ -12,6 +12,9 @@ public:
     // Constructor
     Order(const std::string& order_id, const std::string& instrument_symbol,
           OrderSide side, OrderType type, double quantity, double price = 0.0);
+    Order(const std::string& order_id, const std::string& instrument_symbol,
+          OrderSide side, OrderType type, double quantity, double price,
+          std::chrono::system_clock::time_point created_time);
 
     // Getters
     const std::string& get_order_id() const { return order_id_; }
@@ -40,6 +43,11 @@ public:
     bool fill(double quantity, double price);
     bool partial_fill(double quantity, double price);
 
+    // Recovery - reinstates persisted state as-is, bypassing transition checks
+    void restore_state(OrderStatus status, double filled_quantity, double total_fill_value,
+                       std::chrono::system_clock::time_point last_modified,
+                       const std::string& rejection_reason);
+
     // Validation
     bool is_valid() const;
     bool is_status_transition_valid(OrderStatus new_status) const;
@@ -62,7 +70,8 @@ private:
     std::chrono::system_clock::time_point last_modified_;
     std::string rejection_reason_;       // If status == REJECTED
 
-    // Helper methods
+    // Helper methods (caller holds state_mutex_)
+    bool is_working_unlocked() const;
     void update_last_modified();
     bool is_terminal_status(OrderStatus status) const;
 };
@@ -150,6 +150,16 @@ void Position::close_position() {
     update_last_modified();
 }
 
+void Position::restore_state(double quantity, double average_price, double realized_pnl,
+                             double unrealized_pnl, std::chrono::system_clock::time_point last_updated) {
+    std::lock_guard<std::mutex> lock(position_mutex_);
+    quantity_ = quantity;
+    average_price_ = average_price;
+    realized_pnl_ = realized_pnl;
+    unrealized_pnl_ = unrealized_pnl;
+    last_updated_ = last_updated;
+}
+
 bool Position::is_valid() const {
     std::lock_guard<std::mutex> lock(position_mutex_);
 
@@ -31,6 +31,10 @@ public:
     void update_unrealized_pnl(double current_price);
     void close_position();
 
+    // Recovery - reinstates persisted state as-is
+    void restore_state(double quantity, double average_price, double realized_pnl,
+                       double unrealized_pnl, std::chrono::system_clock::time_point last_updated);
+
     // Validation
     bool is_valid() const;
 
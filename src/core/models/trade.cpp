@@ -7,9 +7,16 @@ namespace trading {
 Trade::Trade(const std::string& trade_id, const std::string& order_id,
              const std::string& instrument_symbol, OrderSide side,
              double quantity, double price, TradeType type)
+    : Trade(trade_id, order_id, instrument_symbol, side, quantity, price, type, std::chrono::system_clock::now()) {
+}
+
+Trade::Trade(const std::string& trade_id, const std::string& order_id,
+             const std::string& instrument_symbol, OrderSide side,
+             double quantity, double price, TradeType type,
+             std::chrono::system_clock::time_point execution_time)
     : trade_id_(trade_id), order_id_(order_id), instrument_symbol_(instrument_symbol),
       side_(side), quantity_(quantity), price_(price),
-      execution_time_(std::chrono::system_clock::now()), type_(type) {
+      execution_time_(execution_time), type_(type) {
 
     if (trade_id.empty()) {
         throw std::invalid_argument("Trade ID cannot be empty");
@@ -17,6 +17,10 @@ public:
     Trade(const std::string& trade_id, const std::string& order_id,
           const std::string& instrument_symbol, OrderSide side,
           double quantity, double price, TradeType type = TradeType::FULL_FILL);
+    Trade(const std::string& trade_id, const std::string& order_id,
+          const std::string& instrument_symbol, OrderSide side,
+          double quantity, double price, TradeType type,
+          std::chrono::system_clock::time_point execution_time);
 
     // Getters
     const std::string& get_trade_id() const { return trade_id_; }
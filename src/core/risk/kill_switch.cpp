@@ -0,0 +1,153 @@
+#include "kill_switch.hpp"
+#include "../../utils/logging.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace trading {
+
+// KillSwitch implementation
+
+bool KillSwitch::engage(const std::string& reason) {
+    std::vector<TripCallback> callbacks;
+    {
+        // The reason is in place before the state word says engaged, and both change under mutex_
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint64_t state = state_.load(std::memory_order_relaxed);
+        if (is_engaged(state)) {
+            return false; // Already engaged
+        }
+        reason_ = reason;
+        state_.store((state + EPOCH_STEP) | ENGAGED, std::memory_order_release);   // Flag and epoch in one step
+        callbacks.reserve(callbacks_.size());
+        for (const auto& [id, callback] : callbacks_) {
+            callbacks.push_back(callback);
+        }
+    }
+
+    Logger::critical("KillSwitch: Engaged - " + reason);
+
+    for (const auto& callback : callbacks) {
+        try {
+            callback(reason);
+        } catch (const std::exception& e) {
+            Logger::error("KillSwitch: Trip callback failed: " + std::string(e.what()));
+        }
+    }
+    return true;
+}
+
+void KillSwitch::reset() {
+    bool was_engaged = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        was_engaged = is_engaged(state_.fetch_and(~ENGAGED, std::memory_order_release));
+        reason_.clear();
+    }
+    if (was_engaged) {
+        Logger::warn("KillSwitch: Reset, trading re-enabled");
+    }
+}
+
+std::string KillSwitch::get_reason() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return reason_;
+}
+
+size_t KillSwitch::add_trip_callback(TripCallback callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t id = next_callback_id_++;
+    callbacks_.emplace_back(id, std::move(callback));
+    return id;
+}
+
+void KillSwitch::remove_trip_callback(size_t callback_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    callbacks_.erase(
+        std::remove_if(callbacks_.begin(), callbacks_.end(),
+            [callback_id](const auto& entry) { return entry.first == callback_id; }),
+        callbacks_.end());
+}
+
+// CircuitBreaker implementation
+
+CircuitBreaker::CircuitBreaker(KillSwitch& kill_switch)
+    : kill_switch_(kill_switch) {
+}
+
+void CircuitBreaker::configure(const RiskManagementConfig& config) {
+    max_loss_.store(config.circuit_breaker_max_loss, std::memory_order_relaxed);
+    max_orders_per_second_.store(static_cast<uint32_t>(std::max(0, config.circuit_breaker_max_orders_per_second)),
+                                 std::memory_order_relaxed);
+    max_reject_rate_.store(config.circuit_breaker_max_reject_rate, std::memory_order_relaxed);
+    min_orders_for_reject_rate_.store(static_cast<uint32_t>(std::max(0, config.circuit_breaker_min_orders)),
+                                      std::memory_order_relaxed);
+    max_feed_staleness_ns_.store(static_cast<int64_t>(std::max(0, config.circuit_breaker_max_feed_staleness_ms)) * 1000000,
+                                 std::memory_order_relaxed);
+}
+
+void CircuitBreaker::record_order(bool rejected) {
+    int64_t second = now_ns() / 1000000000;
+    int64_t current = window_second_.load(std::memory_order_relaxed);
+    if (second != current && window_second_.compare_exchange_strong(current, second, std::memory_order_relaxed)) {
+        // Counts racing with the rollover may be dropped; the breaker only needs the order of magnitude
+        window_orders_.store(0, std::memory_order_relaxed);
+        window_rejects_.store(0, std::memory_order_relaxed);
+    }
+
+    uint32_t orders = window_orders_.fetch_add(1, std::memory_order_relaxed) + 1;
+    uint32_t rejects = rejected ? window_rejects_.fetch_add(1, std::memory_order_relaxed) + 1
+                                : window_rejects_.load(std::memory_order_relaxed);
+
+    uint32_t max_orders = max_orders_per_second_.load(std::memory_order_relaxed);
+    if (max_orders > 0 && orders > max_orders) {
+        trip("Order rate " + std::to_string(orders) + "/s exceeds " + std::to_string(max_orders) + "/s");
+        return;
+    }
+
+    double max_reject_rate = max_reject_rate_.load(std::memory_order_relaxed);
+    if (rejected && max_reject_rate > 0.0 && orders >= min_orders_for_reject_rate_.load(std::memory_order_relaxed)) {
+        double reject_rate = static_cast<double>(rejects) / static_cast<double>(orders);
+        if (reject_rate > max_reject_rate) {
+            trip("Reject rate " + std::to_string(reject_rate * 100.0) + "% exceeds " +
+                 std::to_string(max_reject_rate * 100.0) + "%");
+        }
+    }
+}
+
+void CircuitBreaker::record_daily_pnl(double daily_pnl) {
+    double max_loss = max_loss_.load(std::memory_order_relaxed);
+    if (max_loss > 0.0 && daily_pnl < -max_loss) {
+        trip("Daily loss " + std::to_string(-daily_pnl) + " exceeds " + std::to_string(max_loss));
+    }
+}
+
+void CircuitBreaker::record_market_data() {
+    last_market_data_ns_.store(now_ns(), std::memory_order_relaxed);
+}
+
+void CircuitBreaker::check_feed_staleness() {
+    int64_t max_staleness = max_feed_staleness_ns_.load(std::memory_order_relaxed);
+    int64_t last_tick = last_market_data_ns_.load(std::memory_order_relaxed);
+    if (max_staleness <= 0 || last_tick == 0) {
+        return;
+    }
+
+    int64_t staleness = now_ns() - last_tick;
+    if (staleness > max_staleness) {
+        trip("Market data stale for " + std::to_string(staleness / 1000000) + "ms");
+    }
+}
+
+int64_t CircuitBreaker::now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void CircuitBreaker::trip(const std::string& reason) {
+    if (!kill_switch_.is_engaged()) {
+        kill_switch_.engage("Circuit breaker: " + reason);
+    }
+}
+
+} // namespace trading
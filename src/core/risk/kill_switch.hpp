@@ -0,0 +1,107 @@
+#pragma once
+
+#include "utils/config.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace trading {
+
+/**
+ * Kill Switch
+ * Process-wide trading halt. One atomic word holds the engaged flag in bit 0
+ * and a trip epoch above it, so the hot path answers "engaged?" and "tripped
+ * since?" with a single load. Every trip advances the epoch so work queued
+ * before the trip can be fenced off.
+ */
+class KillSwitch {
+public:
+    using TripCallback = std::function<void(const std::string& reason)>;
+
+    KillSwitch() = default;
+
+    // Non-copyable
+    KillSwitch(const KillSwitch&) = delete;
+    KillSwitch& operator=(const KillSwitch&) = delete;
+
+    // Hot path - a state word differs from an earlier one once the switch has tripped since.
+    // Relaxed: callers only compare words; the reason is read through get_reason() under mutex_.
+    uint64_t get_state() const noexcept { return state_.load(std::memory_order_relaxed); }
+    static constexpr bool is_engaged(uint64_t state) noexcept { return (state & ENGAGED) != 0; }
+    static constexpr uint64_t epoch_of(uint64_t state) noexcept { return state >> 1; }
+
+    bool is_engaged() const noexcept { return is_engaged(get_state()); }
+    uint64_t get_epoch() const noexcept { return epoch_of(get_state()); }
+
+    // Control - engage() returns true only for the call that actually tripped the switch
+    bool engage(const std::string& reason);
+    void reset();
+    std::string get_reason() const;
+
+    // Trip notification (invoked on the tripping thread, outside any lock)
+    size_t add_trip_callback(TripCallback callback);
+    void remove_trip_callback(size_t callback_id);
+
+private:
+    static constexpr uint64_t ENGAGED = 1;
+    static constexpr uint64_t EPOCH_STEP = 2;
+
+    std::atomic<uint64_t> state_{0};   // Written only under mutex_
+
+    mutable std::mutex mutex_;
+    std::string reason_;
+    std::vector<std::pair<size_t, TripCallback>> callbacks_;
+    size_t next_callback_id_ = 1;
+};
+
+/**
+ * Circuit Breaker
+ * Trips the kill switch on configured loss, order rate, reject rate or
+ * market data staleness breaches. Counters are lock-free; thresholds of 0 disable
+ * the corresponding trigger.
+ */
+class CircuitBreaker {
+public:
+    explicit CircuitBreaker(KillSwitch& kill_switch);
+
+    void configure(const RiskManagementConfig& config);
+
+    // Event feeds
+    void record_order(bool rejected);
+    void record_daily_pnl(double daily_pnl);
+    void record_market_data();
+
+    // Periodic checks for conditions that are breached by absence of events
+    void check_feed_staleness();
+
+    // Current one-second window statistics
+    uint32_t get_window_orders() const { return window_orders_.load(std::memory_order_relaxed); }
+    uint32_t get_window_rejects() const { return window_rejects_.load(std::memory_order_relaxed); }
+
+private:
+    KillSwitch& kill_switch_;
+
+    // Thresholds
+    std::atomic<double> max_loss_{0.0};
+    std::atomic<uint32_t> max_orders_per_second_{0};
+    std::atomic<double> max_reject_rate_{0.0};
+    std::atomic<uint32_t> min_orders_for_reject_rate_{0};
+    std::atomic<int64_t> max_feed_staleness_ns_{0};
+
+    // One-second order/reject window
+    std::atomic<int64_t> window_second_{0};
+    std::atomic<uint32_t> window_orders_{0};
+    std::atomic<uint32_t> window_rejects_{0};
+
+    // Market data heartbeat (0 until the first tick arrives)
+    std::atomic<int64_t> last_market_data_ns_{0};
+
+    static int64_t now_ns();
+    void trip(const std::string& reason);
+};
+
+} // namespace trading
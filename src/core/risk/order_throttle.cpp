@@ -0,0 +1,178 @@
+#include "order_throttle.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace trading {
+
+// TokenRate implementation
+
+TokenRate TokenRate::per_second(double rate, double burst) {
+    TokenRate token_rate;
+    if (rate > 0.0) {
+        token_rate.interval_ns = 1e9 / rate;
+        token_rate.capacity_ns = std::max(burst, 1.0) * token_rate.interval_ns;
+    }
+    return token_rate;
+}
+
+// TokenBucket implementation
+
+bool TokenBucket::try_acquire(int64_t now_ns, const TokenRate& rate, double cost) {
+    if (!rate.is_limited()) {
+        return true;
+    }
+
+    const auto increment = static_cast<int64_t>(std::llround(cost * rate.interval_ns));
+    const auto capacity = static_cast<int64_t>(std::llround(rate.capacity_ns));
+
+    int64_t tat = theoretical_arrival_ns_.load(std::memory_order_relaxed);
+    for (;;) {
+        int64_t new_tat = std::max(tat, now_ns) + increment;
+        if (new_tat - now_ns > capacity) {
+            return false;
+        }
+        if (theoretical_arrival_ns_.compare_exchange_weak(tat, new_tat, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+void TokenBucket::release(const TokenRate& rate, double cost) {
+    if (rate.is_limited()) {
+        theoretical_arrival_ns_.fetch_sub(static_cast<int64_t>(std::llround(cost * rate.interval_ns)),
+                                          std::memory_order_relaxed);
+    }
+}
+
+// ThrottleResult
+
+const char* throttle_result_to_string(ThrottleResult result) {
+    switch (result) {
+        case ThrottleResult::ALLOWED:            return "Allowed";
+        case ThrottleResult::GLOBAL_ORDER_RATE:  return "Global order rate limit exceeded";
+        case ThrottleResult::SYMBOL_ORDER_RATE:  return "Symbol order rate limit exceeded";
+        case ThrottleResult::GLOBAL_CANCEL_RATE: return "Global cancel rate limit exceeded";
+        case ThrottleResult::SYMBOL_CANCEL_RATE: return "Symbol cancel rate limit exceeded";
+        case ThrottleResult::NOTIONAL_RATE:      return "Notional per second limit exceeded";
+    }
+    return "Unknown";
+}
+
+// OrderThrottle implementation
+
+void OrderThrottle::AtomicRate::store(const TokenRate& rate) {
+    interval_ns.store(rate.interval_ns, std::memory_order_relaxed);
+    capacity_ns.store(rate.capacity_ns, std::memory_order_relaxed);
+}
+
+TokenRate OrderThrottle::AtomicRate::load() const {
+    TokenRate rate;
+    rate.interval_ns = interval_ns.load(std::memory_order_relaxed);
+    rate.capacity_ns = capacity_ns.load(std::memory_order_relaxed);
+    return rate;
+}
+
+OrderThrottle::OrderThrottle()
+    : symbol_buckets_(std::make_unique<SymbolSlotTable<SymbolBuckets, MAX_SYMBOLS>>()) {
+}
+
+void OrderThrottle::configure(const RiskManagementConfig& config) {
+    // Each bucket may burst up to one second's worth of its rate
+    auto rate = [](int per_second) {
+        double value = static_cast<double>(std::max(0, per_second));
+        return TokenRate::per_second(value, value);
+    };
+    global_order_rate_.store(rate(config.max_orders_per_second));
+    global_cancel_rate_.store(rate(config.max_cancels_per_second));
+    symbol_order_rate_.store(rate(config.max_orders_per_second_per_symbol));
+    symbol_cancel_rate_.store(rate(config.max_cancels_per_second_per_symbol));
+
+    // Notional tokens are currency units, so the rate is set directly rather than per order
+    double max_notional = std::max(0.0, config.max_notional_per_second);
+    notional_rate_.store(TokenRate::per_second(max_notional, max_notional));
+}
+
+ThrottleResult OrderThrottle::try_acquire_order(std::string_view symbol) {
+    return try_acquire(symbol, false);
+}
+
+ThrottleResult OrderThrottle::try_acquire_cancel(std::string_view symbol) {
+    return try_acquire(symbol, true);
+}
+
+ThrottleResult OrderThrottle::try_acquire_notional(double notional) {
+    const TokenRate rate = notional_rate_.load();
+    if (!rate.is_limited() || notional <= 0.0) {
+        return ThrottleResult::ALLOWED;
+    }
+
+    if (!notional_.try_acquire(now_ns(), rate, notional)) {
+        throttled_count_.fetch_add(1, std::memory_order_relaxed);
+        return ThrottleResult::NOTIONAL_RATE;
+    }
+    return ThrottleResult::ALLOWED;
+}
+
+ThrottleResult OrderThrottle::try_acquire(std::string_view symbol, bool is_cancel) {
+    const TokenRate global_rate = (is_cancel ? global_cancel_rate_ : global_order_rate_).load();
+    const TokenRate symbol_rate = (is_cancel ? symbol_cancel_rate_ : symbol_order_rate_).load();
+    if (!global_rate.is_limited() && !symbol_rate.is_limited()) {
+        return ThrottleResult::ALLOWED;
+    }
+
+    const int64_t now = now_ns();
+
+    // Symbols beyond the table capacity are only subject to the global limit
+    TokenBucket* symbol_bucket = nullptr;
+    if (symbol_rate.is_limited()) {
+        if (SymbolBuckets* buckets = symbol_buckets_->find_or_insert(symbol)) {
+            symbol_bucket = is_cancel ? &buckets->cancels : &buckets->orders;
+        }
+    }
+
+    if (symbol_bucket && !symbol_bucket->try_acquire(now, symbol_rate)) {
+        throttled_count_.fetch_add(1, std::memory_order_relaxed);
+        return is_cancel ? ThrottleResult::SYMBOL_CANCEL_RATE : ThrottleResult::SYMBOL_ORDER_RATE;
+    }
+
+    TokenBucket& global_bucket = is_cancel ? global_cancels_ : global_orders_;
+    if (!global_bucket.try_acquire(now, global_rate)) {
+        // Refund the symbol token so a global rejection does not consume per-symbol budget
+        if (symbol_bucket) {
+            symbol_bucket->release(symbol_rate);
+        }
+        throttled_count_.fetch_add(1, std::memory_order_relaxed);
+        return is_cancel ? ThrottleResult::GLOBAL_CANCEL_RATE : ThrottleResult::GLOBAL_ORDER_RATE;
+    }
+
+    return ThrottleResult::ALLOWED;
+}
+
+void OrderThrottle::release_order(std::string_view symbol) {
+    const TokenRate symbol_rate = symbol_order_rate_.load();
+    if (symbol_rate.is_limited()) {
+        if (SymbolBuckets* buckets = symbol_buckets_->find_or_insert(symbol)) {
+            buckets->orders.release(symbol_rate);
+        }
+    }
+    const TokenRate global_rate = global_order_rate_.load();
+    if (global_rate.is_limited()) {
+        global_orders_.release(global_rate);
+    }
+}
+
+void OrderThrottle::release_notional(double notional) {
+    const TokenRate rate = notional_rate_.load();
+    if (rate.is_limited() && notional > 0.0) {
+        notional_.release(rate, notional);
+    }
+}
+
+int64_t OrderThrottle::now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace trading
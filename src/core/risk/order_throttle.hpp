@@ -0,0 +1,108 @@
+#pragma once
+
+#include "symbol_slot_table.hpp"
+#include "utils/config.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace trading {
+
+/**
+ * Token Rate
+ * Refill interval and bucket depth expressed in nanoseconds of credit
+ */
+struct TokenRate {
+    double interval_ns = 0.0;  // Time to earn one token (0 = unlimited)
+    double capacity_ns = 0.0;  // Burst depth: capacity tokens * interval
+
+    static TokenRate per_second(double rate, double burst);
+    bool is_limited() const { return interval_ns > 0.0; }
+};
+
+/**
+ * Token Bucket
+ * Lock-free token bucket kept as a single theoretical arrival time (GCRA),
+ * so acquiring is one CAS and the rate can be shared between many buckets
+ */
+class TokenBucket {
+public:
+    bool try_acquire(int64_t now_ns, const TokenRate& rate, double cost = 1.0);
+    void release(const TokenRate& rate, double cost = 1.0);
+
+private:
+    std::atomic<int64_t> theoretical_arrival_ns_{0};
+};
+
+/**
+ * Throttle Result
+ */
+enum class ThrottleResult : uint8_t {
+    ALLOWED = 0,
+    GLOBAL_ORDER_RATE,
+    SYMBOL_ORDER_RATE,
+    GLOBAL_CANCEL_RATE,
+    SYMBOL_CANCEL_RATE,
+    NOTIONAL_RATE
+};
+
+const char* throttle_result_to_string(ThrottleResult result);
+
+/**
+ * Order Throttle
+ * Global and per-symbol order/cancel rate limits and a global notional-per-second
+ * budget from RiskManagementConfig.
+ * Everything on the acquire path is atomic; configure() may run concurrently.
+ */
+class OrderThrottle {
+public:
+    static constexpr size_t MAX_SYMBOLS = 16384;
+
+    OrderThrottle();
+
+    void configure(const RiskManagementConfig& config);
+
+    ThrottleResult try_acquire_order(std::string_view symbol);
+    ThrottleResult try_acquire_cancel(std::string_view symbol);
+    ThrottleResult try_acquire_notional(double notional);
+
+    // Refund tokens taken for an order that was then rejected before reaching the market
+    void release_order(std::string_view symbol);
+    void release_notional(double notional);
+
+    uint64_t get_throttled_count() const { return throttled_count_.load(std::memory_order_relaxed); }
+
+private:
+    struct AtomicRate {
+        std::atomic<double> interval_ns{0.0};
+        std::atomic<double> capacity_ns{0.0};
+
+        void store(const TokenRate& rate);
+        TokenRate load() const;
+    };
+
+    struct SymbolBuckets {
+        TokenBucket orders;
+        TokenBucket cancels;
+    };
+
+    AtomicRate global_order_rate_;
+    AtomicRate global_cancel_rate_;
+    AtomicRate symbol_order_rate_;
+    AtomicRate symbol_cancel_rate_;
+    AtomicRate notional_rate_;
+
+    TokenBucket global_orders_;
+    TokenBucket global_cancels_;
+    TokenBucket notional_;
+    std::unique_ptr<SymbolSlotTable<SymbolBuckets, MAX_SYMBOLS>> symbol_buckets_;
+
+    std::atomic<uint64_t> throttled_count_{0};
+
+    ThrottleResult try_acquire(std::string_view symbol, bool is_cancel);
+    static int64_t now_ns();
+};
+
+} // namespace trading
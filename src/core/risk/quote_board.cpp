@@ -0,0 +1,68 @@
+#include "quote_board.hpp"
+
+#include <chrono>
+
+namespace trading {
+
+double Quote::get_reference_price() const {
+    if (bid_price > 0.0 && ask_price > 0.0) {
+        return (bid_price + ask_price) / 2.0;
+    }
+    return last_price;
+}
+
+QuoteBoard::QuoteBoard()
+    : slots_(std::make_unique<SymbolSlotTable<QuoteSlot, MAX_SYMBOLS>>()) {
+}
+
+void QuoteBoard::update(const MarketTick& tick) {
+    QuoteSlot* slot = slots_->find_or_insert(tick.instrument_symbol);
+    if (!slot) {
+        return; // Table full - the symbol is simply left without a price band reference
+    }
+
+    // Claim the slot by moving the sequence from even to odd; concurrent writers of one symbol spin briefly
+    uint64_t sequence = slot->sequence.load(std::memory_order_relaxed);
+    for (;;) {
+        if ((sequence & 1u) == 0 &&
+            slot->sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire)) {
+            break;
+        }
+        sequence = slot->sequence.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot->bid_price.store(tick.bid_price, std::memory_order_relaxed);
+    slot->ask_price.store(tick.ask_price, std::memory_order_relaxed);
+    slot->last_price.store(tick.last_price, std::memory_order_relaxed);
+    slot->timestamp_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+
+    slot->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool QuoteBoard::get_quote(std::string_view symbol, Quote& quote) const {
+    const QuoteSlot* slot = slots_->find(symbol);
+    if (!slot) {
+        return false;
+    }
+
+    for (;;) {
+        uint64_t before = slot->sequence.load(std::memory_order_acquire);
+        if (before & 1u) {
+            continue; // Write in progress
+        }
+
+        quote.bid_price = slot->bid_price.load(std::memory_order_relaxed);
+        quote.ask_price = slot->ask_price.load(std::memory_order_relaxed);
+        quote.last_price = slot->last_price.load(std::memory_order_relaxed);
+        quote.timestamp_ns = slot->timestamp_ns.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->sequence.load(std::memory_order_relaxed) == before) {
+            return before != 0; // Sequence 0 means the slot was inserted but never written
+        }
+    }
+}
+
+} // namespace trading
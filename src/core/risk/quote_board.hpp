@@ -0,0 +1,55 @@
+#pragma once
+
+#include "symbol_slot_table.hpp"
+#include "../models/market_tick.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace trading {
+
+/**
+ * Quote
+ * Latest top-of-book snapshot for one symbol
+ */
+struct Quote {
+    double bid_price = 0.0;
+    double ask_price = 0.0;
+    double last_price = 0.0;
+    int64_t timestamp_ns = 0;  // steady_clock time the quote was stored
+
+    // Mid when both sides are present, otherwise the last trade
+    double get_reference_price() const;
+};
+
+/**
+ * Quote Board
+ * Latest quote per symbol behind a per-slot seqlock: writers never block
+ * readers and a read is a handful of relaxed loads plus two sequence checks.
+ */
+class QuoteBoard {
+public:
+    static constexpr size_t MAX_SYMBOLS = 16384;
+
+    QuoteBoard();
+
+    void update(const MarketTick& tick);
+    bool get_quote(std::string_view symbol, Quote& quote) const;
+
+    size_t get_symbol_count() const { return slots_->size(); }
+
+private:
+    struct QuoteSlot {
+        std::atomic<uint64_t> sequence{0};  // Odd while a write is in progress
+        std::atomic<double> bid_price{0.0};
+        std::atomic<double> ask_price{0.0};
+        std::atomic<double> last_price{0.0};
+        std::atomic<int64_t> timestamp_ns{0};
+    };
+
+    std::unique_ptr<SymbolSlotTable<QuoteSlot, MAX_SYMBOLS>> slots_;
+};
+
+} // namespace trading
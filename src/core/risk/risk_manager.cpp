@@ -15,7 +15,10 @@ RiskManager::RiskManager(const RiskManagementConfig& config)
     , daily_realized_pnl_(0.0)
     , daily_unrealized_pnl_(0.0)
     , last_pnl_update_(std::chrono::system_clock::now())
-    , trading_enabled_(true) {
+    , circuit_breaker_(kill_switch_) {
+
+    circuit_breaker_.configure(config_);
+    order_throttle_.configure(config_);
 
     // Initialize default risk limits from config
     if (config_.enable_risk_checks) {
@@ -49,8 +52,10 @@ RiskManager::RiskManager(const RiskManagementConfig& config)
 }
 
 void RiskManager::update_config(const RiskManagementConfig& config) {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     config_ = config;
+    circuit_breaker_.configure(config_);
+    order_throttle_.configure(config_);
 
     // Rebuild risk limits
     risk_limits_.clear();
@@ -83,70 +88,54 @@ void RiskManager::update_config(const RiskManagementConfig& config) {
 }
 
 RiskManagementConfig RiskManager::get_config() const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     return config_;
 }
 
 bool RiskManager::validate_order(const OrderRequest& request) const {
-    if (!config_.enable_risk_checks) {
-        return true;
-    }
-
-    if (!trading_enabled_) {
-        last_rejection_reason_ = "Trading is disabled";
-        return false;
-    }
-
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::string rejection_reason;
+    return validate_order(request, rejection_reason);
+}
 
-    // Run all validation checks
-    std::string error = validate_order_basic(request);
-    if (!error.empty()) {
-        last_rejection_reason_ = error;
-        log_risk_violation(error, request);
-        return false;
-    }
+std::string RiskManager::get_rejection_reason(const OrderRequest& request) const {
+    std::string rejection_reason;
+    validate_order(request, rejection_reason);
+    return rejection_reason;
+}
 
-    error = validate_order_size(request);
-    if (!error.empty()) {
-        last_rejection_reason_ = error;
-        log_risk_violation(error, request);
+bool RiskManager::validate_order(const OrderRequest& request, std::string& rejection_reason) const {
+    // Kill switch applies even when risk checks are disabled
+    if (kill_switch_.is_engaged()) {
+        rejection_reason = "Kill switch engaged: " + kill_switch_.get_reason();
         return false;
     }
 
-    error = validate_position_limits(request);
-    if (!error.empty()) {
-        last_rejection_reason_ = error;
-        log_risk_violation(error, request);
-        return false;
-    }
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
 
-    error = validate_daily_loss_limit(request);
-    if (!error.empty()) {
-        last_rejection_reason_ = error;
-        log_risk_violation(error, request);
-        return false;
+    if (!config_.enable_risk_checks) {
+        rejection_reason.clear();
+        return true;
     }
 
-    error = validate_instrument(request);
-    if (!error.empty()) {
-        last_rejection_reason_ = error;
-        log_risk_violation(error, request);
+    // Run all validation checks
+    rejection_reason = validate_order_basic(request);
+    if (rejection_reason.empty()) rejection_reason = validate_price_band(request);
+    if (rejection_reason.empty()) rejection_reason = validate_order_notional(request);
+    if (rejection_reason.empty()) rejection_reason = validate_order_size(request);
+    if (rejection_reason.empty()) rejection_reason = validate_position_limits(request);
+    if (rejection_reason.empty()) rejection_reason = validate_daily_loss_limit(request);
+    if (rejection_reason.empty()) rejection_reason = validate_instrument(request);
+
+    if (!rejection_reason.empty()) {
+        log_risk_violation(rejection_reason, request);
         return false;
     }
 
-    last_rejection_reason_.clear();
     return true;
 }
 
-std::string RiskManager::get_rejection_reason(const OrderRequest& request) const {
-    // Call validate_order to populate the rejection reason
-    validate_order(request);
-    return last_rejection_reason_;
-}
-
 bool RiskManager::set_position_limit(const std::string& symbol, double max_quantity) {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
 
     if (max_quantity <= 0) {
         return false;
@@ -173,7 +162,7 @@ bool RiskManager::set_position_limit(const std::string& symbol, double max_quant
 }
 
 bool RiskManager::set_order_size_limit(const std::string& symbol, double max_quantity) {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
 
     if (max_quantity <= 0) {
         return false;
@@ -200,7 +189,7 @@ bool RiskManager::set_order_size_limit(const std::string& symbol, double max_qua
 }
 
 bool RiskManager::set_daily_loss_limit(double max_loss) {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
 
     if (max_loss <= 0) {
         return false;
@@ -222,32 +211,32 @@ bool RiskManager::set_daily_loss_limit(double max_loss) {
 }
 
 double RiskManager::get_position_limit(const std::string& symbol) const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     return get_effective_position_limit(symbol);
 }
 
 double RiskManager::get_order_size_limit(const std::string& symbol) const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     return get_effective_order_size_limit(symbol);
 }
 
 double RiskManager::get_daily_loss_limit() const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     return config_.max_daily_loss;
 }
 
 double RiskManager::get_current_exposure(const std::string& symbol) const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     return calculate_position_exposure(symbol);
 }
 
 double RiskManager::get_daily_pnl() const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     return daily_realized_pnl_ + daily_unrealized_pnl_;
 }
 
 double RiskManager::get_total_position_value() const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
 
     double total_value = 0.0;
     for (const auto& [symbol, position] : positions_) {
@@ -265,7 +254,7 @@ double RiskManager::get_total_position_value() const {
 void RiskManager::update_position(std::shared_ptr<Position> position) {
     if (!position) return;
 
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     const std::string& symbol = position->get_instrument_symbol();
 
     if (position->is_flat()) {
@@ -276,22 +265,34 @@ void RiskManager::update_position(std::shared_ptr<Position> position) {
 }
 
 void RiskManager::remove_position(const std::string& symbol) {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     positions_.erase(symbol);
 }
 
 std::shared_ptr<Position> RiskManager::get_position(const std::string& symbol) const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     auto it = positions_.find(symbol);
     return (it != positions_.end()) ? it->second : nullptr;
 }
 
+std::vector<std::shared_ptr<Position>> RiskManager::get_all_positions() const {
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
+    std::vector<std::shared_ptr<Position>> positions;
+    positions.reserve(positions_.size());
+
+    for (const auto& [symbol, position] : positions_) {
+        positions.push_back(position);
+    }
+
+    return positions;
+}
+
 // Order tracking
 
 void RiskManager::add_working_order(std::shared_ptr<Order> order) {
     if (!order) return;
 
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     const std::string& order_id = order->get_order_id();
     const std::string& symbol = order->get_instrument_symbol();
 
@@ -300,7 +301,7 @@ void RiskManager::add_working_order(std::shared_ptr<Order> order) {
 }
 
 void RiskManager::remove_working_order(const std::string& order_id) {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
 
     auto it = working_orders_.find(order_id);
     if (it != working_orders_.end()) {
@@ -318,7 +319,7 @@ void RiskManager::remove_working_order(const std::string& order_id) {
 }
 
 std::vector<std::shared_ptr<Order>> RiskManager::get_working_orders_for_symbol(const std::string& symbol) const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     std::vector<std::shared_ptr<Order>> orders;
 
     auto it = orders_by_symbol_.find(symbol);
@@ -334,6 +335,18 @@ std::vector<std::shared_ptr<Order>> RiskManager::get_working_orders_for_symbol(c
     return orders;
 }
 
+std::vector<std::shared_ptr<Order>> RiskManager::get_all_working_orders() const {
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
+    std::vector<std::shared_ptr<Order>> orders;
+    orders.reserve(working_orders_.size());
+
+    for (const auto& [order_id, order] : working_orders_) {
+        orders.push_back(order);
+    }
+
+    return orders;
+}
+
 // Risk metrics
 
 double RiskManager::calculate_position_exposure(const std::string& symbol) const {
@@ -360,14 +373,19 @@ double RiskManager::calculate_potential_position(const std::string& symbol, cons
 // Daily P&L tracking
 
 void RiskManager::update_daily_pnl(double realized_pnl, double unrealized_pnl) {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
-    daily_realized_pnl_ = realized_pnl;
-    daily_unrealized_pnl_ = unrealized_pnl;
-    last_pnl_update_ = std::chrono::system_clock::now();
+    {
+        std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
+        daily_realized_pnl_ = realized_pnl;
+        daily_unrealized_pnl_ = unrealized_pnl;
+        last_pnl_update_ = std::chrono::system_clock::now();
+    }
+
+    // Outside the lock: a trip runs kill switch callbacks
+    circuit_breaker_.record_daily_pnl(realized_pnl + unrealized_pnl);
 }
 
 void RiskManager::reset_daily_pnl() {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     daily_realized_pnl_ = 0.0;
     daily_unrealized_pnl_ = 0.0;
     last_pnl_update_ = std::chrono::system_clock::now();
@@ -393,7 +411,7 @@ void RiskManager::remove_risk_limit(const std::string& symbol, LimitType type) {
 }
 
 std::vector<RiskLimit> RiskManager::get_risk_limits(const std::string& symbol) const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
     std::vector<RiskLimit> limits;
 
     for (const auto& limit : risk_limits_) {
@@ -432,21 +450,23 @@ bool RiskManager::has_sufficient_buying_power(const OrderRequest& request) const
 // Risk status
 
 bool RiskManager::is_trading_enabled() const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
-    return trading_enabled_;
+    return !kill_switch_.is_engaged();
 }
 
 void RiskManager::set_trading_enabled(bool enabled) {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
-    trading_enabled_ = enabled;
+    if (enabled) {
+        kill_switch_.reset();
+    } else {
+        kill_switch_.engage("Trading disabled");
+    }
     log_risk_info("Trading " + std::string(enabled ? "enabled" : "disabled"));
 }
 
 std::string RiskManager::get_risk_status() const {
-    std::lock_guard<std::mutex> lock(risk_mutex_);
+    std::lock_guard<std::recursive_mutex> lock(risk_mutex_);
 
     std::stringstream ss;
-    ss << "Trading: " << (trading_enabled_ ? "Enabled" : "Disabled");
+    ss << "Trading: " << (kill_switch_.is_engaged() ? "Disabled (" + kill_switch_.get_reason() + ")" : "Enabled");
     ss << ", Daily P&L: " << get_daily_pnl();
     ss << ", Positions: " << positions_.size();
     ss << ", Working Orders: " << working_orders_.size();
@@ -455,6 +475,78 @@ std::string RiskManager::get_risk_status() const {
     return ss.str();
 }
 
+// Kill switch and circuit breaker
+
+void RiskManager::record_order_outcome(bool rejected) {
+    circuit_breaker_.record_order(rejected);
+}
+
+void RiskManager::on_market_data(const MarketTick& tick) {
+    quote_board_.update(tick);
+    circuit_breaker_.record_market_data();
+}
+
+void RiskManager::check_circuit_breakers() {
+    circuit_breaker_.check_feed_staleness();
+}
+
+// Order/cancel rate throttles
+
+bool RiskManager::acquire_order_throttle(const std::string& symbol, std::string& rejection_reason) {
+    ThrottleResult result = order_throttle_.try_acquire_order(symbol);
+    if (result == ThrottleResult::ALLOWED) {
+        return true;
+    }
+    rejection_reason = std::string("Throttled: ") + throttle_result_to_string(result);
+    return false;
+}
+
+bool RiskManager::acquire_cancel_throttle(const std::string& symbol, std::string& rejection_reason) {
+    ThrottleResult result = order_throttle_.try_acquire_cancel(symbol);
+    if (result == ThrottleResult::ALLOWED) {
+        return true;
+    }
+    rejection_reason = std::string("Throttled: ") + throttle_result_to_string(result);
+    return false;
+}
+
+bool RiskManager::acquire_notional_throttle(const OrderRequest& request, std::string& rejection_reason,
+                                            double* acquired_notional) {
+    const double notional = calculate_order_notional(request);
+    ThrottleResult result = order_throttle_.try_acquire_notional(notional);
+    if (result == ThrottleResult::ALLOWED) {
+        if (acquired_notional) {
+            *acquired_notional = notional;
+        }
+        return true;
+    }
+    rejection_reason = std::string("Throttled: ") + throttle_result_to_string(result);
+    return false;
+}
+
+void RiskManager::release_order_throttle(const std::string& symbol) {
+    order_throttle_.release_order(symbol);
+}
+
+void RiskManager::release_notional_throttle(double notional) {
+    order_throttle_.release_notional(notional);
+}
+
+// Latest quotes
+
+bool RiskManager::get_latest_quote(const std::string& symbol, Quote& quote) const {
+    return quote_board_.get_quote(symbol, quote);
+}
+
+double RiskManager::calculate_order_notional(const OrderRequest& request) const {
+    double price = request.price;
+    if (request.type == OrderType::MARKET || price <= 0.0) {
+        Quote quote;
+        price = quote_board_.get_quote(request.instrument_symbol, quote) ? quote.get_reference_price() : 0.0;
+    }
+    return std::abs(request.quantity) * price; // 0 when no price is known yet
+}
+
 // Helper methods
 
 double RiskManager::get_effective_position_limit(const std::string& symbol) const {
@@ -560,6 +652,42 @@ std::string RiskManager::validate_instrument(const OrderRequest& request) const
     return "";
 }
 
+std::string RiskManager::validate_price_band(const OrderRequest& request) const {
+    if (config_.price_band_percent <= 0.0 || request.type == OrderType::MARKET) {
+        return "";
+    }
+
+    Quote quote;
+    if (!quote_board_.get_quote(request.instrument_symbol, quote)) {
+        return ""; // No reference yet
+    }
+    double reference = quote.get_reference_price();
+    if (reference <= 0.0) {
+        return "";
+    }
+
+    double deviation_percent = std::abs(request.price - reference) / reference * 100.0;
+    if (deviation_percent > config_.price_band_percent) {
+        return "Limit price " + std::to_string(request.price) + " deviates " +
+               std::to_string(deviation_percent) + "% from reference " + std::to_string(reference) +
+               " (band " + std::to_string(config_.price_band_percent) + "%)";
+    }
+    return "";
+}
+
+std::string RiskManager::validate_order_notional(const OrderRequest& request) const {
+    if (config_.max_order_notional <= 0.0) {
+        return "";
+    }
+
+    double notional = calculate_order_notional(request);
+    if (notional > config_.max_order_notional) {
+        return "Order notional " + std::to_string(notional) +
+               " exceeds limit " + std::to_string(config_.max_order_notional);
+    }
+    return "";
+}
+
 // Position calculation helpers
 
 double RiskManager::calculate_current_position_quantity(const std::string& symbol) const {
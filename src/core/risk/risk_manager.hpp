@@ -4,6 +4,10 @@
 #include "../models/risk_limit.hpp"
 #include "../models/position.hpp"
 #include "../models/order.hpp"
+#include "../models/market_tick.hpp"
+#include "kill_switch.hpp"
+#include "order_throttle.hpp"
+#include "quote_board.hpp"
 #include "utils/config.hpp"
 
 #include <memory>
@@ -37,6 +41,9 @@ public:
     bool validate_order(const OrderRequest& request) const override;
     std::string get_rejection_reason(const OrderRequest& request) const override;
 
+    // Single-pass validation returning the rejection reason to the caller
+    bool validate_order(const OrderRequest& request, std::string& rejection_reason) const;
+
     bool set_position_limit(const std::string& symbol, double max_quantity) override;
     bool set_order_size_limit(const std::string& symbol, double max_quantity) override;
     bool set_daily_loss_limit(double max_loss) override;
@@ -53,11 +60,13 @@ public:
     void update_position(std::shared_ptr<Position> position);
     void remove_position(const std::string& symbol);
     std::shared_ptr<Position> get_position(const std::string& symbol) const;
+    std::vector<std::shared_ptr<Position>> get_all_positions() const;
 
     // Order tracking
     void add_working_order(std::shared_ptr<Order> order);
     void remove_working_order(const std::string& order_id);
     std::vector<std::shared_ptr<Order>> get_working_orders_for_symbol(const std::string& symbol) const;
+    std::vector<std::shared_ptr<Order>> get_all_working_orders() const;
 
     // Risk metrics
     double calculate_position_exposure(const std::string& symbol) const;
@@ -84,8 +93,30 @@ public:
     void set_trading_enabled(bool enabled);
     std::string get_risk_status() const;
 
+    // Kill switch and circuit breaker
+    KillSwitch& get_kill_switch() { return kill_switch_; }
+    const KillSwitch& get_kill_switch() const { return kill_switch_; }
+    void record_order_outcome(bool rejected);
+    void on_market_data(const MarketTick& tick);
+    void check_circuit_breakers();
+
+    // Order/cancel rate throttles - fill rejection_reason and return false when throttled
+    bool acquire_order_throttle(const std::string& symbol, std::string& rejection_reason);
+    bool acquire_cancel_throttle(const std::string& symbol, std::string& rejection_reason);
+    // acquired_notional receives the amount charged, to be handed back unchanged by release_notional_throttle
+    bool acquire_notional_throttle(const OrderRequest& request, std::string& rejection_reason,
+                                   double* acquired_notional = nullptr);
+    void release_order_throttle(const std::string& symbol);
+    void release_notional_throttle(double notional);
+    uint64_t get_throttled_count() const { return order_throttle_.get_throttled_count(); }
+
+    // Latest quotes (lock-free), used as the price band reference
+    bool get_latest_quote(const std::string& symbol, Quote& quote) const;
+    double calculate_order_notional(const OrderRequest& request) const;
+
 private:
-    mutable std::mutex risk_mutex_;
+    // Recursive: public queries used by the validators are also called while validate_order holds the lock
+    mutable std::recursive_mutex risk_mutex_;
     RiskManagementConfig config_;
 
     // Position tracking
@@ -104,8 +135,10 @@ private:
     std::chrono::system_clock::time_point last_pnl_update_;
 
     // Risk state
-    bool trading_enabled_;
-    mutable std::string last_rejection_reason_;
+    KillSwitch kill_switch_;
+    CircuitBreaker circuit_breaker_;
+    OrderThrottle order_throttle_;
+    QuoteBoard quote_board_;
 
     // Helper methods
     double get_effective_position_limit(const std::string& symbol) const;
@@ -117,6 +150,8 @@ private:
     std::string validate_position_limits(const OrderRequest& request) const;
     std::string validate_daily_loss_limit(const OrderRequest& request) const;
     std::string validate_instrument(const OrderRequest& request) const;
+    std::string validate_price_band(const OrderRequest& request) const;
+    std::string validate_order_notional(const OrderRequest& request) const;
 
     // Position calculation helpers
     double calculate_current_position_quantity(const std::string& symbol) const;
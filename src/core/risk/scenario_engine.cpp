@@ -0,0 +1,307 @@
+#include "scenario_engine.hpp"
+#include "../../utils/logging.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace trading {
+
+namespace {
+// Scenarios handed to a worker per grab; keeps contention on the shared index low
+constexpr size_t SCENARIO_CHUNK_SIZE = 16;
+}
+
+ScenarioEngine::ScenarioEngine(std::shared_ptr<const RiskManager> risk_manager, size_t thread_count)
+    : risk_manager_(std::move(risk_manager))
+    , thread_count_(thread_count) {
+    if (thread_count_ == 0) {
+        thread_count_ = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+}
+
+// Market context
+
+void ScenarioEngine::set_mark_price(const std::string& symbol, double price) {
+    std::lock_guard<std::mutex> lock(scenario_mutex_);
+    if (price > 0.0) {
+        mark_prices_[symbol] = price;
+    }
+}
+
+void ScenarioEngine::set_sector(const std::string& symbol, const std::string& sector) {
+    std::lock_guard<std::mutex> lock(scenario_mutex_);
+    sectors_[symbol] = sector;
+}
+
+// Scenario definition
+
+void ScenarioEngine::add_scenario(const StressScenario& scenario) {
+    std::lock_guard<std::mutex> lock(scenario_mutex_);
+    scenarios_.push_back(scenario);
+}
+
+void ScenarioEngine::add_market_shock_grid(double min_shock, double max_shock, size_t steps) {
+    if (steps == 0 || max_shock < min_shock) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(scenario_mutex_);
+    double step = (steps > 1) ? (max_shock - min_shock) / static_cast<double>(steps - 1) : 0.0;
+    for (size_t i = 0; i < steps; ++i) {
+        StressScenario scenario;
+        scenario.market_shock = min_shock + step * static_cast<double>(i);
+        scenario.name = "Market " + std::to_string(scenario.market_shock * 100.0) + "%";
+        scenarios_.push_back(std::move(scenario));
+    }
+}
+
+void ScenarioEngine::add_symbol_shocks(const std::vector<std::string>& symbols, double shock) {
+    std::lock_guard<std::mutex> lock(scenario_mutex_);
+    for (const auto& symbol : symbols) {
+        StressScenario scenario;
+        scenario.name = symbol + " " + std::to_string(shock * 100.0) + "%";
+        scenario.symbol_shocks[symbol] = shock;
+        scenarios_.push_back(std::move(scenario));
+    }
+}
+
+void ScenarioEngine::add_sector_shocks(const std::vector<std::string>& sectors, double shock) {
+    std::lock_guard<std::mutex> lock(scenario_mutex_);
+    for (const auto& sector : sectors) {
+        StressScenario scenario;
+        scenario.name = "Sector " + sector + " " + std::to_string(shock * 100.0) + "%";
+        scenario.sector_shocks[sector] = shock;
+        scenarios_.push_back(std::move(scenario));
+    }
+}
+
+void ScenarioEngine::add_historical_replay(const std::string& name,
+                                           const std::vector<std::unordered_map<std::string, double>>& daily_returns) {
+    std::lock_guard<std::mutex> lock(scenario_mutex_);
+    for (size_t day = 0; day < daily_returns.size(); ++day) {
+        StressScenario scenario;
+        scenario.name = name + " day " + std::to_string(day + 1);
+        scenario.symbol_shocks = daily_returns[day];
+        scenarios_.push_back(std::move(scenario));
+    }
+}
+
+void ScenarioEngine::clear_scenarios() {
+    std::lock_guard<std::mutex> lock(scenario_mutex_);
+    scenarios_.clear();
+}
+
+size_t ScenarioEngine::get_scenario_count() const {
+    std::lock_guard<std::mutex> lock(scenario_mutex_);
+    return scenarios_.size();
+}
+
+// Execution
+
+StressTestReport ScenarioEngine::run() const {
+    auto start_time = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(scenario_mutex_);
+
+    StressTestReport report;
+    if (!risk_manager_) {
+        return report;
+    }
+
+    BookSnapshot book = take_snapshot();
+    report.scenario_count = scenarios_.size();
+    report.symbol_count = book.symbols.size();
+    report.working_order_count = book.working_orders.size();
+    report.results.resize(scenarios_.size());
+
+    // Limit breaches that would follow from working orders filling are price independent
+    for (size_t i = 0; i < book.symbols.size(); ++i) {
+        double max_long = book.quantities[i] + book.working_buy_quantities[i];
+        double max_short = book.quantities[i] - book.working_sell_quantities[i];
+        if (std::max(std::abs(max_long), std::abs(max_short)) > book.position_limits[i]) {
+            report.position_limit_breaches.push_back(book.symbols[i]);
+        }
+    }
+
+    size_t worker_count = std::min(thread_count_,
+                                   (scenarios_.size() + SCENARIO_CHUNK_SIZE - 1) / SCENARIO_CHUNK_SIZE);
+    worker_count = std::max<size_t>(1, worker_count);
+    report.threads_used = worker_count;
+
+    std::atomic<size_t> next_scenario{0};
+    auto worker = [&]() {
+        Scratch scratch;
+        for (;;) {
+            size_t begin = next_scenario.fetch_add(SCENARIO_CHUNK_SIZE, std::memory_order_relaxed);
+            if (begin >= scenarios_.size()) {
+                break;
+            }
+            size_t end = std::min(begin + SCENARIO_CHUNK_SIZE, scenarios_.size());
+            for (size_t i = begin; i < end; ++i) {
+                report.results[i] = evaluate(scenarios_[i], book, scratch);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count - 1);
+    for (size_t i = 1; i < worker_count; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker(); // The calling thread takes a share of the work
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    // Aggregate
+    for (const auto& result : report.results) {
+        if (report.worst_scenario.empty() || result.total_pnl < report.worst_pnl) {
+            report.worst_pnl = result.total_pnl;
+            report.worst_scenario = result.scenario_name;
+        }
+        if (report.best_scenario.empty() || result.total_pnl > report.best_pnl) {
+            report.best_pnl = result.total_pnl;
+            report.best_scenario = result.scenario_name;
+        }
+        if (result.daily_loss_breached) {
+            ++report.daily_loss_breaches;
+        }
+    }
+
+    report.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time);
+
+    Logger::info("ScenarioEngine: " + std::to_string(report.scenario_count) + " scenarios over " +
+                 std::to_string(report.symbol_count) + " symbols in " +
+                 std::to_string(report.elapsed.count()) + "us, worst P&L " +
+                 std::to_string(report.worst_pnl) + " (" + report.worst_scenario + ")");
+    return report;
+}
+
+ScenarioEngine::BookSnapshot ScenarioEngine::take_snapshot() const {
+    BookSnapshot book;
+
+    auto index_of = [&book, this](const std::string& symbol) {
+        auto it = book.symbol_index.find(symbol);
+        if (it != book.symbol_index.end()) {
+            return it->second;
+        }
+
+        size_t index = book.symbols.size();
+        book.symbol_index.emplace(symbol, index);
+        book.symbols.push_back(symbol);
+
+        auto sector_it = sectors_.find(symbol);
+        book.sectors.push_back(sector_it != sectors_.end() ? sector_it->second : std::string());
+        book.quantities.push_back(0.0);
+        auto mark_it = mark_prices_.find(symbol);
+        book.marks.push_back(mark_it != mark_prices_.end() ? mark_it->second : 0.0);
+        book.position_limits.push_back(risk_manager_->get_position_limit(symbol));
+        book.working_buy_quantities.push_back(0.0);
+        book.working_sell_quantities.push_back(0.0);
+        return index;
+    };
+
+    for (const auto& position : risk_manager_->get_all_positions()) {
+        if (!position || position->is_flat()) {
+            continue;
+        }
+        size_t index = index_of(position->get_instrument_symbol());
+        book.quantities[index] = position->get_quantity();
+        if (book.marks[index] <= 0.0) {
+            book.marks[index] = position->get_average_price();
+        }
+    }
+
+    for (const auto& order : risk_manager_->get_all_working_orders()) {
+        if (!order || !order->is_working()) {
+            continue;
+        }
+        size_t index = index_of(order->get_instrument_symbol());
+        double remaining = order->get_remaining_quantity();
+        if (order->get_side() == OrderSide::BUY) {
+            book.working_buy_quantities[index] += remaining;
+        } else {
+            book.working_sell_quantities[index] += remaining;
+        }
+        if (book.marks[index] <= 0.0 && order->get_price() > 0.0) {
+            book.marks[index] = order->get_price();
+        }
+
+        BookSnapshot::WorkingOrder working;
+        working.symbol_index = index;
+        working.signed_quantity = (order->get_side() == OrderSide::BUY) ? remaining : -remaining;
+        working.fill_price = order->get_price(); // Market orders resolved against the mark below
+        book.working_orders.push_back(working);
+    }
+
+    for (auto& working : book.working_orders) {
+        if (working.fill_price <= 0.0) {
+            working.fill_price = book.marks[working.symbol_index];
+        }
+    }
+
+    for (size_t i = 0; i < book.sectors.size(); ++i) {
+        if (!book.sectors[i].empty()) {
+            book.sector_members[book.sectors[i]].push_back(i);
+        }
+    }
+
+    book.daily_pnl = risk_manager_->get_daily_pnl();
+    book.max_daily_loss = risk_manager_->get_daily_loss_limit();
+    return book;
+}
+
+ScenarioResult ScenarioEngine::evaluate(const StressScenario& scenario, const BookSnapshot& book, Scratch& scratch) {
+    ScenarioResult result;
+    result.scenario_name = scenario.name;
+
+    const size_t symbol_count = book.symbols.size();
+    scratch.shocks.assign(symbol_count, scenario.market_shock);
+    scratch.symbol_pnl.assign(symbol_count, 0.0);
+
+    for (const auto& [sector, shock] : scenario.sector_shocks) {
+        auto it = book.sector_members.find(sector);
+        if (it != book.sector_members.end()) {
+            for (size_t index : it->second) {
+                scratch.shocks[index] = shock;
+            }
+        }
+    }
+    for (const auto& [symbol, shock] : scenario.symbol_shocks) {
+        auto it = book.symbol_index.find(symbol);
+        if (it != book.symbol_index.end()) {
+            scratch.shocks[it->second] = shock;
+        }
+    }
+
+    for (size_t i = 0; i < symbol_count; ++i) {
+        double pnl = book.quantities[i] * book.marks[i] * scratch.shocks[i];
+        scratch.symbol_pnl[i] = pnl;
+        result.position_pnl += pnl;
+    }
+
+    // Working orders only count when filling them would make the scenario worse
+    for (const auto& working : book.working_orders) {
+        double shocked_price = book.marks[working.symbol_index] * (1.0 + scratch.shocks[working.symbol_index]);
+        double pnl = working.signed_quantity * (shocked_price - working.fill_price);
+        if (pnl < 0.0) {
+            scratch.symbol_pnl[working.symbol_index] += pnl;
+            result.working_order_pnl += pnl;
+        }
+    }
+
+    result.total_pnl = result.position_pnl + result.working_order_pnl;
+    for (size_t i = 0; i < symbol_count; ++i) {
+        if (result.worst_symbol.empty() || scratch.symbol_pnl[i] < result.worst_symbol_pnl) {
+            result.worst_symbol = book.symbols[i];
+            result.worst_symbol_pnl = scratch.symbol_pnl[i];
+        }
+    }
+    result.daily_loss_breached = (book.daily_pnl + result.total_pnl) < -book.max_daily_loss;
+
+    return result;
+}
+
+} // namespace trading
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "risk_manager.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace trading {
+
+/**
+ * Stress Scenario
+ * Relative price moves (0.05 = +5%) applied on top of current marks.
+ * Symbol shocks override sector shocks, which override the market shock.
+ */
+struct StressScenario {
+    std::string name;
+    double market_shock = 0.0;
+    std::unordered_map<std::string, double> sector_shocks;
+    std::unordered_map<std::string, double> symbol_shocks;
+};
+
+/**
+ * Scenario Result
+ * P&L of one scenario against the book snapshot taken at the start of a run
+ */
+struct ScenarioResult {
+    std::string scenario_name;
+    double position_pnl = 0.0;        // Mark-to-market change of open positions
+    double working_order_pnl = 0.0;   // Adverse fills of working orders (never positive)
+    double total_pnl = 0.0;
+    std::string worst_symbol;
+    double worst_symbol_pnl = 0.0;
+    bool daily_loss_breached = false;
+};
+
+/**
+ * Stress Test Report
+ * Aggregated outcome of a scenario run
+ */
+struct StressTestReport {
+    size_t scenario_count = 0;
+    size_t symbol_count = 0;
+    size_t working_order_count = 0;
+    size_t threads_used = 0;
+    std::chrono::microseconds elapsed{0};
+
+    double worst_pnl = 0.0;
+    std::string worst_scenario;
+    double best_pnl = 0.0;
+    std::string best_scenario;
+
+    size_t daily_loss_breaches = 0;
+    std::vector<std::string> position_limit_breaches; // Symbols whose working orders could breach limits
+
+    std::vector<ScenarioResult> results;
+};
+
+/**
+ * Scenario Engine
+ * Applies price shock scenarios to every position and working order known to
+ * the risk manager, spreading scenarios across worker threads
+ */
+class ScenarioEngine {
+public:
+    explicit ScenarioEngine(std::shared_ptr<const RiskManager> risk_manager, size_t thread_count = 0);
+
+    // Market context
+    void set_mark_price(const std::string& symbol, double price);
+    void set_sector(const std::string& symbol, const std::string& sector);
+
+    // Scenario definition
+    void add_scenario(const StressScenario& scenario);
+    void add_market_shock_grid(double min_shock, double max_shock, size_t steps);
+    void add_symbol_shocks(const std::vector<std::string>& symbols, double shock);
+    void add_sector_shocks(const std::vector<std::string>& sectors, double shock);
+    void add_historical_replay(const std::string& name,
+                               const std::vector<std::unordered_map<std::string, double>>& daily_returns);
+    void clear_scenarios();
+    size_t get_scenario_count() const;
+
+    // Execution
+    StressTestReport run() const;
+
+private:
+    // Flat per-symbol view of the book used by the workers
+    struct BookSnapshot {
+        std::vector<std::string> symbols;
+        std::unordered_map<std::string, size_t> symbol_index;
+        std::vector<std::string> sectors;
+        std::vector<double> quantities;
+        std::vector<double> marks;
+        std::vector<double> position_limits;
+        std::vector<double> working_buy_quantities;
+        std::vector<double> working_sell_quantities;
+
+        struct WorkingOrder {
+            size_t symbol_index;
+            double signed_quantity;
+            double fill_price;
+        };
+        std::vector<WorkingOrder> working_orders;
+        std::unordered_map<std::string, std::vector<size_t>> sector_members;
+
+        double daily_pnl = 0.0;
+        double max_daily_loss = 0.0;
+    };
+
+    std::shared_ptr<const RiskManager> risk_manager_;
+    size_t thread_count_;
+
+    mutable std::mutex scenario_mutex_;
+    std::vector<StressScenario> scenarios_;
+    std::unordered_map<std::string, double> mark_prices_;
+    std::unordered_map<std::string, std::string> sectors_;
+
+    // Per-worker buffers reused across scenarios
+    struct Scratch {
+        std::vector<double> shocks;
+        std::vector<double> symbol_pnl;
+    };
+
+    BookSnapshot take_snapshot() const;
+    static ScenarioResult evaluate(const StressScenario& scenario, const BookSnapshot& book, Scratch& scratch);
+};
+
+} // namespace trading
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "contracts/trading_engine_api.hpp"
+#include "risk_manager.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace trading {
+
+/**
+ * Risk Check Result
+ * Allocation-free outcome of a compile-time risk check
+ */
+enum class RiskCheckResult : std::uint8_t {
+    PASSED = 0,
+    INVALID_ORDER,
+    ORDER_SIZE_EXCEEDED,
+    POSITION_LIMIT_EXCEEDED,
+    DAILY_LOSS_EXCEEDED
+};
+
+// Rejection text is only materialised when a caller asks for it
+constexpr const char* risk_check_result_to_string(RiskCheckResult result) noexcept {
+    switch (result) {
+        case RiskCheckResult::PASSED:                  return "";
+        case RiskCheckResult::INVALID_ORDER:           return "Invalid order request";
+        case RiskCheckResult::ORDER_SIZE_EXCEEDED:     return "Order size limit exceeded";
+        case RiskCheckResult::POSITION_LIMIT_EXCEEDED: return "Position limit exceeded";
+        case RiskCheckResult::DAILY_LOSS_EXCEEDED:     return "Daily loss limit would be exceeded";
+    }
+    return "Unknown risk check result";
+}
+
+/**
+ * Risk Check Policy
+ * A stateless type exposing a static check() that can be inlined into a chain
+ */
+template<typename T>
+concept RiskCheckPolicy = requires(const OrderRequest& request, const RiskManager& manager) {
+    { T::check(request, manager) } -> std::same_as<RiskCheckResult>;
+};
+
+/**
+ * Built-in Risk Check Policies
+ * Mirror the dynamic validators so both paths reject the same orders
+ */
+
+struct BasicOrderCheck {
+    static RiskCheckResult check(const OrderRequest& request, const RiskManager& /*manager*/) {
+        return request.is_valid() ? RiskCheckResult::PASSED : RiskCheckResult::INVALID_ORDER;
+    }
+};
+
+struct OrderSizeCheck {
+    static RiskCheckResult check(const OrderRequest& request, const RiskManager& manager) {
+        return manager.is_order_size_valid(request.instrument_symbol, request.quantity)
+            ? RiskCheckResult::PASSED
+            : RiskCheckResult::ORDER_SIZE_EXCEEDED;
+    }
+};
+
+struct PositionLimitCheck {
+    static RiskCheckResult check(const OrderRequest& request, const RiskManager& manager) {
+        double potential_position = manager.calculate_potential_position(request.instrument_symbol, request);
+        return manager.is_position_within_limits(request.instrument_symbol, potential_position)
+            ? RiskCheckResult::PASSED
+            : RiskCheckResult::POSITION_LIMIT_EXCEEDED;
+    }
+};
+
+struct DailyLossCheck {
+    static RiskCheckResult check(const OrderRequest& request, const RiskManager& manager) {
+        double estimated_risk = request.quantity * 0.05; // Same 5% estimate as DailyLossValidator
+        return manager.is_daily_loss_within_limit(estimated_risk)
+            ? RiskCheckResult::PASSED
+            : RiskCheckResult::DAILY_LOSS_EXCEEDED;
+    }
+};
+
+/**
+ * Static Risk Validator
+ * Chain of risk check policies fixed at compile time. Checks run in declaration
+ * order, stop at the first failure and keep no mutable state, so one instance
+ * can be shared freely between threads.
+ */
+template<RiskCheckPolicy... Checks>
+class StaticRiskValidator {
+public:
+    static RiskCheckResult validate(const OrderRequest& request, const RiskManager& manager) {
+        RiskCheckResult result = RiskCheckResult::PASSED;
+        // Short-circuiting && fold gives early exit without a loop or virtual dispatch
+        static_cast<void>((((result = Checks::check(request, manager)) == RiskCheckResult::PASSED) && ...));
+        return result;
+    }
+
+    static constexpr std::size_t check_count() noexcept {
+        return sizeof...(Checks);
+    }
+};
+
+// Same checks, in the same order, as the default CompositeRiskValidator setup
+using DefaultStaticRiskValidator = StaticRiskValidator<OrderSizeCheck, PositionLimitCheck, DailyLossCheck>;
+
+} // namespace trading
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+
+namespace trading {
+
+/**
+ * Symbol Slot Table
+ * Fixed-capacity, insert-only open-addressing table keyed by symbol. Each entry
+ * stores its symbol, so symbols whose hashes collide get separate slots.
+ * Lookups and inserts are lock-free; slots are never removed, so a returned
+ * pointer stays valid for the table's lifetime. Returns nullptr when full or
+ * when the symbol is longer than MAX_SYMBOL_LENGTH.
+ */
+template<typename Slot, size_t Capacity, typename Hash = std::hash<std::string_view>>
+class SymbolSlotTable {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    static constexpr size_t MAX_SYMBOL_LENGTH = 31;
+
+    SymbolSlotTable() = default;
+
+    // Non-copyable (slots hold atomics)
+    SymbolSlotTable(const SymbolSlotTable&) = delete;
+    SymbolSlotTable& operator=(const SymbolSlotTable&) = delete;
+
+    Slot* find_or_insert(std::string_view symbol) {
+        if (symbol.size() > MAX_SYMBOL_LENGTH) {
+            return nullptr;
+        }
+        const uint64_t hash = static_cast<uint64_t>(Hash{}(symbol));
+        size_t index = static_cast<size_t>(hash) & (Capacity - 1);
+
+        for (size_t probe = 0; probe < Capacity; ++probe) {
+            Entry& entry = entries_[index];
+            uint8_t state = entry.state.load(std::memory_order_acquire);
+            if (state == EMPTY &&
+                entry.state.compare_exchange_strong(state, CLAIMED, std::memory_order_acq_rel)) {
+                entry.hash = hash;
+                entry.length = static_cast<uint8_t>(symbol.size());
+                std::memcpy(entry.symbol.data(), symbol.data(), symbol.size());
+                entry.state.store(READY, std::memory_order_release);
+                size_.fetch_add(1, std::memory_order_relaxed);
+                return &entry.slot;
+            }
+            if (wait_until_ready(entry) && entry.matches(hash, symbol)) {
+                return &entry.slot; // Includes losing the race to a thread inserting the same symbol
+            }
+            index = (index + 1) & (Capacity - 1);
+        }
+        return nullptr;
+    }
+
+    const Slot* find(std::string_view symbol) const {
+        if (symbol.size() > MAX_SYMBOL_LENGTH) {
+            return nullptr;
+        }
+        const uint64_t hash = static_cast<uint64_t>(Hash{}(symbol));
+        size_t index = static_cast<size_t>(hash) & (Capacity - 1);
+
+        for (size_t probe = 0; probe < Capacity; ++probe) {
+            const Entry& entry = entries_[index];
+            if (!wait_until_ready(entry)) {
+                return nullptr;
+            }
+            if (entry.matches(hash, symbol)) {
+                return &entry.slot;
+            }
+            index = (index + 1) & (Capacity - 1);
+        }
+        return nullptr;
+    }
+
+    size_t size() const { return size_.load(std::memory_order_relaxed); }
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    // EMPTY -> CLAIMED (inserter copies the symbol) -> READY; never goes back
+    static constexpr uint8_t EMPTY = 0;
+    static constexpr uint8_t CLAIMED = 1;
+    static constexpr uint8_t READY = 2;
+
+    struct Entry {
+        std::atomic<uint8_t> state{EMPTY};
+        uint8_t length = 0;
+        uint64_t hash = 0;
+        std::array<char, MAX_SYMBOL_LENGTH> symbol{};
+        Slot slot{};
+
+        bool matches(uint64_t other_hash, std::string_view other) const {
+            return hash == other_hash && length == other.size() &&
+                   std::memcmp(symbol.data(), other.data(), other.size()) == 0;
+        }
+    };
+
+    // False for an empty entry; a claimed one is only a symbol copy away from ready
+    static bool wait_until_ready(const Entry& entry) {
+        uint8_t state = entry.state.load(std::memory_order_acquire);
+        while (state == CLAIMED) {
+            state = entry.state.load(std::memory_order_acquire);
+        }
+        return state == READY;
+    }
+
+    std::array<Entry, Capacity> entries_{};
+    std::atomic<size_t> size_{0};
+};
+
+} // namespace trading
@@ -0,0 +1,269 @@
+#include "async_persistence_writer.hpp"
+#include "../../core/models/order.hpp"
+#include "../../core/models/trade.hpp"
+#include "../../core/models/position.hpp"
+#include "../../utils/logging.hpp"
+#include "../../utils/exceptions.hpp"
+
+#include <type_traits>
+
+namespace trading {
+
+AsyncPersistenceWriter::AsyncPersistenceWriter(std::shared_ptr<SQLiteService> persistence_service,
+                                               const Config& config)
+    : AsyncPersistenceWriter(
+          [service = std::move(persistence_service)](const PersistenceBatch& batch) {
+              return service && service->save_batch(batch);
+          },
+          config) {
+}
+
+AsyncPersistenceWriter::AsyncPersistenceWriter(BatchSink sink, const Config& config)
+    : sink_(std::move(sink))
+    , config_(config)
+    , queue_(config.queue_capacity)
+    , running_(false)
+    , stop_requested_(false)
+    , flush_requested_(false)
+    , enqueued_sequence_(0)
+    , durable_sequence_(0)
+    , durability_stalled_(false)
+    , space_waiters_(0)
+    , records_written_(0)
+    , batches_written_(0)
+    , records_failed_(0)
+    , queue_full_waits_(0)
+    , records_rejected_(0) {
+
+    if (!sink_) {
+        throw TradingException("Persistence sink is required");
+    }
+    if (config_.batch_size == 0) {
+        config_.batch_size = 1;
+    }
+}
+
+AsyncPersistenceWriter::~AsyncPersistenceWriter() {
+    stop();
+}
+
+bool AsyncPersistenceWriter::start() {
+    if (running_.exchange(true)) {
+        return true;
+    }
+
+    stop_requested_.store(false);
+    writer_thread_ = std::thread(&AsyncPersistenceWriter::writer_loop, this);
+
+    Logger::info("AsyncPersistenceWriter: Started (batch " + std::to_string(config_.batch_size) +
+                 " rows / " + std::to_string(config_.flush_interval.count()) + "ms)");
+    return true;
+}
+
+void AsyncPersistenceWriter::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        stop_requested_.store(true);
+    }
+    writer_cv_.notify_all();
+    space_cv_.notify_all();
+
+    if (writer_thread_.joinable()) {
+        writer_thread_.join();
+    }
+
+    Logger::info("AsyncPersistenceWriter: Stopped after " + std::to_string(records_written_.load()) +
+                 " rows in " + std::to_string(batches_written_.load()) + " batches");
+}
+
+uint64_t AsyncPersistenceWriter::enqueue_order(const Order& order) {
+    return enqueue(Record(SQLiteService::order_to_row(order)));
+}
+
+uint64_t AsyncPersistenceWriter::enqueue_trade(const Trade& trade) {
+    return enqueue(Record(SQLiteService::trade_to_row(trade)));
+}
+
+uint64_t AsyncPersistenceWriter::enqueue_position(const Position& position) {
+    return enqueue(Record(SQLiteService::position_to_row(position)));
+}
+
+uint64_t AsyncPersistenceWriter::enqueue(Record&& record) {
+    if (!running_.load()) {
+        return 0;
+    }
+
+    uint64_t position = 0;
+    if (!queue_.try_push(std::move(record), position)) {
+        // Sleep until the writer drains some rows rather than spinning; callers may hold their own locks
+        queue_full_waits_.fetch_add(1, std::memory_order_relaxed);
+        const auto deadline = std::chrono::steady_clock::now() + config_.enqueue_timeout;
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        space_waiters_.fetch_add(1);
+        writer_cv_.notify_one();
+        bool pushed = false;
+        space_cv_.wait_until(lock, deadline, [&] {
+            pushed = queue_.try_push(std::move(record), position);
+            return pushed || !running_.load();
+        });
+        space_waiters_.fetch_sub(1);
+        if (!pushed) {
+            if (running_.load()) {
+                records_rejected_.fetch_add(1, std::memory_order_relaxed);
+            }
+            return 0;
+        }
+    }
+
+    // Queue positions are handed out in dequeue order, so position + 1 is this record's sequence
+    uint64_t sequence = position + 1;
+    uint64_t current = enqueued_sequence_.load(std::memory_order_relaxed);
+    while (current < sequence &&
+           !enqueued_sequence_.compare_exchange_weak(current, sequence, std::memory_order_release)) {
+    }
+
+    if (sequence % config_.batch_size == 0) {
+        writer_cv_.notify_one(); // A full batch is likely waiting
+    }
+    return sequence;
+}
+
+bool AsyncPersistenceWriter::wait_for_durable(uint64_t sequence, std::chrono::milliseconds timeout) {
+    if (get_durable_sequence() >= sequence) {
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    flush_requested_.store(true);
+    writer_cv_.notify_one();
+    return durable_cv_.wait_for(lock, timeout, [this, sequence] {
+        return get_durable_sequence() >= sequence;
+    });
+}
+
+bool AsyncPersistenceWriter::flush(std::chrono::milliseconds timeout) {
+    return wait_for_durable(get_enqueued_sequence(), timeout);
+}
+
+AsyncPersistenceWriter::Statistics AsyncPersistenceWriter::get_statistics() const {
+    Statistics stats;
+    stats.records_written = records_written_.load(std::memory_order_relaxed);
+    stats.batches_written = batches_written_.load(std::memory_order_relaxed);
+    stats.records_failed = records_failed_.load(std::memory_order_relaxed);
+    stats.queue_full_waits = queue_full_waits_.load(std::memory_order_relaxed);
+    stats.records_rejected = records_rejected_.load(std::memory_order_relaxed);
+    stats.durability_stalled = is_durability_stalled();
+    return stats;
+}
+
+// Writer thread
+
+void AsyncPersistenceWriter::writer_loop() {
+    PersistenceBatch batch;
+    batch.orders.reserve(config_.batch_size);
+    batch.trades.reserve(config_.batch_size);
+    batch.positions.reserve(config_.batch_size);
+    auto batch_started = std::chrono::steady_clock::now();
+
+    for (;;) {
+        bool was_empty = batch.empty();
+        size_t drained = drain(batch);
+        auto now = std::chrono::steady_clock::now();
+        if (was_empty && drained > 0) {
+            batch_started = now;
+        }
+
+        bool stopping = stop_requested_.load();
+        if (!batch.empty()) {
+            bool due = batch.size() >= config_.batch_size ||
+                       now - batch_started >= config_.flush_interval ||
+                       flush_requested_.load() || stopping;
+            if (due) {
+                commit(batch);
+                continue;
+            }
+        }
+
+        if (stopping && queue_.empty()) {
+            break;
+        }
+        if (drained > 0) {
+            continue;
+        }
+
+        // Nothing ready: sleep until a batch fills, a flush is requested or the interval elapses
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        writer_cv_.wait_for(lock, config_.flush_interval, [this] {
+            return stop_requested_.load() || flush_requested_.load() || queue_.size() >= config_.batch_size;
+        });
+    }
+}
+
+size_t AsyncPersistenceWriter::drain(PersistenceBatch& batch) {
+    size_t drained = 0;
+    Record record;
+    while (batch.size() < config_.batch_size && queue_.try_pop(record)) {
+        std::visit([&batch](auto&& row) {
+            using RowType = std::decay_t<decltype(row)>;
+            if constexpr (std::is_same_v<RowType, OrderRow>) {
+                batch.orders.push_back(std::move(row));
+            } else if constexpr (std::is_same_v<RowType, TradeRow>) {
+                batch.trades.push_back(std::move(row));
+            } else if constexpr (std::is_same_v<RowType, PositionRow>) {
+                batch.positions.push_back(std::move(row));
+            }
+        }, std::move(record));
+        ++drained;
+    }
+    if (drained > 0 && space_waiters_.load() > 0) {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        space_cv_.notify_all();
+    }
+    return drained;
+}
+
+void AsyncPersistenceWriter::commit(PersistenceBatch& batch) {
+    const size_t rows = batch.size();
+
+    bool committed = false;
+    for (int attempt = 1; attempt <= config_.max_commit_attempts && !committed; ++attempt) {
+        try {
+            committed = sink_(batch);
+        } catch (const std::exception& e) {
+            Logger::error("AsyncPersistenceWriter: Batch commit threw: " + std::string(e.what()));
+        }
+        if (!committed && attempt < config_.max_commit_attempts && !stop_requested_.load()) {
+            std::this_thread::sleep_for(config_.flush_interval);
+        }
+    }
+
+    if (committed) {
+        records_written_.fetch_add(rows, std::memory_order_relaxed);
+        batches_written_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        // The watermark stops advancing so waiters see the gap instead of a false durability claim
+        records_failed_.fetch_add(rows, std::memory_order_relaxed);
+        if (!durability_stalled_.exchange(true, std::memory_order_acq_rel)) {
+            Logger::critical("AsyncPersistenceWriter: Dropped batch of " + std::to_string(rows) +
+                             " rows; durable watermark stalled at " + std::to_string(get_durable_sequence()));
+        }
+    }
+    batch.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        if (committed && !durability_stalled_) {
+            durable_sequence_.fetch_add(rows, std::memory_order_release);
+        }
+        if (queue_.empty()) {
+            flush_requested_.store(false);
+        }
+    }
+    durable_cv_.notify_all();
+}
+
+} // namespace trading
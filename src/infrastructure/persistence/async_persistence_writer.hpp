@@ -0,0 +1,120 @@
+#pragma once
+
+#include "sqlite_service.hpp"
+#include "core/messaging/lock_free_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <variant>
+
+namespace trading {
+
+class Order;
+class Trade;
+class Position;
+
+/**
+ * Async Persistence Writer
+ * Write-behind persistence: callers snapshot rows into a lock-free queue and a
+ * dedicated thread commits them in batches of up to batch_size rows or every
+ * flush_interval, whichever comes first. Every accepted row gets a sequence
+ * number; the durable watermark is the highest sequence whose row and all
+ * predecessors have been committed.
+ */
+class AsyncPersistenceWriter {
+public:
+    using BatchSink = std::function<bool(const PersistenceBatch&)>;
+
+    struct Config {
+        size_t batch_size = 256;
+        std::chrono::milliseconds flush_interval{5};
+        size_t queue_capacity = 65536;
+        int max_commit_attempts = 3;
+        std::chrono::milliseconds enqueue_timeout{50};   // Longest wait for queue space before rejecting a row
+    };
+
+    struct Statistics {
+        uint64_t records_written = 0;
+        uint64_t batches_written = 0;
+        uint64_t records_failed = 0;
+        uint64_t queue_full_waits = 0;
+        uint64_t records_rejected = 0;      // Queue still full after enqueue_timeout
+        bool durability_stalled = false;
+    };
+
+    AsyncPersistenceWriter(std::shared_ptr<SQLiteService> persistence_service, const Config& config);
+    AsyncPersistenceWriter(BatchSink sink, const Config& config);
+    ~AsyncPersistenceWriter();
+
+    // Non-copyable
+    AsyncPersistenceWriter(const AsyncPersistenceWriter&) = delete;
+    AsyncPersistenceWriter& operator=(const AsyncPersistenceWriter&) = delete;
+
+    // Lifecycle - stop() drains and commits everything already enqueued
+    bool start();
+    void stop();
+    bool is_running() const { return running_.load(); }
+
+    // Enqueue a snapshot of the object; returns its sequence (>= 1), or 0 when not running or the
+    // queue stayed full for enqueue_timeout. A rejected row is the caller's to write synchronously.
+    uint64_t enqueue_order(const Order& order);
+    uint64_t enqueue_trade(const Trade& trade);
+    uint64_t enqueue_position(const Position& position);
+
+    // Durability watermark
+    uint64_t get_enqueued_sequence() const { return enqueued_sequence_.load(std::memory_order_acquire); }
+    uint64_t get_durable_sequence() const { return durable_sequence_.load(std::memory_order_acquire); }
+    bool wait_for_durable(uint64_t sequence, std::chrono::milliseconds timeout);
+    bool flush(std::chrono::milliseconds timeout = std::chrono::milliseconds(5000));
+
+    // Set once a batch is dropped after max_commit_attempts. The dropped rows leave a gap, so the
+    // watermark never advances again; the rows must be rebuilt (e.g. from the event journal) and
+    // the writer restarted.
+    bool is_durability_stalled() const { return durability_stalled_.load(std::memory_order_acquire); }
+
+    Statistics get_statistics() const;
+
+private:
+    using Record = std::variant<std::monostate, OrderRow, TradeRow, PositionRow>;
+
+    BatchSink sink_;
+    Config config_;
+    LockFreeQueue<Record> queue_;
+
+    std::atomic<bool> running_;
+    std::atomic<bool> stop_requested_;
+    std::atomic<bool> flush_requested_;
+    std::thread writer_thread_;
+
+    // Sequences: enqueued counts accepted records, durable the committed prefix
+    std::atomic<uint64_t> enqueued_sequence_;
+    std::atomic<uint64_t> durable_sequence_;
+    std::atomic<bool> durability_stalled_;
+
+    // Writer wake-up, durability and queue-space notification
+    std::mutex wait_mutex_;
+    std::condition_variable writer_cv_;
+    std::condition_variable durable_cv_;
+    std::condition_variable space_cv_;
+    std::atomic<uint32_t> space_waiters_;
+
+    // Statistics
+    std::atomic<uint64_t> records_written_;
+    std::atomic<uint64_t> batches_written_;
+    std::atomic<uint64_t> records_failed_;
+    std::atomic<uint64_t> queue_full_waits_;
+    std::atomic<uint64_t> records_rejected_;
+
+    uint64_t enqueue(Record&& record);
+    void writer_loop();
+    size_t drain(PersistenceBatch& batch);
+    void commit(PersistenceBatch& batch);
+};
+
+} // namespace trading
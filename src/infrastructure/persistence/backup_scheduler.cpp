@@ -0,0 +1,193 @@
+#include "backup_scheduler.hpp"
+#include "../../utils/logging.hpp"
+#include "../../utils/exceptions.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+
+namespace trading {
+
+namespace {
+
+constexpr const char* BACKUP_PREFIX = "backup-";
+constexpr const char* BACKUP_SUFFIX = ".db";
+
+} // namespace
+
+BackupScheduler::Config BackupScheduler::from_config(const PersistenceConfig& config) {
+    Config scheduler_config;
+    scheduler_config.directory = config.backup_path;
+    scheduler_config.interval = std::chrono::hours(config.backup_interval_hours);
+    scheduler_config.max_files = static_cast<size_t>(config.max_backup_files);
+    return scheduler_config;
+}
+
+BackupScheduler::BackupScheduler(std::shared_ptr<SQLiteService> persistence_service, const Config& config)
+    : BackupScheduler(
+          [this, service = std::move(persistence_service)](const std::string& filepath) {
+              BackupOptions options;
+              options.cancel_requested = &stop_requested_;
+              return service && service->backup_online(filepath, options);
+          },
+          config) {
+}
+
+BackupScheduler::BackupScheduler(BackupFn backup, const Config& config)
+    : backup_(std::move(backup))
+    , config_(config)
+    , running_(false)
+    , stop_requested_(false) {
+
+    if (!backup_) {
+        throw TradingException("Backup scheduler requires a backup function");
+    }
+    if (config_.max_files == 0) {
+        config_.max_files = 1;
+    }
+    if (config_.interval.count() <= 0) {
+        config_.interval = std::chrono::seconds(1);
+    }
+    config_.retry_interval = std::clamp(config_.retry_interval, std::chrono::seconds(1), config_.interval);
+}
+
+BackupScheduler::~BackupScheduler() {
+    stop();
+}
+
+bool BackupScheduler::start() {
+    if (running_.exchange(true)) {
+        return true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_requested_.store(false);
+    }
+    scheduler_thread_ = std::thread(&BackupScheduler::scheduler_loop, this);
+    Logger::info("BackupScheduler: Started - every " + std::to_string(config_.interval.count()) + "s into " +
+                 config_.directory + ", keeping " + std::to_string(config_.max_files));
+    return true;
+}
+
+void BackupScheduler::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_requested_.store(true);
+    }
+    cv_.notify_all();
+    if (scheduler_thread_.joinable()) {
+        scheduler_thread_.join();
+    }
+    Logger::info("BackupScheduler: Stopped");
+}
+
+std::string BackupScheduler::run_once() {
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+    std::string path = next_backup_path();
+    bool success = false;
+    try {
+        success = backup_(path);
+    } catch (const std::exception& e) {
+        Logger::error("BackupScheduler: Backup threw: " + std::string(e.what()));
+    }
+
+    if (!success) {
+        ++statistics_.backups_failed;
+        return "";
+    }
+
+    ++statistics_.backups_completed;
+    statistics_.last_backup_path = path;
+    rotate();
+    return path;
+}
+
+std::vector<std::string> BackupScheduler::list_backups() const {
+    std::vector<std::string> paths;
+    std::error_code ec;
+    if (!std::filesystem::is_directory(config_.directory, ec)) {
+        return paths;
+    }
+    for (const auto& entry : std::filesystem::directory_iterator(config_.directory, ec)) {
+        std::string name = entry.path().filename().string();
+        if (name.rfind(BACKUP_PREFIX, 0) == 0 && entry.path().extension() == BACKUP_SUFFIX) {
+            paths.push_back(entry.path().string());
+        }
+    }
+    // UTC timestamps in the names sort lexically
+    std::sort(paths.rbegin(), paths.rend());
+    return paths;
+}
+
+BackupScheduler::Statistics BackupScheduler::get_statistics() const {
+    std::lock_guard<std::mutex> lock(run_mutex_);
+    return statistics_;
+}
+
+void BackupScheduler::scheduler_loop() {
+    auto wait = time_until_due();
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_requested_.load()) {
+        if (cv_.wait_for(lock, wait, [this] { return stop_requested_.load(); })) {
+            break;
+        }
+
+        lock.unlock();
+        bool success = !run_once().empty();
+        lock.lock();
+        wait = success ? config_.interval : config_.retry_interval;
+    }
+}
+
+std::chrono::seconds BackupScheduler::time_until_due() const {
+    auto backups = list_backups();
+    if (backups.empty()) {
+        return std::chrono::seconds(0);
+    }
+
+    std::error_code ec;
+    auto written = std::filesystem::last_write_time(backups.front(), ec);
+    if (ec) {
+        return std::chrono::seconds(0);
+    }
+    auto age = std::chrono::duration_cast<std::chrono::seconds>(std::filesystem::file_time_type::clock::now() - written);
+    return std::clamp(config_.interval - age, std::chrono::seconds(0), config_.interval);
+}
+
+std::string BackupScheduler::next_backup_path() const {
+    auto now = std::chrono::system_clock::now();
+    std::time_t seconds = std::chrono::system_clock::to_time_t(now);
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+
+    std::tm utc{};
+#ifdef _WIN32
+    gmtime_s(&utc, &seconds);
+#else
+    gmtime_r(&seconds, &utc);
+#endif
+    char stamp[32];
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", &utc);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s%s-%03d%s", BACKUP_PREFIX, stamp, static_cast<int>(millis), BACKUP_SUFFIX);
+    return (std::filesystem::path(config_.directory) / name).string();
+}
+
+void BackupScheduler::rotate() {
+    auto backups = list_backups();
+    std::error_code ec;
+    for (size_t i = config_.max_files; i < backups.size(); ++i) {
+        if (std::filesystem::remove(backups[i], ec)) {
+            Logger::info("BackupScheduler: Removed old backup " + backups[i]);
+        }
+    }
+}
+
+} // namespace trading
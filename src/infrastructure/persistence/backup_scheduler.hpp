@@ -0,0 +1,85 @@
+#pragma once
+
+#include "sqlite_service.hpp"
+#include "utils/config.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace trading {
+
+/**
+ * Backup Scheduler
+ * Background thread that takes an online backup every interval into timestamped
+ * files and keeps the newest max_files. The first backup is due one interval
+ * after the newest existing file, so restarts do not reset the cadence.
+ */
+class BackupScheduler {
+public:
+    // Writes a complete backup to the given path
+    using BackupFn = std::function<bool(const std::string& filepath)>;
+
+    struct Config {
+        std::string directory = "./data/backups/";
+        std::chrono::seconds interval{24 * 3600};
+        std::chrono::seconds retry_interval{300};   // After a failed backup; capped at interval
+        size_t max_files = 7;
+    };
+
+    struct Statistics {
+        uint64_t backups_completed = 0;
+        uint64_t backups_failed = 0;
+        std::string last_backup_path;
+    };
+
+    static Config from_config(const PersistenceConfig& config);
+
+    BackupScheduler(std::shared_ptr<SQLiteService> persistence_service, const Config& config);
+    BackupScheduler(BackupFn backup, const Config& config);
+    ~BackupScheduler();
+
+    // Non-copyable
+    BackupScheduler(const BackupScheduler&) = delete;
+    BackupScheduler& operator=(const BackupScheduler&) = delete;
+
+    // Lifecycle - stop() cancels a backup in progress
+    bool start();
+    void stop();
+    bool is_running() const { return running_.load(); }
+
+    // Take a backup now and rotate; returns the new file path, or empty on failure
+    std::string run_once();
+
+    // Backup file paths, newest first
+    std::vector<std::string> list_backups() const;
+
+    Statistics get_statistics() const;
+
+private:
+    BackupFn backup_;
+    Config config_;
+
+    std::atomic<bool> running_;
+    std::atomic<bool> stop_requested_;   // Also cancels the backup in progress
+    std::mutex mutex_;                   // Pairs with cv_ for stop_requested_
+    std::condition_variable cv_;
+    std::thread scheduler_thread_;
+
+    mutable std::mutex run_mutex_;       // Serialises backups and guards statistics_
+    Statistics statistics_;
+
+    void scheduler_loop();
+    std::chrono::seconds time_until_due() const;
+    std::string next_backup_path() const;
+    void rotate();
+};
+
+} // namespace trading
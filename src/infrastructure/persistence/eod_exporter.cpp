@@ -0,0 +1,561 @@
+#include "eod_exporter.hpp"
+#include "../../core/models/order.hpp"
+#include "../../core/models/trade.hpp"
+#include "../../utils/logging.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <initializer_list>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace trading {
+
+namespace {
+
+constexpr size_t WRITE_CHUNK_BYTES = 1 << 20;
+constexpr size_t SCAN_PAGE_ROWS = 8192;
+constexpr char COLUMNAR_MAGIC[8] = {'T', 'S', 'C', 'O', 'L', 'S', '\0', '\0'};
+constexpr std::uint32_t COLUMNAR_VERSION = 1;
+
+enum class ColumnType : std::uint8_t {
+    INT64 = 1,
+    FLOAT64 = 2,
+    STRING = 3
+};
+
+template<typename T>
+void append_number(std::string& out, T value) {
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, static_cast<size_t>(result.ptr - buffer));
+}
+
+/**
+ * Names of the listed enum values as the model's *_to_string helper spells
+ * them, built once so rows are formatted without allocating. Values outside
+ * the list are written as numbers.
+ */
+template<typename Enum>
+class EnumNames {
+public:
+    EnumNames(std::string (*to_string)(Enum), std::initializer_list<Enum> values) {
+        for (Enum value : values) {
+            auto index = static_cast<size_t>(value);
+            if (index >= names_.size()) {
+                names_.resize(index + 1);
+            }
+            names_[index] = to_string(value);
+        }
+    }
+
+    void append(std::string& out, int value) const {
+        if (value >= 0 && static_cast<size_t>(value) < names_.size() && !names_[static_cast<size_t>(value)].empty()) {
+            out.append(names_[static_cast<size_t>(value)]);
+        } else {
+            append_number(out, value);
+        }
+    }
+
+private:
+    std::vector<std::string> names_;   // Indexed by value; empty for values not listed
+};
+
+const EnumNames<OrderSide>& side_names() {
+    static const EnumNames<OrderSide> names(&order_side_to_string, {OrderSide::BUY, OrderSide::SELL});
+    return names;
+}
+
+const EnumNames<OrderType>& order_type_names() {
+    static const EnumNames<OrderType> names(&order_type_to_string, {OrderType::MARKET, OrderType::LIMIT});
+    return names;
+}
+
+const EnumNames<OrderStatus>& order_status_names() {
+    static const EnumNames<OrderStatus> names(&order_status_to_string, {
+        OrderStatus::NEW, OrderStatus::ACCEPTED, OrderStatus::PARTIALLY_FILLED,
+        OrderStatus::FILLED, OrderStatus::CANCELED, OrderStatus::REJECTED});
+    return names;
+}
+
+const EnumNames<TradeType>& trade_type_names() {
+    static const EnumNames<TradeType> names(&trade_type_to_string, {TradeType::FULL_FILL, TradeType::PARTIAL_FILL});
+    return names;
+}
+
+void append_field(std::string& out, const std::string& value) {
+    if (value.find_first_of(",\"\r\n") == std::string::npos) {
+        out.append(value);
+        return;
+    }
+    out.push_back('"');
+    for (char c : value) {
+        if (c == '"') {
+            out.push_back('"');
+        }
+        out.push_back(c);
+    }
+    out.push_back('"');
+}
+
+std::string file_safe(const std::string& symbol) {
+    std::string name = symbol;
+    for (char& c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '.' && c != '_') {
+            c = '_';
+        }
+    }
+    return name.empty() ? "_" : name;
+}
+
+/**
+ * Buffered fwrite to a temporary file that is renamed into place on commit
+ */
+class ExportFile {
+public:
+    explicit ExportFile(std::string path)
+        : path_(std::move(path))
+        , temp_path_(path_ + ".tmp")
+        , file_(std::fopen(temp_path_.c_str(), "wb"))
+        , written_(0)
+        , failed_(file_ == nullptr) {
+        buffer_.reserve(WRITE_CHUNK_BYTES + 4096);
+    }
+
+    ~ExportFile() {
+        if (file_) {
+            std::fclose(file_);
+            std::error_code ec;
+            std::filesystem::remove(temp_path_, ec);
+        }
+    }
+
+    ExportFile(const ExportFile&) = delete;
+    ExportFile& operator=(const ExportFile&) = delete;
+
+    std::string& buffer() { return buffer_; }
+
+    void append_bytes(const void* data, size_t size) {
+        buffer_.append(static_cast<const char*>(data), size);
+        maybe_flush();
+    }
+
+    void maybe_flush() {
+        if (buffer_.size() >= WRITE_CHUNK_BYTES) {
+            flush();
+        }
+    }
+
+    bool commit(size_t& bytes_written) {
+        flush();
+        bool closed = std::fclose(file_) == 0;
+        file_ = nullptr;
+
+        std::error_code ec;
+        if (failed_ || !closed) {
+            std::filesystem::remove(temp_path_, ec);
+            return false;
+        }
+        std::filesystem::rename(temp_path_, path_, ec);
+        if (ec) {
+            std::filesystem::remove(temp_path_, ec);
+            return false;
+        }
+        bytes_written = written_;
+        return true;
+    }
+
+    bool is_open() const { return file_ != nullptr; }
+
+private:
+    std::string path_;
+    std::string temp_path_;
+    std::FILE* file_;
+    std::string buffer_;
+    size_t written_;
+    bool failed_;
+
+    void flush() {
+        if (!failed_ && !buffer_.empty() && std::fwrite(buffer_.data(), 1, buffer_.size(), file_) != buffer_.size()) {
+            failed_ = true;
+        }
+        written_ += buffer_.size();
+        buffer_.clear();
+    }
+};
+
+template<typename Row, typename T>
+void write_column(ExportFile& file, const char* name, const std::vector<Row>& rows, T Row::*member) {
+    auto name_length = static_cast<std::uint16_t>(std::strlen(name));
+    file.append_bytes(&name_length, sizeof(name_length));
+    file.append_bytes(name, name_length);
+
+    if constexpr (std::is_same_v<T, std::string>) {
+        auto type = ColumnType::STRING;
+        file.append_bytes(&type, sizeof(type));
+        std::uint32_t offset = 0;
+        file.append_bytes(&offset, sizeof(offset));
+        for (const auto& row : rows) {
+            offset += static_cast<std::uint32_t>((row.*member).size());
+            file.append_bytes(&offset, sizeof(offset));
+        }
+        for (const auto& row : rows) {
+            file.append_bytes((row.*member).data(), (row.*member).size());
+        }
+    } else if constexpr (std::is_floating_point_v<T>) {
+        auto type = ColumnType::FLOAT64;
+        file.append_bytes(&type, sizeof(type));
+        for (const auto& row : rows) {
+            double value = row.*member;
+            file.append_bytes(&value, sizeof(value));
+        }
+    } else {
+        auto type = ColumnType::INT64;
+        file.append_bytes(&type, sizeof(type));
+        for (const auto& row : rows) {
+            std::int64_t value = row.*member;
+            file.append_bytes(&value, sizeof(value));
+        }
+    }
+}
+
+void write_columnar_header(ExportFile& file, std::uint32_t column_count, size_t row_count) {
+    file.append_bytes(COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC));
+    file.append_bytes(&COLUMNAR_VERSION, sizeof(COLUMNAR_VERSION));
+    file.append_bytes(&column_count, sizeof(column_count));
+    auto rows = static_cast<std::uint64_t>(row_count);
+    file.append_bytes(&rows, sizeof(rows));
+}
+
+void write_columns(ExportFile& file, const std::vector<TradeRow>& rows) {
+    write_columnar_header(file, 8, rows.size());
+    write_column(file, "trade_id", rows, &TradeRow::trade_id);
+    write_column(file, "order_id", rows, &TradeRow::order_id);
+    write_column(file, "instrument_symbol", rows, &TradeRow::instrument_symbol);
+    write_column(file, "side", rows, &TradeRow::side);
+    write_column(file, "quantity", rows, &TradeRow::quantity);
+    write_column(file, "price", rows, &TradeRow::price);
+    write_column(file, "execution_time", rows, &TradeRow::execution_time);
+    write_column(file, "type", rows, &TradeRow::type);
+}
+
+void write_columns(ExportFile& file, const std::vector<OrderRow>& rows) {
+    write_columnar_header(file, 12, rows.size());
+    write_column(file, "order_id", rows, &OrderRow::order_id);
+    write_column(file, "instrument_symbol", rows, &OrderRow::instrument_symbol);
+    write_column(file, "side", rows, &OrderRow::side);
+    write_column(file, "type", rows, &OrderRow::type);
+    write_column(file, "quantity", rows, &OrderRow::quantity);
+    write_column(file, "price", rows, &OrderRow::price);
+    write_column(file, "status", rows, &OrderRow::status);
+    write_column(file, "filled_quantity", rows, &OrderRow::filled_quantity);
+    write_column(file, "total_fill_value", rows, &OrderRow::total_fill_value);
+    write_column(file, "created_time", rows, &OrderRow::created_time);
+    write_column(file, "last_modified", rows, &OrderRow::last_modified);
+    write_column(file, "rejection_reason", rows, &OrderRow::rejection_reason);
+}
+
+template<typename Row>
+bool write_partition(const std::string& path, const std::vector<Row>& rows, ExportFormat format, size_t& bytes_written) {
+    ExportFile file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    if (format == ExportFormat::COLUMNAR) {
+        write_columns(file, rows);
+    } else {
+        EodExporter::append_csv_header(file.buffer(), Row{});
+        for (const auto& row : rows) {
+            EodExporter::append_csv(file.buffer(), row);
+            file.maybe_flush();
+        }
+    }
+    return file.commit(bytes_written);
+}
+
+template<typename Row>
+std::unordered_map<std::string, std::vector<Row>> partition_by_symbol(std::vector<Row>& rows) {
+    std::unordered_map<std::string, std::vector<Row>> partitions;
+    for (auto& row : rows) {
+        partitions[row.instrument_symbol].push_back(std::move(row));
+    }
+    rows.clear();
+    return partitions;
+}
+
+// File name stem per partition. Symbols that sanitise to the same name (e.g. "A/B" and "A_B")
+// get a "~N" suffix in symbol order; file_safe() never emits '~', so suffixed names stay unique.
+template<typename Row>
+std::vector<std::pair<std::string, const std::vector<Row>*>> name_partitions(
+    const std::unordered_map<std::string, std::vector<Row>>& partitions) {
+    std::vector<const std::string*> symbols;
+    symbols.reserve(partitions.size());
+    for (const auto& [symbol, rows] : partitions) {
+        symbols.push_back(&symbol);
+    }
+    std::sort(symbols.begin(), symbols.end(), [](const std::string* a, const std::string* b) { return *a < *b; });
+
+    std::unordered_map<std::string, size_t> uses;
+    std::vector<std::pair<std::string, const std::vector<Row>*>> named;
+    named.reserve(symbols.size());
+    for (const std::string* symbol : symbols) {
+        std::string name = file_safe(*symbol);
+        size_t count = ++uses[name];
+        if (count > 1) {
+            name += "~" + std::to_string(count);
+            Logger::warn("EodExporter: Symbol " + *symbol + " shares a file name with another symbol, writing it as " + name);
+        }
+        named.emplace_back(std::move(name), &partitions.at(*symbol));
+    }
+    return named;
+}
+
+} // namespace
+
+EodExporter::Config EodExporter::from_config(const PersistenceConfig& config) {
+    Config exporter_config;
+    exporter_config.directory = config.csv_export_path;
+    exporter_config.export_trades = config.auto_export_trades;
+    exporter_config.export_orders = config.auto_export_orders;
+    parse_format(config.export_format, exporter_config.format);
+    exporter_config.thread_count = static_cast<size_t>(config.export_threads);
+    return exporter_config;
+}
+
+bool EodExporter::parse_format(const std::string& name, ExportFormat& format) {
+    if (name == "csv") {
+        format = ExportFormat::CSV;
+        return true;
+    }
+    if (name == "columnar") {
+        format = ExportFormat::COLUMNAR;
+        return true;
+    }
+    return false;
+}
+
+EodExporter::EodExporter(std::shared_ptr<SQLiteService> persistence_service, const Config& config)
+    : persistence_service_(std::move(persistence_service))
+    , config_(config) {
+    if (config_.thread_count == 0) {
+        config_.thread_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+}
+
+ExportReport EodExporter::export_day(std::chrono::system_clock::time_point date) {
+    using namespace std::chrono;
+
+    ExportReport report;
+    if (!persistence_service_) {
+        Logger::error("EodExporter: No persistence service");
+        return report;
+    }
+
+    const auto day = floor<days>(date);
+    const year_month_day ymd{day};
+    char day_name[16];
+    std::snprintf(day_name, sizeof(day_name), "%04d%02u%02u", static_cast<int>(ymd.year()),
+                  static_cast<unsigned>(ymd.month()), static_cast<unsigned>(ymd.day()));
+    const std::string directory = (std::filesystem::path(config_.directory) / day_name).string();
+
+    HistoryQuery query;
+    query.from = day;
+    query.to = day + days(1) - seconds(1);
+    query.page_size = SCAN_PAGE_ROWS;
+
+    const auto scan_start = steady_clock::now();
+    std::vector<TradeRow> trades;
+    std::vector<OrderRow> orders;
+    bool scanned = true;
+    if (config_.export_trades) {
+        scanned = persistence_service_->scan_trades(query, [&trades](const TradeRow& row) {
+            trades.push_back(row);
+            return true;
+        }).ok;
+    }
+    if (scanned && config_.export_orders) {
+        scanned = persistence_service_->scan_orders(query, [&orders](const OrderRow& row) {
+            orders.push_back(row);
+            return true;
+        }).ok;
+    }
+    const auto scan_time = duration_cast<milliseconds>(steady_clock::now() - scan_start);
+    if (!scanned) {
+        Logger::error("EodExporter: Failed to read " + std::string(day_name) + " from the database");
+        report.directory = directory;
+        report.scan_time = scan_time;
+        return report;
+    }
+
+    report = export_rows(directory, std::move(trades), std::move(orders));
+    report.scan_time = scan_time;
+    return report;
+}
+
+ExportReport EodExporter::export_rows(const std::string& directory, std::vector<TradeRow> trades,
+                                      std::vector<OrderRow> orders) {
+    ExportReport report;
+    report.directory = directory;
+    report.trade_rows = trades.size();
+    report.order_rows = orders.size();
+    const auto start = std::chrono::steady_clock::now();
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        Logger::error("EodExporter: Cannot create " + directory + ": " + ec.message());
+        return report;
+    }
+
+    // Rows arrive in time order, so each partition stays time-ordered
+    auto trade_partitions = partition_by_symbol(trades);
+    auto order_partitions = partition_by_symbol(orders);
+
+    struct Task {
+        std::string path;
+        const std::vector<TradeRow>* trades;
+        const std::vector<OrderRow>* orders;
+        size_t rows;
+    };
+    const char* extension = config_.format == ExportFormat::COLUMNAR ? ".col" : ".csv";
+    std::vector<Task> tasks;
+    tasks.reserve(trade_partitions.size() + order_partitions.size());
+    for (const auto& [name, rows] : name_partitions(trade_partitions)) {
+        auto path = (std::filesystem::path(directory) / ("trades_" + name + extension)).string();
+        tasks.push_back({path, rows, nullptr, rows->size()});
+    }
+    for (const auto& [name, rows] : name_partitions(order_partitions)) {
+        auto path = (std::filesystem::path(directory) / ("orders_" + name + extension)).string();
+        tasks.push_back({path, nullptr, rows, rows->size()});
+    }
+    // Largest partitions first so one big symbol does not finish last on its own
+    std::sort(tasks.begin(), tasks.end(), [](const Task& a, const Task& b) { return a.rows > b.rows; });
+
+    const size_t worker_count = std::max<size_t>(1, std::min(config_.thread_count, tasks.size()));
+    std::atomic<size_t> next_task{0};
+    std::atomic<size_t> bytes_written{0};
+    std::atomic<size_t> files_written{0};
+    std::atomic<bool> failed{false};
+    auto worker = [&]() {
+        for (;;) {
+            size_t index = next_task.fetch_add(1, std::memory_order_relaxed);
+            if (index >= tasks.size()) {
+                break;
+            }
+            const Task& task = tasks[index];
+            size_t bytes = 0;
+            bool written = false;
+            try {
+                written = task.trades ? write_partition(task.path, *task.trades, config_.format, bytes)
+                                      : write_partition(task.path, *task.orders, config_.format, bytes);
+            } catch (const std::exception& e) {
+                // An exception escaping a worker thread would terminate the process
+                Logger::error("EodExporter: Exception writing " + task.path + ": " + e.what());
+            }
+            if (!written) {
+                Logger::error("EodExporter: Failed to write " + task.path);
+                failed.store(true);
+                continue;
+            }
+            bytes_written.fetch_add(bytes, std::memory_order_relaxed);
+            files_written.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count - 1);
+    for (size_t i = 1; i < worker_count; ++i) {
+        try {
+            workers.emplace_back(worker);
+        } catch (const std::system_error& e) {
+            Logger::warn("EodExporter: Exporting with " + std::to_string(workers.size() + 1) +
+                         " threads, could not start more: " + e.what());
+            break;
+        }
+    }
+    worker(); // The calling thread takes a share of the work
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    report.success = !failed.load();
+    report.threads_used = workers.size() + 1;
+    report.files_written = files_written.load();
+    report.bytes_written = bytes_written.load();
+    report.format_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    Logger::info("EodExporter: Exported " + std::to_string(report.trade_rows) + " trades and " +
+                 std::to_string(report.order_rows) + " orders to " + directory + " (" +
+                 std::to_string(report.files_written) + " files, " + std::to_string(report.bytes_written) +
+                 " bytes, " + std::to_string(report.threads_used) + " threads, " +
+                 std::to_string(report.format_time.count()) + "ms)");
+    return report;
+}
+
+// Row formatting
+
+void EodExporter::append_csv_header(std::string& out, const TradeRow&) {
+    out.append("trade_id,order_id,instrument_symbol,side,quantity,price,execution_time,type\n");
+}
+
+void EodExporter::append_csv_header(std::string& out, const OrderRow&) {
+    out.append("order_id,instrument_symbol,side,type,quantity,price,status,filled_quantity,"
+               "total_fill_value,created_time,last_modified,rejection_reason\n");
+}
+
+void EodExporter::append_csv(std::string& out, const TradeRow& row) {
+    append_field(out, row.trade_id);
+    out.push_back(',');
+    append_field(out, row.order_id);
+    out.push_back(',');
+    append_field(out, row.instrument_symbol);
+    out.push_back(',');
+    side_names().append(out, row.side);
+    out.push_back(',');
+    append_number(out, row.quantity);
+    out.push_back(',');
+    append_number(out, row.price);
+    out.push_back(',');
+    append_number(out, row.execution_time);
+    out.push_back(',');
+    trade_type_names().append(out, row.type);
+    out.push_back('\n');
+}
+
+void EodExporter::append_csv(std::string& out, const OrderRow& row) {
+    append_field(out, row.order_id);
+    out.push_back(',');
+    append_field(out, row.instrument_symbol);
+    out.push_back(',');
+    side_names().append(out, row.side);
+    out.push_back(',');
+    order_type_names().append(out, row.type);
+    out.push_back(',');
+    append_number(out, row.quantity);
+    out.push_back(',');
+    append_number(out, row.price);
+    out.push_back(',');
+    order_status_names().append(out, row.status);
+    out.push_back(',');
+    append_number(out, row.filled_quantity);
+    out.push_back(',');
+    append_number(out, row.total_fill_value);
+    out.push_back(',');
+    append_number(out, row.created_time);
+    out.push_back(',');
+    append_number(out, row.last_modified);
+    out.push_back(',');
+    append_field(out, row.rejection_reason);
+    out.push_back('\n');
+}
+
+} // namespace trading
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "sqlite_service.hpp"
+#include "utils/config.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace trading {
+
+enum class ExportFormat {
+    CSV,
+    COLUMNAR    // Per-column arrays, see EodExporter
+};
+
+/**
+ * Export Report
+ * Outcome of one end-of-day export
+ */
+struct ExportReport {
+    bool success = false;
+    std::string directory;
+    size_t trade_rows = 0;
+    size_t order_rows = 0;
+    size_t files_written = 0;
+    size_t bytes_written = 0;
+    size_t threads_used = 0;
+    std::chrono::milliseconds scan_time{0};
+    std::chrono::milliseconds format_time{0};
+};
+
+/**
+ * End-of-Day Exporter
+ * Streams a day's trades and orders out of SQLite, partitions them by symbol
+ * and formats the partitions on worker threads into one file per symbol and
+ * table under <directory>/<YYYYMMDD>/. Numbers are formatted with to_chars and
+ * written with fwrite; files appear under their final name only once complete.
+ *
+ * The columnar format (.col) is a header { "TSCOLS\0\0", u32 version, u32
+ * column_count, u64 row_count } followed by one block per column { u16 name
+ * length, name, u8 type, data } in native byte order. Data is row_count int64 or
+ * float64 values, or for strings row_count + 1 u32 offsets then the bytes.
+ */
+class EodExporter {
+public:
+    struct Config {
+        std::string directory = "./data/exports/";
+        bool export_trades = true;
+        bool export_orders = true;
+        ExportFormat format = ExportFormat::CSV;
+        size_t thread_count = 0;    // 0 = hardware concurrency
+    };
+
+    static Config from_config(const PersistenceConfig& config);
+    static bool parse_format(const std::string& name, ExportFormat& format);
+
+    EodExporter(std::shared_ptr<SQLiteService> persistence_service, const Config& config);
+
+    // Export the UTC day containing date
+    ExportReport export_day(std::chrono::system_clock::time_point date);
+
+    // Partition and write already-loaded rows into directory
+    ExportReport export_rows(const std::string& directory, std::vector<TradeRow> trades, std::vector<OrderRow> orders);
+
+    // Row formatting, appended to out
+    static void append_csv_header(std::string& out, const TradeRow&);
+    static void append_csv_header(std::string& out, const OrderRow&);
+    static void append_csv(std::string& out, const TradeRow& row);
+    static void append_csv(std::string& out, const OrderRow& row);
+
+private:
+    std::shared_ptr<SQLiteService> persistence_service_;
+    Config config_;
+};
+
+} // namespace trading
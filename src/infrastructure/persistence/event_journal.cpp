@@ -0,0 +1,698 @@
+#include "event_journal.hpp"
+#include "../../core/models/order.hpp"
+#include "../../core/models/trade.hpp"
+#include "../../core/models/position.hpp"
+#include "file_io.hpp"
+#include "../../utils/logging.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace trading {
+
+namespace {
+
+constexpr const char* SEGMENT_PREFIX = "journal-";
+constexpr const char* SEGMENT_SUFFIX = ".log";
+constexpr const char* CHECKPOINT_FILE = "compacted.checkpoint";
+constexpr size_t RECOVERY_CHUNK_RECORDS = 1024;
+constexpr uint64_t READ_CHUNK_RECORDS = 16384;
+
+constexpr std::array<std::uint32_t, 256> make_crc32_table() {
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        std::uint32_t value = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            value = (value & 1u) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+        }
+        table[i] = value;
+    }
+    return table;
+}
+
+constexpr auto CRC32_TABLE = make_crc32_table();
+
+template<size_t N>
+bool copy_field(char (&field)[N], const std::string& value) {
+    if (value.size() >= N) {
+        return false;
+    }
+    std::memcpy(field, value.data(), value.size());
+    return true;
+}
+
+template<size_t N>
+void copy_truncated(char (&field)[N], const std::string& value) {
+    std::memcpy(field, value.data(), std::min(value.size(), N - 1));
+}
+
+template<size_t N>
+std::string read_field(const char (&field)[N]) {
+    return std::string(field, static_cast<size_t>(std::find(field, field + N, '\0') - field));
+}
+
+std::int64_t to_nanoseconds(const std::chrono::system_clock::time_point& tp) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count();
+}
+
+std::chrono::system_clock::time_point from_nanoseconds(std::int64_t nanoseconds) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(nanoseconds)));
+}
+
+std::int64_t to_unix_seconds(std::int64_t nanoseconds) {
+    return nanoseconds / 1000000000;
+}
+
+bool is_zero_record(const JournalRecord& record) {
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(&record);
+    return std::all_of(bytes, bytes + JournalRecord::SIZE, [](std::uint8_t b) { return b == 0; });
+}
+
+JournalRecord make_record(JournalRecordType type) {
+    JournalRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.type = type;
+    return record;
+}
+
+} // namespace
+
+// JournalRecord
+
+std::uint32_t JournalRecord::compute_checksum() const {
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(this);
+    return EventJournal::crc32(bytes + sizeof(checksum), SIZE - sizeof(checksum));
+}
+
+bool JournalRecord::is_valid(std::uint64_t expected_sequence) const {
+    return type != JournalRecordType::NONE && sequence == expected_sequence && checksum == compute_checksum();
+}
+
+// EventJournal
+
+EventJournal::EventJournal(const Config& config)
+    : config_(config)
+    , records_per_segment_(std::max<uint64_t>(1, config.segment_size_bytes / JournalRecord::SIZE))
+    , is_open_(false)
+    , failed_(false)
+    , stop_requested_(false)
+    , appended_sequence_(0)
+    , durable_sequence_(0)
+    , compacted_sequence_(0)
+    , snapshot_sequence_(0)
+    , active_fd_(-1)
+    , active_records_(0)
+    , records_appended_(0)
+    , group_commits_(0)
+    , bytes_written_(0)
+    , segments_created_(0)
+    , segments_removed_(0) {
+}
+
+EventJournal::~EventJournal() {
+    close();
+}
+
+bool EventJournal::open() {
+    if (is_open_.load()) {
+        return true;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(config_.directory, ec);
+    if (ec) {
+        Logger::error("EventJournal: Cannot create " + config_.directory + ": " + ec.message());
+        return false;
+    }
+    load_checkpoint();
+
+    std::vector<Segment> found;
+    for (const auto& entry : std::filesystem::directory_iterator(config_.directory, ec)) {
+        std::string name = entry.path().filename().string();
+        if (name.rfind(SEGMENT_PREFIX, 0) != 0 || name.size() <= std::strlen(SEGMENT_PREFIX) + std::strlen(SEGMENT_SUFFIX) ||
+            name.compare(name.size() - std::strlen(SEGMENT_SUFFIX), std::string::npos, SEGMENT_SUFFIX) != 0) {
+            continue;
+        }
+        try {
+            found.push_back({std::stoull(name.substr(std::strlen(SEGMENT_PREFIX))), entry.path().string()});
+        } catch (const std::exception&) {
+            Logger::warn("EventJournal: Ignoring unrecognised file " + name);
+        }
+    }
+    std::sort(found.begin(), found.end(), [](const Segment& a, const Segment& b) {
+        return a.first_sequence < b.first_sequence;
+    });
+
+    // Segments are only deleted once compacted, so a missing prefix was already folded
+    if (!found.empty() && found.front().first_sequence > get_compacted_sequence() + 1) {
+        compacted_sequence_.store(found.front().first_sequence - 1);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(segments_mutex_);
+        segments_ = found;
+    }
+
+    uint64_t next_sequence = get_compacted_sequence() + 1;
+    bool need_segment = found.empty();
+    if (!found.empty()) {
+        const Segment& last = found.back();
+        uint64_t valid_records = recover_segment(last);
+        next_sequence = last.first_sequence + valid_records;
+        if (next_sequence <= get_compacted_sequence()) {
+            Logger::warn("EventJournal: Journal ends before compaction checkpoint; starting a new segment");
+            next_sequence = get_compacted_sequence() + 1;
+            need_segment = true;
+        } else {
+            active_fd_ = file_io::open_file(last.path, true);
+            active_records_ = valid_records;
+            if (active_fd_ < 0) {
+                Logger::error("EventJournal: Cannot open segment " + last.path);
+                return false;
+            }
+        }
+    }
+    if (need_segment && !open_segment(next_sequence)) {
+        return false;
+    }
+
+    appended_sequence_.store(next_sequence - 1);
+    durable_sequence_.store(next_sequence - 1);
+    failed_.store(false);
+    stop_requested_ = false;
+    is_open_.store(true);
+    writer_thread_ = std::thread(&EventJournal::writer_loop, this);
+
+    Logger::info("EventJournal: Opened " + config_.directory + " at sequence " + std::to_string(next_sequence - 1) +
+                 " (compacted through " + std::to_string(get_compacted_sequence()) + ")");
+    return true;
+}
+
+void EventJournal::close() {
+    if (!is_open_.exchange(false)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(append_mutex_);
+        stop_requested_ = true;
+    }
+    writer_cv_.notify_all();
+    if (writer_thread_.joinable()) {
+        writer_thread_.join();
+    }
+
+    if (active_fd_ >= 0) {
+        file_io::sync_file(active_fd_);
+        file_io::close_file(active_fd_);
+        active_fd_ = -1;
+    }
+
+    Logger::info("EventJournal: Closed at durable sequence " + std::to_string(get_durable_sequence()));
+}
+
+uint64_t EventJournal::append_order(const Order& order) {
+    JournalRecord record;
+    return encode_order(order, record) ? append(record) : 0;
+}
+
+uint64_t EventJournal::append_trade(const Trade& trade) {
+    JournalRecord record;
+    return encode_trade(trade, record) ? append(record) : 0;
+}
+
+uint64_t EventJournal::append_position(const Position& position) {
+    JournalRecord record;
+    return encode_position(position, record) ? append(record) : 0;
+}
+
+uint64_t EventJournal::append(JournalRecord& record) {
+    if (!is_open_.load() || failed_.load()) {
+        return 0;
+    }
+
+    uint64_t sequence = 0;
+    {
+        std::lock_guard<std::mutex> lock(append_mutex_);
+        if (stop_requested_) {
+            return 0;
+        }
+        sequence = appended_sequence_.load(std::memory_order_relaxed) + 1;
+        record.sequence = sequence;
+        record.checksum = record.compute_checksum();
+        pending_.push_back(record);
+        appended_sequence_.store(sequence, std::memory_order_release);
+    }
+    records_appended_.fetch_add(1, std::memory_order_relaxed);
+    writer_cv_.notify_one();
+    return sequence;
+}
+
+bool EventJournal::wait_for_durable(uint64_t sequence, std::chrono::milliseconds timeout) {
+    if (get_durable_sequence() >= sequence) {
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lock(append_mutex_);
+    return durable_cv_.wait_for(lock, timeout, [this, sequence] {
+        return get_durable_sequence() >= sequence || failed_.load();
+    }) && get_durable_sequence() >= sequence;
+}
+
+bool EventJournal::flush(std::chrono::milliseconds timeout) {
+    return wait_for_durable(get_appended_sequence(), timeout);
+}
+
+size_t EventJournal::read_batch(uint64_t from_sequence, size_t max_records, PersistenceBatch& batch) const {
+    return for_each_record(from_sequence, max_records, [&batch](const JournalRecord& record) {
+        decode(record, batch);
+    });
+}
+
+size_t EventJournal::for_each_record(uint64_t from_sequence, size_t max_records, const RecordVisitor& visitor) const {
+    const uint64_t durable = get_durable_sequence();
+    if (from_sequence == 0 || from_sequence > durable || max_records == 0) {
+        return 0;
+    }
+    const uint64_t last_sequence = durable - from_sequence + 1 > max_records ? from_sequence + max_records - 1 : durable;
+
+    std::vector<Segment> segments;
+    {
+        std::lock_guard<std::mutex> lock(segments_mutex_);
+        segments = segments_;
+    }
+
+    size_t records_read = 0;
+    uint64_t sequence = from_sequence;
+    std::vector<JournalRecord> buffer;
+    while (sequence <= last_sequence) {
+        auto next = std::upper_bound(segments.begin(), segments.end(), sequence,
+                                     [](uint64_t value, const Segment& segment) { return value < segment.first_sequence; });
+        if (next == segments.begin()) {
+            Logger::error("EventJournal: No segment holds sequence " + std::to_string(sequence));
+            break;
+        }
+        const Segment& segment = *(next - 1);
+        uint64_t segment_last = next == segments.end() ? last_sequence : next->first_sequence - 1;
+        uint64_t chunk_last = std::min({last_sequence, segment_last, sequence + READ_CHUNK_RECORDS - 1});
+        auto count = static_cast<size_t>(chunk_last - sequence + 1);
+
+        buffer.resize(count);
+        int fd = file_io::open_file(segment.path, false);
+        bool read_ok = fd >= 0 && file_io::read_at(fd, buffer.data(), count * JournalRecord::SIZE,
+                                          (sequence - segment.first_sequence) * JournalRecord::SIZE);
+        if (fd >= 0) {
+            file_io::close_file(fd);
+        }
+        if (!read_ok) {
+            Logger::error("EventJournal: Failed to read " + segment.path);
+            break;
+        }
+
+        for (const auto& record : buffer) {
+            if (!record.is_valid(sequence)) {
+                Logger::error("EventJournal: Corrupt record at sequence " + std::to_string(sequence));
+                return records_read;
+            }
+            visitor(record);
+            ++records_read;
+            ++sequence;
+        }
+    }
+    return records_read;
+}
+
+uint64_t EventJournal::get_first_sequence() const {
+    std::lock_guard<std::mutex> lock(segments_mutex_);
+    return segments_.empty() ? get_durable_sequence() + 1 : segments_.front().first_sequence;
+}
+
+bool EventJournal::mark_compacted(uint64_t sequence) {
+    sequence = std::min(sequence, get_durable_sequence());
+    if (sequence <= get_compacted_sequence()) {
+        return true;
+    }
+
+    // Write-then-rename so a crash leaves either the old or the new checkpoint
+    const std::string path = checkpoint_path();
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::trunc);
+        file << sequence << '\n';
+        if (!file) {
+            Logger::error("EventJournal: Failed to write compaction checkpoint");
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        Logger::error("EventJournal: Failed to replace compaction checkpoint: " + ec.message());
+        return false;
+    }
+    compacted_sequence_.store(sequence, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(segments_mutex_);
+    remove_obsolete_segments();
+    return true;
+}
+
+void EventJournal::mark_snapshot(uint64_t sequence) {
+    if (sequence <= get_snapshot_sequence()) {
+        return;
+    }
+    snapshot_sequence_.store(sequence, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(segments_mutex_);
+    remove_obsolete_segments();
+}
+
+EventJournal::Statistics EventJournal::get_statistics() const {
+    Statistics stats;
+    stats.records_appended = records_appended_.load(std::memory_order_relaxed);
+    stats.group_commits = group_commits_.load(std::memory_order_relaxed);
+    stats.bytes_written = bytes_written_.load(std::memory_order_relaxed);
+    stats.segments_created = segments_created_.load(std::memory_order_relaxed);
+    stats.segments_removed = segments_removed_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+size_t EventJournal::get_segment_count() const {
+    std::lock_guard<std::mutex> lock(segments_mutex_);
+    return segments_.size();
+}
+
+std::uint32_t EventJournal::crc32(const void* data, size_t size) {
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) {
+        crc = CRC32_TABLE[(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+bool EventJournal::encode_order(const Order& order, JournalRecord& record) {
+    record = make_record(JournalRecordType::ORDER);
+    auto& event = record.payload.order;
+    if (!copy_field(event.order_id, order.get_order_id()) ||
+        !copy_field(event.symbol, order.get_instrument_symbol())) {
+        return false;
+    }
+    event.side = static_cast<std::int8_t>(order.get_side());
+    event.type = static_cast<std::int8_t>(order.get_type());
+    event.status = static_cast<std::int8_t>(order.get_status());
+    event.quantity = order.get_quantity();
+    event.price = order.get_price();
+    event.filled_quantity = order.get_filled_quantity();
+    event.total_fill_value = event.filled_quantity * order.get_average_fill_price();
+    event.created_time_ns = to_nanoseconds(order.get_created_time());
+    event.last_modified_ns = to_nanoseconds(order.get_last_modified());
+    copy_truncated(event.rejection_reason, order.get_rejection_reason());
+    return true;
+}
+
+bool EventJournal::encode_trade(const Trade& trade, JournalRecord& record) {
+    record = make_record(JournalRecordType::TRADE);
+    auto& event = record.payload.trade;
+    if (!copy_field(event.trade_id, trade.get_trade_id()) ||
+        !copy_field(event.order_id, trade.get_order_id()) ||
+        !copy_field(event.symbol, trade.get_instrument_symbol())) {
+        return false;
+    }
+    event.side = static_cast<std::int8_t>(trade.get_side());
+    event.type = static_cast<std::int8_t>(trade.get_type());
+    event.quantity = trade.get_quantity();
+    event.price = trade.get_price();
+    event.execution_time_ns = to_nanoseconds(trade.get_execution_time());
+    return true;
+}
+
+bool EventJournal::encode_position(const Position& position, JournalRecord& record) {
+    record = make_record(JournalRecordType::POSITION);
+    auto& event = record.payload.position;
+    if (!copy_field(event.symbol, position.get_instrument_symbol())) {
+        return false;
+    }
+    event.quantity = position.get_quantity();
+    event.average_price = position.get_average_price();
+    event.realized_pnl = position.get_realized_pnl();
+    event.unrealized_pnl = position.get_unrealized_pnl();
+    event.last_updated_ns = to_nanoseconds(position.get_last_updated());
+    return true;
+}
+
+std::shared_ptr<Order> EventJournal::decode_order(const JournalRecord& record) {
+    if (record.type != JournalRecordType::ORDER) {
+        return nullptr;
+    }
+    const auto& event = record.payload.order;
+    auto order = std::make_shared<Order>(read_field(event.order_id), read_field(event.symbol),
+                                         static_cast<OrderSide>(event.side), static_cast<OrderType>(event.type),
+                                         event.quantity, event.price, from_nanoseconds(event.created_time_ns));
+    order->restore_state(static_cast<OrderStatus>(event.status), event.filled_quantity, event.total_fill_value,
+                         from_nanoseconds(event.last_modified_ns), read_field(event.rejection_reason));
+    return order;
+}
+
+std::shared_ptr<Trade> EventJournal::decode_trade(const JournalRecord& record) {
+    if (record.type != JournalRecordType::TRADE) {
+        return nullptr;
+    }
+    const auto& event = record.payload.trade;
+    return std::make_shared<Trade>(read_field(event.trade_id), read_field(event.order_id), read_field(event.symbol),
+                                   static_cast<OrderSide>(event.side), event.quantity, event.price,
+                                   static_cast<TradeType>(event.type), from_nanoseconds(event.execution_time_ns));
+}
+
+std::shared_ptr<Position> EventJournal::decode_position(const JournalRecord& record) {
+    if (record.type != JournalRecordType::POSITION) {
+        return nullptr;
+    }
+    const auto& event = record.payload.position;
+    auto position = std::make_shared<Position>(read_field(event.symbol));
+    position->restore_state(event.quantity, event.average_price, event.realized_pnl, event.unrealized_pnl,
+                            from_nanoseconds(event.last_updated_ns));
+    return position;
+}
+
+// Writer thread
+
+void EventJournal::writer_loop() {
+    std::vector<JournalRecord> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(append_mutex_);
+            writer_cv_.wait(lock, [this] { return stop_requested_ || !pending_.empty(); });
+            if (pending_.empty()) {
+                break;  // Stop requested and everything committed
+            }
+            // Everything appended while the previous commit was in flight goes out together
+            batch.swap(pending_);
+        }
+
+        bool written = !failed_.load() && write_records(batch);
+        uint64_t last_sequence = batch.back().sequence;
+        batch.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(append_mutex_);
+            if (written) {
+                durable_sequence_.store(last_sequence, std::memory_order_release);
+            } else if (!failed_.exchange(true)) {
+                Logger::critical("EventJournal: Write failed; durable watermark stalled at " +
+                                 std::to_string(get_durable_sequence()));
+            }
+        }
+        durable_cv_.notify_all();
+    }
+}
+
+bool EventJournal::write_records(const std::vector<JournalRecord>& records) {
+    size_t index = 0;
+    while (index < records.size()) {
+        if (active_records_ >= records_per_segment_) {
+            if (!file_io::sync_file(active_fd_) || !open_segment(records[index].sequence)) {
+                return false;
+            }
+        }
+
+        auto count = static_cast<size_t>(std::min<uint64_t>(records.size() - index,
+                                                            records_per_segment_ - active_records_));
+        if (!file_io::write_at(active_fd_, &records[index], count * JournalRecord::SIZE,
+                      active_records_ * JournalRecord::SIZE)) {
+            Logger::error("EventJournal: Segment write failed");
+            return false;
+        }
+        active_records_ += count;
+        index += count;
+        bytes_written_.fetch_add(count * JournalRecord::SIZE, std::memory_order_relaxed);
+    }
+
+    if (config_.sync_on_commit && !file_io::sync_file(active_fd_)) {
+        Logger::error("EventJournal: Segment sync failed");
+        return false;
+    }
+    group_commits_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool EventJournal::open_segment(uint64_t first_sequence) {
+    std::string path = segment_path(first_sequence);
+    int fd = file_io::open_file(path, true);
+    if (fd < 0) {
+        Logger::error("EventJournal: Cannot create segment " + path);
+        return false;
+    }
+    if (!file_io::preallocate(fd, records_per_segment_ * JournalRecord::SIZE)) {
+        Logger::warn("EventJournal: Could not preallocate " + path);
+    }
+    file_io::sync_directory(config_.directory);
+
+    if (active_fd_ >= 0) {
+        file_io::close_file(active_fd_);
+    }
+    active_fd_ = fd;
+    active_records_ = 0;
+
+    std::lock_guard<std::mutex> lock(segments_mutex_);
+    segments_.push_back({first_sequence, path});
+    segments_created_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+uint64_t EventJournal::recover_segment(const Segment& segment) {
+    int fd = file_io::open_file(segment.path, true);
+    if (fd < 0) {
+        return 0;
+    }
+
+    std::error_code ec;
+    auto file_records = static_cast<uint64_t>(std::filesystem::file_size(segment.path, ec) / JournalRecord::SIZE);
+    std::vector<JournalRecord> buffer(RECOVERY_CHUNK_RECORDS);
+    JournalRecord zero = make_record(JournalRecordType::NONE);
+
+    uint64_t valid_records = 0;
+    uint64_t zeroed_records = 0;
+    bool end_found = false;
+    for (uint64_t index = 0; index < file_records;) {
+        auto count = static_cast<size_t>(std::min<uint64_t>(RECOVERY_CHUNK_RECORDS, file_records - index));
+        if (!file_io::read_at(fd, buffer.data(), count * JournalRecord::SIZE, index * JournalRecord::SIZE)) {
+            break;
+        }
+        for (size_t i = 0; i < count; ++i, ++index) {
+            if (!end_found && buffer[i].is_valid(segment.first_sequence + index)) {
+                ++valid_records;
+                continue;
+            }
+            end_found = true;
+            if (is_zero_record(buffer[i])) {
+                index = file_records;  // Reached never-written space
+                break;
+            }
+            // Torn or stale bytes past the end would otherwise resurface after the next append
+            file_io::write_at(fd, &zero, JournalRecord::SIZE, index * JournalRecord::SIZE);
+            ++zeroed_records;
+        }
+    }
+
+    if (zeroed_records > 0) {
+        file_io::sync_file(fd);
+        Logger::warn("EventJournal: Discarded " + std::to_string(zeroed_records) + " torn record(s) in " + segment.path);
+    }
+    file_io::close_file(fd);
+    return valid_records;
+}
+
+void EventJournal::remove_obsolete_segments() {
+    uint64_t removable = get_compacted_sequence();
+    if (config_.retain_for_snapshots) {
+        removable = std::min(removable, get_snapshot_sequence());
+    }
+
+    // A segment goes once every record in it is removable; the active segment always stays
+    std::error_code ec;
+    while (segments_.size() > 1 && segments_[1].first_sequence <= removable + 1) {
+        std::filesystem::remove(segments_.front().path, ec);
+        segments_.erase(segments_.begin());
+        segments_removed_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+std::string EventJournal::segment_path(uint64_t first_sequence) const {
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s%020llu%s", SEGMENT_PREFIX,
+                  static_cast<unsigned long long>(first_sequence), SEGMENT_SUFFIX);
+    return (std::filesystem::path(config_.directory) / name).string();
+}
+
+std::string EventJournal::checkpoint_path() const {
+    return (std::filesystem::path(config_.directory) / CHECKPOINT_FILE).string();
+}
+
+bool EventJournal::load_checkpoint() {
+    uint64_t sequence = 0;
+    std::ifstream file(checkpoint_path());
+    if (file) {
+        file >> sequence;
+    }
+    compacted_sequence_.store(file ? sequence : 0);
+    return static_cast<bool>(file);
+}
+
+void EventJournal::decode(const JournalRecord& record, PersistenceBatch& batch) {
+    switch (record.type) {
+        case JournalRecordType::ORDER: {
+            const auto& event = record.payload.order;
+            OrderRow row;
+            row.order_id = read_field(event.order_id);
+            row.instrument_symbol = read_field(event.symbol);
+            row.side = event.side;
+            row.type = event.type;
+            row.quantity = event.quantity;
+            row.price = event.price;
+            row.status = event.status;
+            row.filled_quantity = event.filled_quantity;
+            row.total_fill_value = event.total_fill_value;
+            row.created_time = to_unix_seconds(event.created_time_ns);
+            row.last_modified = to_unix_seconds(event.last_modified_ns);
+            row.rejection_reason = read_field(event.rejection_reason);
+            batch.orders.push_back(std::move(row));
+            break;
+        }
+        case JournalRecordType::TRADE: {
+            const auto& event = record.payload.trade;
+            TradeRow row;
+            row.trade_id = read_field(event.trade_id);
+            row.order_id = read_field(event.order_id);
+            row.instrument_symbol = read_field(event.symbol);
+            row.side = event.side;
+            row.quantity = event.quantity;
+            row.price = event.price;
+            row.execution_time = to_unix_seconds(event.execution_time_ns);
+            row.type = event.type;
+            batch.trades.push_back(std::move(row));
+            break;
+        }
+        case JournalRecordType::POSITION: {
+            const auto& event = record.payload.position;
+            PositionRow row;
+            row.instrument_symbol = read_field(event.symbol);
+            row.quantity = event.quantity;
+            row.average_price = event.average_price;
+            row.realized_pnl = event.realized_pnl;
+            row.unrealized_pnl = event.unrealized_pnl;
+            row.last_updated = to_unix_seconds(event.last_updated_ns);
+            batch.positions.push_back(std::move(row));
+            break;
+        }
+        case JournalRecordType::NONE:
+            break;
+    }
+}
+
+} // namespace trading
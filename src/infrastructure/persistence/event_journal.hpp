@@ -0,0 +1,227 @@
+#pragma once
+
+#include "sqlite_service.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace trading {
+
+class Order;
+class Trade;
+class Position;
+
+enum class JournalRecordType : std::uint8_t {
+    NONE = 0,       // Preallocated, never written
+    ORDER = 1,
+    TRADE = 2,
+    POSITION = 3
+};
+
+/**
+ * Journal Record
+ * Fixed-size on-disk record. The CRC32 covers every byte after the checksum,
+ * including the sequence, so torn or stale records fail validation on recovery.
+ * Timestamps are nanoseconds since the Unix epoch.
+ */
+struct JournalRecord {
+    static constexpr size_t SIZE = 256;
+    static constexpr size_t ID_SIZE = 48;
+    static constexpr size_t SYMBOL_SIZE = 16;
+    static constexpr size_t REASON_SIZE = 112;  // Longer rejection reasons are truncated
+
+    struct OrderEvent {
+        char order_id[ID_SIZE];
+        char symbol[SYMBOL_SIZE];
+        std::int8_t side;
+        std::int8_t type;
+        std::int8_t status;
+        double quantity;
+        double price;
+        double filled_quantity;
+        double total_fill_value;
+        std::int64_t created_time_ns;
+        std::int64_t last_modified_ns;
+        char rejection_reason[REASON_SIZE];
+    };
+
+    struct TradeEvent {
+        char trade_id[ID_SIZE];
+        char order_id[ID_SIZE];
+        char symbol[SYMBOL_SIZE];
+        std::int8_t side;
+        std::int8_t type;
+        double quantity;
+        double price;
+        std::int64_t execution_time_ns;
+    };
+
+    struct PositionEvent {
+        char symbol[SYMBOL_SIZE];
+        double quantity;
+        double average_price;
+        double realized_pnl;
+        double unrealized_pnl;
+        std::int64_t last_updated_ns;
+    };
+
+    union Payload {
+        OrderEvent order;
+        TradeEvent trade;
+        PositionEvent position;
+        std::uint8_t bytes[SIZE - 16];
+    };
+
+    std::uint32_t checksum;
+    JournalRecordType type;
+    std::uint8_t reserved[3];
+    std::uint64_t sequence;
+    Payload payload;
+
+    std::uint32_t compute_checksum() const;
+    bool is_valid(std::uint64_t expected_sequence) const;
+};
+
+static_assert(sizeof(JournalRecord) == JournalRecord::SIZE, "Journal records must stay fixed-size");
+
+/**
+ * Event Journal
+ * Append-only durable log of order events, fills and position changes.
+ * Features:
+ * - Fixed-size CRC32-checked records in preallocated segment files
+ * - Group commit: one writer thread writes and fsyncs everything appended since its last commit
+ * - Durable watermark per sequence, like AsyncPersistenceWriter
+ * - Compaction checkpoint; segments wholly below it are deleted
+ * - Optional snapshot floor so segments needed for engine recovery outlive compaction
+ */
+class EventJournal {
+public:
+    struct Config {
+        std::string directory = "./data/journal";
+        size_t segment_size_bytes = 64 * 1024 * 1024;
+        bool sync_on_commit = true;   // fdatasync after every group commit
+        bool retain_for_snapshots = false;  // Keep segments past the last mark_snapshot() sequence
+    };
+
+    struct Statistics {
+        uint64_t records_appended = 0;
+        uint64_t group_commits = 0;
+        uint64_t bytes_written = 0;
+        uint64_t segments_created = 0;
+        uint64_t segments_removed = 0;
+    };
+
+    using RecordVisitor = std::function<void(const JournalRecord&)>;
+
+    explicit EventJournal(const Config& config);
+    ~EventJournal();
+
+    // Non-copyable
+    EventJournal(const EventJournal&) = delete;
+    EventJournal& operator=(const EventJournal&) = delete;
+
+    // Lifecycle - open() recovers the tail of the last segment; close() commits pending records
+    bool open();
+    void close();
+    bool is_open() const { return is_open_.load(); }
+
+    // Append a snapshot; returns its sequence (>= 1), or 0 when closed, failed or the ids don't fit
+    uint64_t append_order(const Order& order);
+    uint64_t append_trade(const Trade& trade);
+    uint64_t append_position(const Position& position);
+
+    // Durability watermark
+    uint64_t get_appended_sequence() const { return appended_sequence_.load(std::memory_order_acquire); }
+    uint64_t get_durable_sequence() const { return durable_sequence_.load(std::memory_order_acquire); }
+    bool wait_for_durable(uint64_t sequence, std::chrono::milliseconds timeout);
+    bool flush(std::chrono::milliseconds timeout = std::chrono::milliseconds(5000));
+
+    // Read durable records [from_sequence, from_sequence + max_records) into rows; returns records read
+    size_t read_batch(uint64_t from_sequence, size_t max_records, PersistenceBatch& batch) const;
+
+    // Visit durable records in sequence order starting at from_sequence; returns records visited
+    size_t for_each_record(uint64_t from_sequence, size_t max_records, const RecordVisitor& visitor) const;
+    uint64_t get_first_sequence() const;   // Oldest sequence still on disk
+
+    // Compaction checkpoint - everything up to the sequence is folded into SQLite
+    uint64_t get_compacted_sequence() const { return compacted_sequence_.load(std::memory_order_acquire); }
+    bool mark_compacted(uint64_t sequence);
+
+    // Latest engine snapshot covers everything up to the sequence (see Config::retain_for_snapshots)
+    void mark_snapshot(uint64_t sequence);
+    uint64_t get_snapshot_sequence() const { return snapshot_sequence_.load(std::memory_order_acquire); }
+
+    Statistics get_statistics() const;
+    size_t get_segment_count() const;
+    const Config& get_config() const { return config_; }
+
+    static std::uint32_t crc32(const void* data, size_t size);
+
+    // Record encoding, shared with engine snapshots; encoding fails when an id does not fit
+    static bool encode_order(const Order& order, JournalRecord& record);
+    static bool encode_trade(const Trade& trade, JournalRecord& record);
+    static bool encode_position(const Position& position, JournalRecord& record);
+    static std::shared_ptr<Order> decode_order(const JournalRecord& record);
+    static std::shared_ptr<Trade> decode_trade(const JournalRecord& record);
+    static std::shared_ptr<Position> decode_position(const JournalRecord& record);
+
+private:
+    struct Segment {
+        uint64_t first_sequence;
+        std::string path;
+    };
+
+    Config config_;
+    uint64_t records_per_segment_;
+
+    std::atomic<bool> is_open_;
+    std::atomic<bool> failed_;
+
+    // Appenders stage records under append_mutex_; the writer swaps the whole batch out
+    std::mutex append_mutex_;
+    std::condition_variable writer_cv_;
+    std::condition_variable durable_cv_;
+    std::vector<JournalRecord> pending_;
+    bool stop_requested_;
+    std::thread writer_thread_;
+
+    std::atomic<uint64_t> appended_sequence_;
+    std::atomic<uint64_t> durable_sequence_;
+    std::atomic<uint64_t> compacted_sequence_;
+    std::atomic<uint64_t> snapshot_sequence_;
+
+    // Segment files, oldest first; the last one is being written
+    mutable std::mutex segments_mutex_;
+    std::vector<Segment> segments_;
+    int active_fd_;
+    uint64_t active_records_;    // Writer thread only
+
+    // Statistics
+    std::atomic<uint64_t> records_appended_;
+    std::atomic<uint64_t> group_commits_;
+    std::atomic<uint64_t> bytes_written_;
+    std::atomic<uint64_t> segments_created_;
+    std::atomic<uint64_t> segments_removed_;
+
+    uint64_t append(JournalRecord& record);
+    void writer_loop();
+    bool write_records(const std::vector<JournalRecord>& records);
+    bool open_segment(uint64_t first_sequence);
+    uint64_t recover_segment(const Segment& segment);
+
+    std::string segment_path(uint64_t first_sequence) const;
+    std::string checkpoint_path() const;
+    bool load_checkpoint();
+    void remove_obsolete_segments();   // Caller holds segments_mutex_
+    static void decode(const JournalRecord& record, PersistenceBatch& batch);
+};
+
+} // namespace trading
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <share.h>
+#include <sys/stat.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace trading {
+
+/**
+ * Positional file I/O used by the journal and snapshot files.
+ * Writes go to explicit offsets; sync_file is fdatasync (fsync/_commit elsewhere).
+ */
+namespace file_io {
+
+#ifdef _WIN32
+inline int open_file(const std::string& path, bool writable) {
+    int fd = -1;
+    int flags = (writable ? (_O_RDWR | _O_CREAT) : _O_RDONLY) | _O_BINARY;
+    _sopen_s(&fd, path.c_str(), flags, _SH_DENYNO, _S_IREAD | _S_IWRITE);
+    return fd;
+}
+
+inline bool write_at(int fd, const void* data, size_t size, std::uint64_t offset) {
+    if (_lseeki64(fd, static_cast<long long>(offset), SEEK_SET) < 0) {
+        return false;
+    }
+    return _write(fd, data, static_cast<unsigned int>(size)) == static_cast<int>(size);
+}
+
+inline bool read_at(int fd, void* data, size_t size, std::uint64_t offset) {
+    if (_lseeki64(fd, static_cast<long long>(offset), SEEK_SET) < 0) {
+        return false;
+    }
+    return _read(fd, data, static_cast<unsigned int>(size)) == static_cast<int>(size);
+}
+
+inline bool sync_file(int fd) { return _commit(fd) == 0; }
+inline bool preallocate(int fd, std::uint64_t size) { return _chsize_s(fd, static_cast<long long>(size)) == 0; }
+inline void sync_directory(const std::string&) {}
+inline void close_file(int fd) { _close(fd); }
+#else
+inline int open_file(const std::string& path, bool writable) {
+    int flags = (writable ? (O_RDWR | O_CREAT) : O_RDONLY) | O_CLOEXEC;
+    return ::open(path.c_str(), flags, 0644);
+}
+
+inline bool write_at(int fd, const void* data, size_t size, std::uint64_t offset) {
+    const auto* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t written = ::pwrite(fd, bytes, size, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<std::uint64_t>(written);
+    }
+    return true;
+}
+
+inline bool read_at(int fd, void* data, size_t size, std::uint64_t offset) {
+    auto* bytes = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t count = ::pread(fd, bytes, size, static_cast<off_t>(offset));
+        if (count < 0 && errno == EINTR) continue;
+        if (count <= 0) return false;
+        bytes += count;
+        size -= static_cast<size_t>(count);
+        offset += static_cast<std::uint64_t>(count);
+    }
+    return true;
+}
+
+inline bool sync_file(int fd) {
+#ifdef __APPLE__
+    return ::fsync(fd) == 0;
+#else
+    return ::fdatasync(fd) == 0;
+#endif
+}
+
+inline bool preallocate(int fd, std::uint64_t size) {
+#ifdef __linux__
+    return ::posix_fallocate(fd, 0, static_cast<off_t>(size)) == 0;
+#else
+    return ::ftruncate(fd, static_cast<off_t>(size)) == 0;
+#endif
+}
+
+// New segment files are only durable once their directory entry is
+inline void sync_directory(const std::string& directory) {
+    int fd = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+}
+
+inline void close_file(int fd) { ::close(fd); }
+#endif
+
+} // namespace file_io
+
+} // namespace trading
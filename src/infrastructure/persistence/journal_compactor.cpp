@@ -0,0 +1,171 @@
+#include "journal_compactor.hpp"
+#include "../../utils/logging.hpp"
+#include "../../utils/exceptions.hpp"
+
+#include <string>
+#include <unordered_map>
+
+namespace trading {
+
+namespace {
+
+// Keep only the last row per key, preserving the position of its first occurrence
+template<typename Row, typename KeyFn>
+void keep_latest(std::vector<Row>& rows, KeyFn key_of) {
+    std::unordered_map<std::string, size_t> index;
+    index.reserve(rows.size());
+    size_t kept = 0;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        auto [it, inserted] = index.emplace(key_of(rows[i]), kept);
+        if (inserted) {
+            if (kept != i) {
+                rows[kept] = std::move(rows[i]);
+            }
+            ++kept;
+        } else {
+            rows[it->second] = std::move(rows[i]);
+        }
+    }
+    rows.resize(kept);
+}
+
+} // namespace
+
+JournalCompactor::JournalCompactor(std::shared_ptr<EventJournal> journal,
+                                   std::shared_ptr<SQLiteService> persistence_service,
+                                   const Config& config)
+    : JournalCompactor(
+          std::move(journal),
+          [service = std::move(persistence_service)](const PersistenceBatch& batch) {
+              return service && service->save_batch(batch);
+          },
+          config) {
+}
+
+JournalCompactor::JournalCompactor(std::shared_ptr<EventJournal> journal, BatchSink sink, const Config& config)
+    : journal_(std::move(journal))
+    , sink_(std::move(sink))
+    , config_(config)
+    , running_(false)
+    , stop_requested_(false)
+    , records_compacted_(0)
+    , rows_written_(0)
+    , passes_(0)
+    , failed_batches_(0) {
+
+    if (!journal_ || !sink_) {
+        throw TradingException("Journal compactor requires a journal and a sink");
+    }
+    if (config_.batch_size == 0) {
+        config_.batch_size = 1;
+    }
+}
+
+JournalCompactor::~JournalCompactor() {
+    stop();
+}
+
+bool JournalCompactor::start() {
+    if (running_.exchange(true)) {
+        return true;
+    }
+
+    // Fold whatever a previous run left behind before callers query SQLite
+    size_t backlog = compact_once();
+    if (backlog > 0) {
+        Logger::info("JournalCompactor: Folded " + std::to_string(backlog) + " journal records on startup");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_requested_ = false;
+    }
+    compactor_thread_ = std::thread(&JournalCompactor::compactor_loop, this);
+    return true;
+}
+
+void JournalCompactor::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_requested_ = true;
+    }
+    cv_.notify_all();
+    if (compactor_thread_.joinable()) {
+        compactor_thread_.join();
+    }
+
+    compact_once();
+    Logger::info("JournalCompactor: Stopped at sequence " + std::to_string(journal_->get_compacted_sequence()));
+}
+
+size_t JournalCompactor::compact_once() {
+    std::lock_guard<std::mutex> pass_lock(pass_mutex_);
+    passes_.fetch_add(1, std::memory_order_relaxed);
+
+    size_t folded = 0;
+    PersistenceBatch batch;
+    for (;;) {
+        uint64_t from_sequence = journal_->get_compacted_sequence() + 1;
+        batch.clear();
+        size_t records = journal_->read_batch(from_sequence, config_.batch_size, batch);
+        if (records == 0) {
+            break;
+        }
+
+        fold(batch);
+        bool committed = false;
+        try {
+            committed = sink_(batch);
+        } catch (const std::exception& e) {
+            Logger::error("JournalCompactor: Batch commit threw: " + std::string(e.what()));
+        }
+        if (!committed) {
+            // The checkpoint stays put, so the same records are retried next pass
+            failed_batches_.fetch_add(1, std::memory_order_relaxed);
+            Logger::error("JournalCompactor: Failed to fold journal records from sequence " +
+                          std::to_string(from_sequence));
+            break;
+        }
+        if (!journal_->mark_compacted(from_sequence + records - 1)) {
+            break;
+        }
+
+        folded += records;
+        records_compacted_.fetch_add(records, std::memory_order_relaxed);
+        rows_written_.fetch_add(batch.size(), std::memory_order_relaxed);
+    }
+    return folded;
+}
+
+JournalCompactor::Statistics JournalCompactor::get_statistics() const {
+    Statistics stats;
+    stats.records_compacted = records_compacted_.load(std::memory_order_relaxed);
+    stats.rows_written = rows_written_.load(std::memory_order_relaxed);
+    stats.passes = passes_.load(std::memory_order_relaxed);
+    stats.failed_batches = failed_batches_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void JournalCompactor::compactor_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_requested_) {
+        cv_.wait_for(lock, config_.interval, [this] { return stop_requested_; });
+        if (stop_requested_) {
+            break;
+        }
+        lock.unlock();
+        compact_once();
+        lock.lock();
+    }
+}
+
+void JournalCompactor::fold(PersistenceBatch& batch) {
+    keep_latest(batch.orders, [](const OrderRow& row) -> const std::string& { return row.order_id; });
+    keep_latest(batch.positions, [](const PositionRow& row) -> const std::string& { return row.instrument_symbol; });
+}
+
+} // namespace trading
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "event_journal.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace trading {
+
+/**
+ * Journal Compactor
+ * Background thread that folds durable journal records into the SQLite tables
+ * for querying, then advances the journal's compaction checkpoint. Within each
+ * batch only the latest row per order and per position is written.
+ */
+class JournalCompactor {
+public:
+    using BatchSink = std::function<bool(const PersistenceBatch&)>;
+
+    struct Config {
+        size_t batch_size = 4096;
+        std::chrono::milliseconds interval{1000};
+    };
+
+    struct Statistics {
+        uint64_t records_compacted = 0;
+        uint64_t rows_written = 0;
+        uint64_t passes = 0;
+        uint64_t failed_batches = 0;
+    };
+
+    JournalCompactor(std::shared_ptr<EventJournal> journal,
+                     std::shared_ptr<SQLiteService> persistence_service,
+                     const Config& config);
+    JournalCompactor(std::shared_ptr<EventJournal> journal, BatchSink sink, const Config& config);
+    ~JournalCompactor();
+
+    // Non-copyable
+    JournalCompactor(const JournalCompactor&) = delete;
+    JournalCompactor& operator=(const JournalCompactor&) = delete;
+
+    // Lifecycle - start() folds any backlog before returning; stop() runs a final pass
+    bool start();
+    void stop();
+    bool is_running() const { return running_.load(); }
+
+    // Fold every durable record not yet compacted; returns the number of journal records folded
+    size_t compact_once();
+
+    Statistics get_statistics() const;
+
+private:
+    std::shared_ptr<EventJournal> journal_;
+    BatchSink sink_;
+    Config config_;
+
+    std::atomic<bool> running_;
+    bool stop_requested_;
+    std::mutex mutex_;          // Guards stop_requested_
+    std::mutex pass_mutex_;     // Serialises compaction passes
+    std::condition_variable cv_;
+    std::thread compactor_thread_;
+
+    // Statistics
+    std::atomic<uint64_t> records_compacted_;
+    std::atomic<uint64_t> rows_written_;
+    std::atomic<uint64_t> passes_;
+    std::atomic<uint64_t> failed_batches_;
+
+    void compactor_loop();
+    static void fold(PersistenceBatch& batch);
+};
+
+} // namespace trading
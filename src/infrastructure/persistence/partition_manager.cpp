@@ -0,0 +1,619 @@
+#include "partition_manager.hpp"
+#include "../../utils/logging.hpp"
+#include "../../utils/exceptions.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace trading {
+
+namespace {
+
+constexpr const char* PARTITION_PREFIX = "trading-";
+constexpr const char* PARTITION_SUFFIX = ".db";
+constexpr size_t PARTITION_NAME_LENGTH = 19;   // trading-YYYYMMDD.db
+
+// Parse trading-YYYYMMDD.db back into a day number
+bool parse_partition_name(const std::string& name, std::int64_t& day) {
+    if (name.size() != PARTITION_NAME_LENGTH || name.rfind(PARTITION_PREFIX, 0) != 0 ||
+        name.compare(16, 3, PARTITION_SUFFIX) != 0) {
+        return false;
+    }
+    int year = 0;
+    unsigned month = 0;
+    unsigned day_of_month = 0;
+    const char* digits = name.data() + 8;
+    if (std::from_chars(digits, digits + 4, year).ptr != digits + 4 ||
+        std::from_chars(digits + 4, digits + 6, month).ptr != digits + 6 ||
+        std::from_chars(digits + 6, digits + 8, day_of_month).ptr != digits + 8) {
+        return false;
+    }
+    std::chrono::year_month_day date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day_of_month}};
+    if (!date.ok()) {
+        return false;
+    }
+    day = std::chrono::sys_days(date).time_since_epoch().count();
+    return true;
+}
+
+// Read-only URI for ATTACH; '?', '#' and '%' would otherwise end or escape the path
+std::string read_only_uri(const std::filesystem::path& path) {
+    std::string generic = std::filesystem::absolute(path).generic_string();
+    std::string uri = "file:";
+    if (generic.empty() || generic[0] != '/') {
+        uri += '/';    // Windows drive letter
+    }
+    for (char c : generic) {
+        if (c == '?' || c == '#' || c == '%') {
+            char escaped[4];
+            std::snprintf(escaped, sizeof(escaped), "%%%02X", static_cast<unsigned>(static_cast<unsigned char>(c)));
+            uri += escaped;
+        } else {
+            uri += c;
+        }
+    }
+    return uri + "?mode=ro";
+}
+
+std::string schema_name(std::int64_t day) {
+    // "p" + YYYYMMDD, always a plain identifier
+    return "p" + DayPartitionManager::partition_file_name(day).substr(8, 8);
+}
+
+ScanResult scan_hot(SQLiteService& service, const HistoryQuery& query, const TradeRowVisitor& visitor) {
+    return service.scan_trades(query, visitor);
+}
+
+ScanResult scan_hot(SQLiteService& service, const HistoryQuery& query, const OrderRowVisitor& visitor) {
+    return service.scan_orders(query, visitor);
+}
+
+ScanResult scan_cold(sqlite3* const& db, std::mutex& mutex, const std::string& schema,
+                     const HistoryQuery& query, const TradeRowVisitor& visitor) {
+    return scan_trade_rows(db, mutex, schema, query, visitor);
+}
+
+ScanResult scan_cold(sqlite3* const& db, std::mutex& mutex, const std::string& schema,
+                     const HistoryQuery& query, const OrderRowVisitor& visitor) {
+    return scan_order_rows(db, mutex, schema, query, visitor);
+}
+
+std::int64_t row_time(const TradeRow& row) { return row.execution_time; }
+std::int64_t row_time(const OrderRow& row) { return row.created_time; }
+const std::string& row_id(const TradeRow& row) { return row.trade_id; }
+const std::string& row_id(const OrderRow& row) { return row.order_id; }
+
+// Scan order; ids compare bytewise, as SQLite's default collation does
+template<typename Row>
+bool row_key_less(const Row& lhs, const Row& rhs) {
+    if (row_time(lhs) != row_time(rhs)) {
+        return row_time(lhs) < row_time(rhs);
+    }
+    return row_id(lhs) < row_id(rhs);
+}
+
+HistoryQuery whole_day(std::int64_t day) {
+    HistoryQuery query;
+    query.from = std::chrono::sys_days(std::chrono::days(day));
+    query.to = query.from + std::chrono::hours(24) - std::chrono::seconds(1);
+    return query;
+}
+
+} // namespace
+
+DayPartitionManager::Config DayPartitionManager::from_config(const PersistenceConfig& config) {
+    Config partition_config;
+    partition_config.directory = config.partition_directory;
+    partition_config.retention_days = config.partition_retention_days;
+    partition_config.archive_directory = config.partition_archive_path;
+    return partition_config;
+}
+
+std::int64_t DayPartitionManager::day_of(std::chrono::system_clock::time_point time) {
+    return static_cast<std::int64_t>(std::chrono::floor<std::chrono::days>(time).time_since_epoch().count());
+}
+
+std::string DayPartitionManager::partition_file_name(std::int64_t day) {
+    std::chrono::year_month_day date{std::chrono::sys_days(std::chrono::days(day))};
+    char name[32];
+    std::snprintf(name, sizeof(name), "%s%04d%02u%02u%s", PARTITION_PREFIX, static_cast<int>(date.year()),
+                  static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()), PARTITION_SUFFIX);
+    return name;
+}
+
+DayPartitionManager::DayPartitionManager(std::shared_ptr<SQLiteService> hot_service, const Config& config, Clock clock)
+    : hot_service_(std::move(hot_service))
+    , config_(config)
+    , clock_(std::move(clock))
+    , hot_day_(std::numeric_limits<std::int64_t>::min())
+    , reader_(nullptr)
+    , running_(false)
+    , stop_requested_(false) {
+
+    if (!hot_service_) {
+        throw TradingException("Day partition manager requires a persistence service");
+    }
+    if (!clock_) {
+        throw TradingException("Day partition manager requires a clock");
+    }
+    if (config_.max_attached == 0) {
+        config_.max_attached = 1;
+    }
+    if (config_.check_interval.count() <= 0) {
+        config_.check_interval = std::chrono::seconds(1);
+    }
+}
+
+DayPartitionManager::~DayPartitionManager() {
+    stop();
+    std::lock_guard<std::mutex> lock(query_mutex_);
+    close_reader();
+}
+
+bool DayPartitionManager::open() {
+    {
+        std::lock_guard<std::mutex> lock(roll_mutex_);
+        const std::int64_t today = day_of(clock_());
+        std::error_code ec;
+        const bool fresh = !std::filesystem::exists(partition_path(today), ec);
+        if (!switch_to_day(today, false)) {
+            return false;
+        }
+        if (fresh) {
+            seed_positions(today);
+        }
+    }
+    apply_retention();
+    return true;
+}
+
+bool DayPartitionManager::roll_if_needed() {
+    const std::int64_t today = day_of(clock_());
+    if (today == hot_day_.load()) {
+        return true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(roll_mutex_);
+        const std::int64_t previous = hot_day_.load();
+        if (today == previous) {
+            return true;
+        }
+        if (today < previous) {
+            Logger::warn("DayPartitionManager: Clock is behind the hot partition, staying on " +
+                         partition_file_name(previous));
+            return true;
+        }
+        if (!switch_to_day(today, true)) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+            ++statistics_.rollovers;
+        }
+        Logger::info("DayPartitionManager: Rolled over from " + partition_file_name(previous) + " to " +
+                     partition_file_name(today));
+    }
+    apply_retention();
+    return true;
+}
+
+bool DayPartitionManager::start() {
+    if (running_.exchange(true)) {
+        return true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_requested_.store(false);
+    }
+    check_thread_ = std::thread(&DayPartitionManager::check_loop, this);
+    Logger::info("DayPartitionManager: Started - partitions in " + config_.directory + ", retention " +
+                 (config_.retention_days > 0 ? std::to_string(config_.retention_days) + " days" : "unlimited"));
+    return true;
+}
+
+void DayPartitionManager::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_requested_.store(true);
+    }
+    cv_.notify_all();
+    if (check_thread_.joinable()) {
+        check_thread_.join();
+    }
+    Logger::info("DayPartitionManager: Stopped");
+}
+
+size_t DayPartitionManager::apply_retention() {
+    if (config_.retention_days <= 0 || hot_day_.load() == std::numeric_limits<std::int64_t>::min()) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(roll_mutex_);
+    const std::int64_t oldest_kept = hot_day_.load() - config_.retention_days + 1;
+    size_t removed = 0;
+
+    for (std::int64_t day : list_partitions()) {
+        if (day >= oldest_kept) {
+            break;
+        }
+        {
+            std::lock_guard<std::mutex> query_lock(query_mutex_);
+            detach(day);
+        }
+
+        const std::filesystem::path path = partition_path(day);
+        std::error_code ec;
+        bool archived = false;
+        if (!config_.archive_directory.empty()) {
+            std::filesystem::create_directories(config_.archive_directory, ec);
+            const auto target = std::filesystem::path(config_.archive_directory) / path.filename();
+            std::filesystem::rename(path, target, ec);
+            if (ec) {
+                // Archive on another filesystem
+                ec.clear();
+                std::filesystem::copy_file(path, target, std::filesystem::copy_options::overwrite_existing, ec);
+            }
+            if (ec) {
+                Logger::error("DayPartitionManager: Failed to archive " + path.string() + ": " + ec.message());
+                continue;
+            }
+            archived = true;
+        }
+
+        for (const char* suffix : {"", "-wal", "-shm"}) {
+            std::filesystem::remove(path.string() + suffix, ec);
+        }
+        std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+        if (archived) {
+            ++statistics_.partitions_archived;
+            Logger::info("DayPartitionManager: Archived " + path.filename().string() + " to " + config_.archive_directory);
+        } else {
+            ++statistics_.partitions_deleted;
+            Logger::info("DayPartitionManager: Deleted expired partition " + path.filename().string());
+        }
+        ++removed;
+    }
+    return removed;
+}
+
+std::vector<std::int64_t> DayPartitionManager::list_partitions() const {
+    std::vector<std::int64_t> days;
+    std::error_code ec;
+    if (!std::filesystem::is_directory(config_.directory, ec)) {
+        return days;
+    }
+    for (const auto& entry : std::filesystem::directory_iterator(config_.directory, ec)) {
+        std::int64_t day = 0;
+        if (parse_partition_name(entry.path().filename().string(), day)) {
+            days.push_back(day);
+        }
+    }
+    std::sort(days.begin(), days.end());
+    return days;
+}
+
+std::string DayPartitionManager::partition_path(std::int64_t day) const {
+    return (std::filesystem::path(config_.directory) / partition_file_name(day)).string();
+}
+
+ScanResult DayPartitionManager::scan_trades(const HistoryQuery& query, const TradeRowVisitor& visitor) {
+    return scan_partitions(query, visitor);
+}
+
+ScanResult DayPartitionManager::scan_orders(const HistoryQuery& query, const OrderRowVisitor& visitor) {
+    return scan_partitions(query, visitor);
+}
+
+std::vector<std::shared_ptr<Trade>> DayPartitionManager::load_trades_by_date(std::chrono::system_clock::time_point date) {
+    const std::int64_t day = day_of(date);
+    if (day == hot_day_.load()) {
+        return hot_service_->load_trades_by_date(date);
+    }
+
+    std::vector<std::shared_ptr<Trade>> trades;
+    scan_partitions<TradeRow>(whole_day(day), [&trades](const TradeRow& row) {
+        if (auto trade = SQLiteService::row_to_trade(row)) {
+            trades.push_back(std::move(trade));
+        }
+        return true;
+    });
+    // Newest first, as SQLiteService returns them
+    std::reverse(trades.begin(), trades.end());
+    return trades;
+}
+
+std::vector<std::shared_ptr<Order>> DayPartitionManager::load_orders_by_date(std::chrono::system_clock::time_point date) {
+    const std::int64_t day = day_of(date);
+    if (day == hot_day_.load()) {
+        return hot_service_->load_orders_by_date(date);
+    }
+
+    std::vector<std::shared_ptr<Order>> orders;
+    scan_partitions<OrderRow>(whole_day(day), [&orders](const OrderRow& row) {
+        if (auto order = SQLiteService::row_to_order(row)) {
+            orders.push_back(std::move(order));
+        }
+        return true;
+    });
+    std::reverse(orders.begin(), orders.end());
+    return orders;
+}
+
+DayPartitionManager::Statistics DayPartitionManager::get_statistics() const {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return statistics_;
+}
+
+void DayPartitionManager::check_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_requested_.load()) {
+        // Wake at the day boundary as well as every check_interval
+        const auto now = clock_();
+        const auto next_day = std::chrono::sys_days(std::chrono::days(day_of(now) + 1));
+        const auto wait = std::min<std::chrono::system_clock::duration>(config_.check_interval, next_day - now);
+        if (cv_.wait_for(lock, wait, [this] { return stop_requested_.load(); })) {
+            break;
+        }
+
+        lock.unlock();
+        roll_if_needed();
+        lock.lock();
+    }
+}
+
+bool DayPartitionManager::switch_to_day(std::int64_t day, bool carry_positions) {
+    const std::string path = partition_path(day);
+    if (hot_service_->is_available() && hot_service_->get_database_path() == path) {
+        hot_day_.store(day);
+        return true;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(config_.directory, ec);
+    {
+        // Never have the hot file attached read-only at the same time
+        std::lock_guard<std::mutex> lock(query_mutex_);
+        detach(day);
+    }
+    if (!hot_service_->reopen(path, carry_positions)) {
+        Logger::error("DayPartitionManager: Failed to open partition " + path);
+        return false;
+    }
+    hot_day_.store(day);
+    return true;
+}
+
+bool DayPartitionManager::seed_positions(std::int64_t day) {
+    auto days = list_partitions();
+    auto it = std::lower_bound(days.begin(), days.end(), day);
+    if (it == days.begin()) {
+        return true;
+    }
+    const std::int64_t source_day = *std::prev(it);
+
+    PersistenceBatch batch;
+    {
+        std::lock_guard<std::mutex> lock(query_mutex_);
+        std::string schema;
+        if (!attach(source_day, schema)) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> reader_lock(reader_mutex_);
+        const std::string sql = "SELECT instrument_symbol, quantity, average_price, realized_pnl, unrealized_pnl, "
+                                "last_updated FROM " + schema + ".positions";
+        sqlite3_stmt* statement = nullptr;
+        if (sqlite3_prepare_v2(reader_, sql.c_str(), -1, &statement, nullptr) != SQLITE_OK) {
+            Logger::error("DayPartitionManager: Failed to read positions from " + partition_file_name(source_day) +
+                          ": " + sqlite3_errmsg(reader_));
+            sqlite3_finalize(statement);
+            return false;
+        }
+        while (sqlite3_step(statement) == SQLITE_ROW) {
+            PositionRow row;
+            const auto* symbol = sqlite3_column_text(statement, 0);
+            row.instrument_symbol = symbol ? reinterpret_cast<const char*>(symbol) : "";
+            row.quantity = sqlite3_column_double(statement, 1);
+            row.average_price = sqlite3_column_double(statement, 2);
+            row.realized_pnl = sqlite3_column_double(statement, 3);
+            row.unrealized_pnl = sqlite3_column_double(statement, 4);
+            row.last_updated = sqlite3_column_int64(statement, 5);
+            batch.positions.push_back(std::move(row));
+        }
+        sqlite3_finalize(statement);
+    }
+
+    if (!hot_service_->save_batch(batch)) {
+        return false;
+    }
+    Logger::info("DayPartitionManager: Seeded " + std::to_string(batch.positions.size()) + " positions from " +
+                 partition_file_name(source_day));
+    return true;
+}
+
+bool DayPartitionManager::attach(std::int64_t day, std::string& schema) {
+    schema = schema_name(day);
+    auto it = std::find(attached_days_.begin(), attached_days_.end(), day);
+    if (it != attached_days_.end()) {
+        attached_days_.splice(attached_days_.end(), attached_days_, it);
+        return true;
+    }
+
+    const std::string path = partition_path(day);
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec)) {
+        return false;
+    }
+
+    if (!reader_) {
+        // In-memory main database; URI filenames let ATTACH open partitions read-only
+        sqlite3* reader = nullptr;
+        if (sqlite3_open_v2(":memory:", &reader, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI,
+                            nullptr) != SQLITE_OK) {
+            Logger::error("DayPartitionManager: Failed to open reader connection: " +
+                          std::string(reader ? sqlite3_errmsg(reader) : "out of memory"));
+            sqlite3_close(reader);
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(reader_mutex_);
+        reader_ = reader;
+    }
+
+    while (attached_days_.size() >= config_.max_attached) {
+        detach(attached_days_.front());
+    }
+
+    std::lock_guard<std::mutex> lock(reader_mutex_);
+    const std::string uri = read_only_uri(path);
+    const std::string sql = "ATTACH DATABASE ?1 AS " + schema;
+    sqlite3_stmt* statement = nullptr;
+    int rc = sqlite3_prepare_v2(reader_, sql.c_str(), -1, &statement, nullptr);
+    if (rc == SQLITE_OK) {
+        sqlite3_bind_text(statement, 1, uri.c_str(), static_cast<int>(uri.size()), SQLITE_STATIC);
+        rc = sqlite3_step(statement);
+    }
+    sqlite3_finalize(statement);
+    if (rc != SQLITE_DONE) {
+        Logger::error("DayPartitionManager: Failed to attach " + path + ": " + sqlite3_errmsg(reader_));
+        return false;
+    }
+
+    attached_days_.push_back(day);
+    std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+    ++statistics_.partitions_attached;
+    return true;
+}
+
+void DayPartitionManager::detach(std::int64_t day) {
+    auto it = std::find(attached_days_.begin(), attached_days_.end(), day);
+    if (it == attached_days_.end()) {
+        return;
+    }
+    attached_days_.erase(it);
+
+    std::lock_guard<std::mutex> lock(reader_mutex_);
+    const std::string sql = "DETACH DATABASE " + schema_name(day);
+    char* error = nullptr;
+    if (sqlite3_exec(reader_, sql.c_str(), nullptr, nullptr, &error) != SQLITE_OK) {
+        Logger::warn("DayPartitionManager: Failed to detach " + partition_file_name(day) + ": " +
+                     std::string(error ? error : "unknown"));
+        sqlite3_free(error);
+    }
+}
+
+void DayPartitionManager::close_reader() {
+    std::lock_guard<std::mutex> lock(reader_mutex_);
+    attached_days_.clear();
+    if (reader_) {
+        sqlite3_close(reader_);
+        reader_ = nullptr;
+    }
+}
+
+template<typename Row>
+ScanResult DayPartitionManager::scan_partitions(const HistoryQuery& query,
+                                                const std::function<bool(const Row&)>& visitor) {
+    ScanResult result;
+    result.next = query.resume_after;
+    if (!visitor) {
+        result.ok = false;
+        return result;
+    }
+
+    // An order's later state is written to later sessions' files, so order scans read every partition from the
+    // first day in range onwards; trades are only ever in the partition of the day they executed
+    const std::int64_t from_day = day_of(query.from);
+    const std::int64_t to_day = std::is_same_v<Row, OrderRow> ? std::numeric_limits<std::int64_t>::max()
+                                                              : day_of(query.to);
+    std::vector<PartitionCursor<Row>> cursors;
+    for (std::int64_t day : list_partitions()) {
+        if (day >= from_day && day <= to_day) {
+            cursors.push_back(PartitionCursor<Row>{day, query.resume_after, {}, 0, false});
+        }
+    }
+
+    // Merge the partitions in (time, id) order, one page per partition in memory. A row in several partitions
+    // (an order carried into later sessions) has the same key in each and is delivered once, from the newest.
+    while (query.max_rows == 0 || result.rows < query.max_rows) {
+        PartitionCursor<Row>* newest = nullptr;
+        for (auto& cursor : cursors) {
+            if (cursor.position == cursor.page.size() && !cursor.complete && !fetch_page(cursor, query)) {
+                result.ok = false;
+                return result;
+            }
+            if (cursor.position == cursor.page.size()) {
+                continue;
+            }
+            // Cursors are in day order, so on equal keys the later cursor wins
+            if (!newest || !row_key_less(newest->head(), cursor.head())) {
+                newest = &cursor;
+            }
+        }
+        if (!newest) {
+            result.complete = true;
+            return result;
+        }
+
+        const Row& row = newest->head();
+        for (auto& cursor : cursors) {
+            if (&cursor != newest && cursor.position < cursor.page.size() && !row_key_less(row, cursor.head())) {
+                ++cursor.position;   // Older copy of the same row
+            }
+        }
+        ++newest->position;
+
+        ++result.rows;
+        result.next.time = row_time(row);
+        result.next.id = row_id(row);
+        if (!visitor(row)) {
+            return result;
+        }
+    }
+    return result;
+}
+
+template<typename Row>
+bool DayPartitionManager::fetch_page(PartitionCursor<Row>& cursor, const HistoryQuery& query) {
+    HistoryQuery page_query = query;
+    page_query.resume_after = cursor.next;
+    page_query.max_rows = std::max<size_t>(1, query.page_size);
+    cursor.page.clear();
+    cursor.position = 0;
+    const auto collect = [&cursor](const Row& row) {
+        cursor.page.push_back(row);
+        return true;
+    };
+
+    // Held for one page so rollover and retention never detach a partition mid-read; the caller's
+    // visitor runs after it is released
+    std::lock_guard<std::mutex> lock(query_mutex_);
+    ScanResult page;
+    if (cursor.day == hot_day_.load()) {
+        page = scan_hot(*hot_service_, page_query, std::function<bool(const Row&)>(collect));
+    } else {
+        std::string schema;
+        if (!attach(cursor.day, schema)) {
+            return false;
+        }
+        page = scan_cold(reader_, reader_mutex_, schema, page_query, std::function<bool(const Row&)>(collect));
+    }
+    if (!page.ok) {
+        return false;
+    }
+    cursor.next = page.next;
+    cursor.complete = page.complete || cursor.page.empty();
+    return true;
+}
+
+} // namespace trading
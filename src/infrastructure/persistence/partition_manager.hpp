@@ -0,0 +1,144 @@
+#pragma once
+
+#include "sqlite_service.hpp"
+#include "utils/config.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace trading {
+
+/**
+ * Day Partition Manager
+ * Keeps one database file per UTC trading day, <directory>/trading-YYYYMMDD.db.
+ * Today's partition is the hot file behind the shared SQLiteService, which is
+ * switched to the next day's file at rollover with positions carried across, so
+ * writes always go to a small file. Earlier days are attached read-only to a
+ * separate reader connection only when a query's date range covers them; the
+ * hot connection is never locked by historical reads.
+ *
+ * Rows belong to the session that wrote them: an order created yesterday and
+ * filled today is in both partitions, with today's state in today's file.
+ * Scans merge the partitions into one (time, id) order and deliver such an
+ * order once, with the newest partition's state.
+ */
+class DayPartitionManager {
+public:
+    using Clock = std::function<std::chrono::system_clock::time_point()>;
+
+    struct Config {
+        std::string directory = "./data/partitions";
+        int retention_days = 0;                 // 0 = keep every partition
+        std::string archive_directory;          // Expired partitions move here; empty = delete them
+        size_t max_attached = 8;                // SQLite allows 10 attached databases by default
+        std::chrono::seconds check_interval{30};
+    };
+
+    struct Statistics {
+        uint64_t rollovers = 0;
+        uint64_t partitions_attached = 0;
+        uint64_t partitions_archived = 0;
+        uint64_t partitions_deleted = 0;
+    };
+
+    static Config from_config(const PersistenceConfig& config);
+
+    // Days since the Unix epoch of the UTC day containing time
+    static std::int64_t day_of(std::chrono::system_clock::time_point time);
+    static std::string partition_file_name(std::int64_t day);
+
+    DayPartitionManager(std::shared_ptr<SQLiteService> hot_service, const Config& config,
+                        Clock clock = &std::chrono::system_clock::now);
+    ~DayPartitionManager();
+
+    // Non-copyable
+    DayPartitionManager(const DayPartitionManager&) = delete;
+    DayPartitionManager& operator=(const DayPartitionManager&) = delete;
+
+    // Point the hot service at today's partition, seeding positions from the latest
+    // earlier partition when today's file is new, then apply retention
+    bool open();
+
+    // Move the hot service to the current day's file if the day has changed
+    bool roll_if_needed();
+
+    // Background rollover checks every check_interval
+    bool start();
+    void stop();
+    bool is_running() const { return running_.load(); }
+
+    // Archive or delete partitions older than retention_days; returns how many were removed
+    size_t apply_retention();
+
+    // Days with a partition file, oldest first
+    std::vector<std::int64_t> list_partitions() const;
+    std::string partition_path(std::int64_t day) const;
+    std::int64_t hot_day() const { return hot_day_.load(); }
+
+    // History across partitions, touching only the days the query's range covers
+    ScanResult scan_trades(const HistoryQuery& query, const TradeRowVisitor& visitor);
+    ScanResult scan_orders(const HistoryQuery& query, const OrderRowVisitor& visitor);
+    std::vector<std::shared_ptr<Trade>> load_trades_by_date(std::chrono::system_clock::time_point date);
+    std::vector<std::shared_ptr<Order>> load_orders_by_date(std::chrono::system_clock::time_point date);
+
+    Statistics get_statistics() const;
+
+private:
+    std::shared_ptr<SQLiteService> hot_service_;
+    Config config_;
+    Clock clock_;
+    std::atomic<std::int64_t> hot_day_;
+
+    // Reader connection with cold partitions attached, least recently used first
+    std::mutex query_mutex_;             // Serialises attach, detach and page reads
+    std::mutex reader_mutex_;            // Held by scans for one page at a time
+    sqlite3* reader_;
+    std::list<std::int64_t> attached_days_;
+
+    std::atomic<bool> running_;
+    std::atomic<bool> stop_requested_;
+    std::mutex mutex_;                   // Pairs with cv_ for stop_requested_
+    std::condition_variable cv_;
+    std::thread check_thread_;
+
+    std::mutex roll_mutex_;              // Serialises open, rollover and retention
+    mutable std::mutex stats_mutex_;
+    Statistics statistics_;
+
+    void check_loop();
+    bool switch_to_day(std::int64_t day, bool carry_positions);
+    bool seed_positions(std::int64_t day);
+
+    // Reader connection (caller holds query_mutex_)
+    bool attach(std::int64_t day, std::string& schema);
+    void detach(std::int64_t day);
+    void close_reader();
+
+    // One partition's side of a merged scan: the current page and where the next one starts
+    template<typename Row>
+    struct PartitionCursor {
+        std::int64_t day;
+        ResumeToken next;
+        std::vector<Row> page;
+        size_t position;
+        bool complete;
+
+        const Row& head() const { return page[position]; }
+    };
+
+    template<typename Row>
+    ScanResult scan_partitions(const HistoryQuery& query, const std::function<bool(const Row&)>& visitor);
+    template<typename Row>
+    bool fetch_page(PartitionCursor<Row>& cursor, const HistoryQuery& query);
+};
+
+} // namespace trading
@@ -0,0 +1,224 @@
+#include "snapshot_store.hpp"
+#include "file_io.hpp"
+#include "../../core/models/order.hpp"
+#include "../../core/models/trade.hpp"
+#include "../../core/models/position.hpp"
+#include "../../utils/logging.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+namespace trading {
+
+namespace {
+
+constexpr char SNAPSHOT_MAGIC[8] = {'T', 'S', 'S', 'N', 'A', 'P', '\0', '\0'};
+constexpr const char* SNAPSHOT_PREFIX = "snapshot-";
+constexpr const char* SNAPSHOT_SUFFIX = ".bin";
+
+} // namespace
+
+SnapshotStore::SnapshotStore(const Config& config)
+    : config_(config) {
+    if (config_.retain_count == 0) {
+        config_.retain_count = 1;
+    }
+}
+
+SnapshotStore::EncodedSnapshot SnapshotStore::encode(const EngineSnapshot& snapshot) {
+    EncodedSnapshot encoded;
+    encoded.journal_sequence = snapshot.journal_sequence;
+    encoded.order_sequence = snapshot.order_sequence;
+    encoded.trade_sequence = snapshot.trade_sequence;
+
+    auto& records = encoded.records;
+    records.reserve(snapshot.orders.size() + snapshot.trades.size() + snapshot.positions.size());
+    size_t skipped = 0;
+    auto add = [&records, &skipped](bool encoded, JournalRecord& record) {
+        if (!encoded) {
+            ++skipped;
+            return;
+        }
+        record.sequence = records.size() + 1;
+        record.checksum = record.compute_checksum();
+        records.push_back(record);
+    };
+
+    JournalRecord record;
+    for (const auto& order : snapshot.orders) {
+        add(EventJournal::encode_order(*order, record), record);
+    }
+    for (const auto& trade : snapshot.trades) {
+        add(EventJournal::encode_trade(*trade, record), record);
+    }
+    for (const auto& position : snapshot.positions) {
+        add(EventJournal::encode_position(*position, record), record);
+    }
+    if (skipped > 0) {
+        Logger::warn("SnapshotStore: Skipped " + std::to_string(skipped) + " objects whose ids do not fit a record");
+    }
+    return encoded;
+}
+
+bool SnapshotStore::write(const EncodedSnapshot& snapshot) {
+    auto start = std::chrono::steady_clock::now();
+
+    std::error_code ec;
+    std::filesystem::create_directories(config_.directory, ec);
+    if (ec) {
+        Logger::error("SnapshotStore: Cannot create " + config_.directory + ": " + ec.message());
+        return false;
+    }
+
+    const auto& records = snapshot.records;
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = FORMAT_VERSION;
+    header.journal_sequence = snapshot.journal_sequence;
+    header.order_sequence = snapshot.order_sequence;
+    header.trade_sequence = snapshot.trade_sequence;
+    header.record_count = records.size();
+    header.created_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    header.checksum = header_checksum(header);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s%020llu%s", SNAPSHOT_PREFIX,
+                  static_cast<unsigned long long>(snapshot.journal_sequence), SNAPSHOT_SUFFIX);
+    const std::string path = (std::filesystem::path(config_.directory) / name).string();
+    const std::string temp_path = path + ".tmp";
+
+    // Write-sync-rename so a crash never leaves a partial file under a snapshot name
+    std::filesystem::remove(temp_path, ec);
+    int fd = file_io::open_file(temp_path, true);
+    if (fd < 0) {
+        Logger::error("SnapshotStore: Cannot create " + temp_path);
+        return false;
+    }
+    bool written = file_io::write_at(fd, &header, sizeof(header), 0) &&
+                   (records.empty() ||
+                    file_io::write_at(fd, records.data(), records.size() * JournalRecord::SIZE, sizeof(header))) &&
+                   file_io::sync_file(fd);
+    file_io::close_file(fd);
+    if (!written) {
+        Logger::error("SnapshotStore: Failed to write " + temp_path);
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        Logger::error("SnapshotStore: Failed to publish snapshot: " + ec.message());
+        return false;
+    }
+    file_io::sync_directory(config_.directory);
+    prune();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    Logger::info("SnapshotStore: Wrote " + std::to_string(records.size()) + " records at journal sequence " +
+                 std::to_string(snapshot.journal_sequence) + " in " + std::to_string(elapsed.count()) + "ms");
+    return true;
+}
+
+bool SnapshotStore::load_latest(EngineSnapshot& snapshot) const {
+    for (const auto& path : list_snapshots()) {
+        EngineSnapshot candidate;
+        if (load_file(path, candidate)) {
+            snapshot = std::move(candidate);
+            return true;
+        }
+        Logger::warn("SnapshotStore: Ignoring invalid snapshot " + path);
+    }
+    return false;
+}
+
+std::vector<std::string> SnapshotStore::list_snapshots() const {
+    std::vector<std::string> paths;
+    std::error_code ec;
+    if (!std::filesystem::is_directory(config_.directory, ec)) {
+        return paths;
+    }
+    for (const auto& entry : std::filesystem::directory_iterator(config_.directory, ec)) {
+        std::string name = entry.path().filename().string();
+        if (name.rfind(SNAPSHOT_PREFIX, 0) == 0 && entry.path().extension() == SNAPSHOT_SUFFIX) {
+            paths.push_back(entry.path().string());
+        }
+    }
+    // Zero-padded sequences sort lexically
+    std::sort(paths.rbegin(), paths.rend());
+    return paths;
+}
+
+bool SnapshotStore::load_file(const std::string& path, EngineSnapshot& snapshot) const {
+    int fd = file_io::open_file(path, false);
+    if (fd < 0) {
+        return false;
+    }
+
+    Header header;
+    bool valid = file_io::read_at(fd, &header, sizeof(header), 0) &&
+                 std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) == 0 &&
+                 header.version == FORMAT_VERSION &&
+                 header.checksum == header_checksum(header);
+
+    std::error_code ec;
+    auto file_size = std::filesystem::file_size(path, ec);
+    valid = valid && !ec && file_size == sizeof(header) + header.record_count * JournalRecord::SIZE;
+
+    std::vector<JournalRecord> records;
+    if (valid) {
+        records.resize(static_cast<size_t>(header.record_count));
+        valid = records.empty() ||
+                file_io::read_at(fd, records.data(), records.size() * JournalRecord::SIZE, sizeof(header));
+    }
+    file_io::close_file(fd);
+    if (!valid) {
+        return false;
+    }
+
+    snapshot.journal_sequence = header.journal_sequence;
+    snapshot.order_sequence = header.order_sequence;
+    snapshot.trade_sequence = header.trade_sequence;
+    for (size_t i = 0; i < records.size(); ++i) {
+        const JournalRecord& record = records[i];
+        if (!record.is_valid(i + 1)) {
+            return false;
+        }
+        switch (record.type) {
+            case JournalRecordType::ORDER:
+                snapshot.orders.push_back(EventJournal::decode_order(record));
+                break;
+            case JournalRecordType::TRADE:
+                snapshot.trades.push_back(EventJournal::decode_trade(record));
+                break;
+            case JournalRecordType::POSITION:
+                snapshot.positions.push_back(EventJournal::decode_position(record));
+                break;
+            case JournalRecordType::NONE:
+                return false;
+        }
+    }
+    return true;
+}
+
+void SnapshotStore::prune() {
+    auto paths = list_snapshots();
+    std::error_code ec;
+    for (size_t i = config_.retain_count; i < paths.size(); ++i) {
+        std::filesystem::remove(paths[i], ec);
+    }
+}
+
+std::uint32_t SnapshotStore::header_checksum(const Header& header) {
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(&header);
+    const size_t offset = offsetof(Header, journal_sequence);
+    std::uint32_t crc = EventJournal::crc32(bytes, offsetof(Header, checksum));
+    return crc ^ EventJournal::crc32(bytes + offset, sizeof(Header) - offset);
+}
+
+} // namespace trading
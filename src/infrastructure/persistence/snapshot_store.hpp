@@ -0,0 +1,84 @@
+#pragma once
+
+#include "event_journal.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace trading {
+
+class Order;
+class Trade;
+class Position;
+
+/**
+ * Engine Snapshot
+ * Full engine state as of a journal sequence; recovery replays the journal from
+ * journal_sequence + 1 on top of it.
+ */
+struct EngineSnapshot {
+    uint64_t journal_sequence = 0;
+    uint64_t order_sequence = 0;
+    uint64_t trade_sequence = 0;
+    std::vector<std::shared_ptr<Order>> orders;
+    std::vector<std::shared_ptr<Trade>> trades;
+    std::vector<std::shared_ptr<Position>> positions;
+};
+
+/**
+ * Snapshot Store
+ * Binary snapshot files: a checksummed header followed by journal-format records.
+ * Files are written to a temporary name, synced and renamed; the newest
+ * retain_count snapshots are kept and loading falls back to an older one if the
+ * newest fails validation.
+ */
+class SnapshotStore {
+public:
+    struct Config {
+        std::string directory = "./data/snapshots";
+        size_t retain_count = 2;
+    };
+
+    // Snapshot reduced to its file records; value copies, independent of the live objects
+    struct EncodedSnapshot {
+        uint64_t journal_sequence = 0;
+        uint64_t order_sequence = 0;
+        uint64_t trade_sequence = 0;
+        std::vector<JournalRecord> records;
+    };
+
+    explicit SnapshotStore(const Config& config);
+
+    static EncodedSnapshot encode(const EngineSnapshot& snapshot);
+    bool write(const EncodedSnapshot& snapshot);
+    bool write(const EngineSnapshot& snapshot) { return write(encode(snapshot)); }
+    bool load_latest(EngineSnapshot& snapshot) const;
+
+    // Snapshot file paths, newest first
+    std::vector<std::string> list_snapshots() const;
+    const Config& get_config() const { return config_; }
+
+private:
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t checksum;        // Covers every other header field
+        std::uint64_t journal_sequence;
+        std::uint64_t order_sequence;
+        std::uint64_t trade_sequence;
+        std::uint64_t record_count;
+        std::int64_t created_time_ns;
+    };
+
+    static constexpr std::uint32_t FORMAT_VERSION = 1;
+
+    Config config_;
+
+    bool load_file(const std::string& path, EngineSnapshot& snapshot) const;
+    void prune();
+    static std::uint32_t header_checksum(const Header& header);
+};
+
+} // namespace trading
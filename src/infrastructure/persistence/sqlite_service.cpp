@@ -10,13 +10,366 @@
 #include <fstream>
 #include <chrono>
 #include <algorithm>
+#include <stdexcept>
+#include <string_view>
+#include <charconv>
+#include <thread>
 
 namespace trading {
 
-SQLiteService::SQLiteService(const std::string& database_path)
+// SQLiteProfile implementation
+
+SQLiteProfile SQLiteProfile::from_config(const PersistenceConfig& config) {
+    SQLiteProfile profile;
+    profile.journal_mode = config.sqlite_journal_mode;
+    profile.synchronous = config.sqlite_synchronous;
+    profile.mmap_size_bytes = static_cast<std::int64_t>(config.sqlite_mmap_size_mb) * 1024 * 1024;
+    profile.cache_size_kib = config.sqlite_cache_size_mb * 1024;
+    profile.reader_connections = config.sqlite_reader_connections;
+    return profile;
+}
+
+bool SQLiteProfile::is_valid() const {
+    // Values are spliced into PRAGMA statements, so only known keywords are accepted
+    static const std::vector<std::string> journal_modes = {"WAL", "DELETE", "TRUNCATE", "PERSIST", "MEMORY", "OFF"};
+    static const std::vector<std::string> synchronous_modes = {"OFF", "NORMAL", "FULL", "EXTRA"};
+    return std::find(journal_modes.begin(), journal_modes.end(), journal_mode) != journal_modes.end() &&
+           std::find(synchronous_modes.begin(), synchronous_modes.end(), synchronous) != synchronous_modes.end() &&
+           mmap_size_bytes >= 0 && cache_size_kib >= 0 && busy_timeout_ms >= 0 && reader_connections >= 0;
+}
+
+std::string SQLiteProfile::to_pragma_sql() const {
+    return "PRAGMA journal_mode=" + journal_mode + ";"
+           "PRAGMA synchronous=" + synchronous + ";"
+           "PRAGMA mmap_size=" + std::to_string(mmap_size_bytes) + ";"
+           "PRAGMA cache_size=-" + std::to_string(cache_size_kib) + ";"
+           "PRAGMA busy_timeout=" + std::to_string(busy_timeout_ms) + ";"
+           "PRAGMA temp_store=MEMORY;";
+}
+
+std::string SQLiteProfile::to_reader_pragma_sql() const {
+    return "PRAGMA mmap_size=" + std::to_string(mmap_size_bytes) + ";"
+           "PRAGMA cache_size=-" + std::to_string(cache_size_kib) + ";"
+           "PRAGMA busy_timeout=" + std::to_string(busy_timeout_ms) + ";"
+           "PRAGMA temp_store=MEMORY;"
+           "PRAGMA query_only=1;";
+}
+
+// ResumeToken implementation
+
+std::string ResumeToken::to_string() const {
+    return std::to_string(time) + ":" + id;
+}
+
+std::optional<ResumeToken> ResumeToken::parse(const std::string& token) {
+    auto separator = token.find(':');
+    if (separator == std::string::npos || separator + 1 == token.size()) {
+        return std::nullopt;
+    }
+    ResumeToken parsed;
+    auto result = std::from_chars(token.data(), token.data() + separator, parsed.time);
+    if (result.ec != std::errc() || result.ptr != token.data() + separator) {
+        return std::nullopt;
+    }
+    parsed.id = token.substr(separator + 1);
+    return parsed;
+}
+
+// History scan tables
+
+namespace {
+
+template<typename Row>
+struct ScanColumn {
+    const char* name;
+    void (*read)(Row& row, sqlite3_stmt* statement, int index);
+};
+
+template<typename Row>
+struct ScanTable {
+    const char* operation;
+    const char* table;
+    const char* time_column;
+    const char* id_column;
+    std::int64_t Row::*time_member;
+    std::string Row::*id_member;
+    std::vector<ScanColumn<Row>> columns;
+};
+
+std::string column_string(sqlite3_stmt* statement, int index) {
+    const auto* text = sqlite3_column_text(statement, index);
+    if (!text) {
+        return {};
+    }
+    return std::string(reinterpret_cast<const char*>(text), static_cast<size_t>(sqlite3_column_bytes(statement, index)));
+}
+
+const ScanTable<TradeRow> TRADE_SCAN_TABLE = {
+    "scan_trades", "trades", "execution_time", "trade_id",
+    &TradeRow::execution_time, &TradeRow::trade_id,
+    {
+        {"trade_id", [](TradeRow& row, sqlite3_stmt* s, int i) { row.trade_id = column_string(s, i); }},
+        {"order_id", [](TradeRow& row, sqlite3_stmt* s, int i) { row.order_id = column_string(s, i); }},
+        {"instrument_symbol", [](TradeRow& row, sqlite3_stmt* s, int i) { row.instrument_symbol = column_string(s, i); }},
+        {"side", [](TradeRow& row, sqlite3_stmt* s, int i) { row.side = sqlite3_column_int(s, i); }},
+        {"quantity", [](TradeRow& row, sqlite3_stmt* s, int i) { row.quantity = sqlite3_column_double(s, i); }},
+        {"price", [](TradeRow& row, sqlite3_stmt* s, int i) { row.price = sqlite3_column_double(s, i); }},
+        {"execution_time", [](TradeRow& row, sqlite3_stmt* s, int i) { row.execution_time = sqlite3_column_int64(s, i); }},
+        {"type", [](TradeRow& row, sqlite3_stmt* s, int i) { row.type = sqlite3_column_int(s, i); }},
+    }
+};
+
+const ScanTable<OrderRow> ORDER_SCAN_TABLE = {
+    "scan_orders", "orders", "created_time", "order_id",
+    &OrderRow::created_time, &OrderRow::order_id,
+    {
+        {"order_id", [](OrderRow& row, sqlite3_stmt* s, int i) { row.order_id = column_string(s, i); }},
+        {"instrument_symbol", [](OrderRow& row, sqlite3_stmt* s, int i) { row.instrument_symbol = column_string(s, i); }},
+        {"side", [](OrderRow& row, sqlite3_stmt* s, int i) { row.side = sqlite3_column_int(s, i); }},
+        {"type", [](OrderRow& row, sqlite3_stmt* s, int i) { row.type = sqlite3_column_int(s, i); }},
+        {"quantity", [](OrderRow& row, sqlite3_stmt* s, int i) { row.quantity = sqlite3_column_double(s, i); }},
+        {"price", [](OrderRow& row, sqlite3_stmt* s, int i) { row.price = sqlite3_column_double(s, i); }},
+        {"status", [](OrderRow& row, sqlite3_stmt* s, int i) { row.status = sqlite3_column_int(s, i); }},
+        {"filled_quantity", [](OrderRow& row, sqlite3_stmt* s, int i) { row.filled_quantity = sqlite3_column_double(s, i); }},
+        {"total_fill_value", [](OrderRow& row, sqlite3_stmt* s, int i) { row.total_fill_value = sqlite3_column_double(s, i); }},
+        {"created_time", [](OrderRow& row, sqlite3_stmt* s, int i) { row.created_time = sqlite3_column_int64(s, i); }},
+        {"last_modified", [](OrderRow& row, sqlite3_stmt* s, int i) { row.last_modified = sqlite3_column_int64(s, i); }},
+        {"rejection_reason", [](OrderRow& row, sqlite3_stmt* s, int i) { row.rejection_reason = column_string(s, i); }},
+    }
+};
+
+template<typename Row>
+ScanResult scan_rows(const ScanTable<Row>& table, sqlite3* const& db, std::mutex& mutex, const std::string& schema,
+                     const HistoryQuery& query, const std::function<bool(const Row&)>& visitor) {
+    ScanResult result;
+    result.next = query.resume_after;
+    if (!visitor) {
+        result.ok = false;
+        return result;
+    }
+
+    // Projection - names are matched against the table definition, never spliced in from the caller
+    std::vector<const ScanColumn<Row>*> selected;
+    auto select = [&selected](const ScanColumn<Row>& column) {
+        if (std::find(selected.begin(), selected.end(), &column) == selected.end()) {
+            selected.push_back(&column);
+        }
+    };
+    for (const auto& column : table.columns) {
+        if (column.name == std::string_view(table.time_column) || column.name == std::string_view(table.id_column)) {
+            select(column);
+        }
+    }
+    for (const auto& name : query.columns) {
+        auto it = std::find_if(table.columns.begin(), table.columns.end(),
+                               [&name](const ScanColumn<Row>& column) { return name == column.name; });
+        if (it == table.columns.end()) {
+            Logger::error("SQLiteService: Unknown column in " + std::string(table.operation) + ": " + name);
+            result.ok = false;
+            return result;
+        }
+        select(*it);
+    }
+    if (query.columns.empty()) {
+        for (const auto& column : table.columns) {
+            select(column);
+        }
+    }
+
+    std::string columns;
+    for (const auto* column : selected) {
+        columns += (columns.empty() ? "" : ", ") + std::string(column->name);
+    }
+    const std::string time_column = table.time_column;
+    const std::string id_column = table.id_column;
+    const std::string base_sql = "SELECT " + columns + " FROM " + schema + "." + table.table +
+        " WHERE " + time_column + " >= ?1 AND " + time_column + " <= ?2" +
+        (query.instrument_symbol ? " AND instrument_symbol = ?3" : "");
+    const std::string order_sql = " ORDER BY " + time_column + ", " + id_column + " LIMIT ?4";
+    const std::string first_page_sql = base_sql + order_sql;
+    const std::string next_page_sql = base_sql + " AND (" + time_column + " > ?5 OR (" + time_column + " = ?5 AND " +
+                                      id_column + " > ?6))" + order_sql;
+
+    const std::int64_t from_time = std::chrono::duration_cast<std::chrono::seconds>(query.from.time_since_epoch()).count();
+    const std::int64_t to_time = std::chrono::duration_cast<std::chrono::seconds>(query.to.time_since_epoch()).count();
+    const size_t page_size = std::max<size_t>(1, query.page_size);
+    std::vector<Row> page;
+    page.reserve(page_size);
+
+    while (!result.complete) {
+        size_t limit = page_size;
+        if (query.max_rows > 0) {
+            limit = std::min(limit, query.max_rows - result.rows);
+            if (limit == 0) {
+                break;
+            }
+        }
+
+        // Fill one page under the lock; the visitor runs after it is released
+        page.clear();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!db) {
+                Logger::error("SQLiteService: " + std::string(table.operation) + " requires a file-backed database");
+                result.ok = false;
+                return result;
+            }
+
+            const std::string& sql = result.next.empty() ? first_page_sql : next_page_sql;
+            sqlite3_stmt* raw_statement = nullptr;
+            if (sqlite3_prepare_v2(db, sql.c_str(), -1, &raw_statement, nullptr) != SQLITE_OK) {
+                Logger::error("SQLiteService: Error in " + std::string(table.operation) + ": " + sqlite3_errmsg(db));
+                sqlite3_finalize(raw_statement);
+                result.ok = false;
+                return result;
+            }
+            std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> statement(raw_statement, &sqlite3_finalize);
+
+            sqlite3_bind_int64(raw_statement, 1, from_time);
+            sqlite3_bind_int64(raw_statement, 2, to_time);
+            if (query.instrument_symbol) {
+                sqlite3_bind_text(raw_statement, 3, query.instrument_symbol->c_str(),
+                                  static_cast<int>(query.instrument_symbol->size()), SQLITE_STATIC);
+            }
+            sqlite3_bind_int64(raw_statement, 4, static_cast<std::int64_t>(limit));
+            if (!result.next.empty()) {
+                sqlite3_bind_int64(raw_statement, 5, result.next.time);
+                sqlite3_bind_text(raw_statement, 6, result.next.id.c_str(),
+                                  static_cast<int>(result.next.id.size()), SQLITE_STATIC);
+            }
+
+            int rc;
+            while ((rc = sqlite3_step(raw_statement)) == SQLITE_ROW) {
+                Row& row = page.emplace_back();
+                for (size_t i = 0; i < selected.size(); ++i) {
+                    selected[i]->read(row, raw_statement, static_cast<int>(i));
+                }
+            }
+            if (rc != SQLITE_DONE) {
+                Logger::error("SQLiteService: Error in " + std::string(table.operation) + ": " + sqlite3_errmsg(db));
+                result.ok = false;
+                return result;
+            }
+        }
+
+        bool last_page = page.size() < limit;
+        for (const auto& row : page) {
+            ++result.rows;
+            result.next.time = row.*table.time_member;
+            result.next.id = row.*table.id_member;
+            if (!visitor(row)) {
+                return result;
+            }
+        }
+        result.complete = last_page;
+    }
+
+    return result;
+}
+
+// Every row matching query, newest first as the load_* queries return them
+template<typename Row>
+std::vector<Row> read_newest_first(const ScanTable<Row>& table, sqlite3* const& db, std::mutex& mutex,
+                                   const HistoryQuery& query) {
+    std::vector<Row> rows;
+    auto result = scan_rows<Row>(table, db, mutex, "main", query, [&rows](const Row& row) {
+        rows.push_back(row);
+        return true;
+    });
+    if (!result.ok) {
+        throw std::runtime_error(std::string(table.operation) + " failed");
+    }
+    std::reverse(rows.begin(), rows.end());
+    return rows;
+}
+
+// Positions ordered by symbol, optionally only one symbol
+std::vector<PositionRow> read_positions(sqlite3* db, const std::string* symbol) {
+    std::string sql = "SELECT instrument_symbol, quantity, average_price, realized_pnl, unrealized_pnl, last_updated "
+                      "FROM positions";
+    sql += symbol ? " WHERE instrument_symbol = ?1" : " ORDER BY instrument_symbol";
+
+    sqlite3_stmt* raw_statement = nullptr;
+    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &raw_statement, nullptr) != SQLITE_OK) {
+        sqlite3_finalize(raw_statement);
+        throw std::runtime_error(sqlite3_errmsg(db));
+    }
+    std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> statement(raw_statement, &sqlite3_finalize);
+    if (symbol) {
+        sqlite3_bind_text(raw_statement, 1, symbol->c_str(), static_cast<int>(symbol->size()), SQLITE_STATIC);
+    }
+
+    std::vector<PositionRow> rows;
+    while (sqlite3_step(raw_statement) == SQLITE_ROW) {
+        PositionRow& row = rows.emplace_back();
+        row.instrument_symbol = column_string(raw_statement, 0);
+        row.quantity = sqlite3_column_double(raw_statement, 1);
+        row.average_price = sqlite3_column_double(raw_statement, 2);
+        row.realized_pnl = sqlite3_column_double(raw_statement, 3);
+        row.unrealized_pnl = sqlite3_column_double(raw_statement, 4);
+        row.last_updated = sqlite3_column_int64(raw_statement, 5);
+    }
+    return rows;
+}
+
+size_t count_rows(sqlite3* db, const char* table) {
+    const std::string sql = std::string("SELECT COUNT(*) FROM ") + table;
+    sqlite3_stmt* raw_statement = nullptr;
+    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &raw_statement, nullptr) != SQLITE_OK) {
+        sqlite3_finalize(raw_statement);
+        throw std::runtime_error(sqlite3_errmsg(db));
+    }
+    std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> statement(raw_statement, &sqlite3_finalize);
+    return sqlite3_step(raw_statement) == SQLITE_ROW ? static_cast<size_t>(sqlite3_column_int64(raw_statement, 0)) : 0;
+}
+
+} // namespace
+
+ScanResult scan_trade_rows(sqlite3* const& db, std::mutex& mutex, const std::string& schema,
+                           const HistoryQuery& query, const TradeRowVisitor& visitor) {
+    return scan_rows(TRADE_SCAN_TABLE, db, mutex, schema, query, visitor);
+}
+
+ScanResult scan_order_rows(sqlite3* const& db, std::mutex& mutex, const std::string& schema,
+                           const HistoryQuery& query, const OrderRowVisitor& visitor) {
+    return scan_rows(ORDER_SCAN_TABLE, db, mutex, schema, query, visitor);
+}
+
+// SQLiteService implementation
+
+class SQLiteService::ReaderLease {
+public:
+    explicit ReaderLease(SQLiteService& service) : service_(service), reader_(service.acquire_reader()) {}
+    ~ReaderLease() {
+        if (reader_) {
+            service_.release_reader(reader_);
+        }
+    }
+
+    ReaderLease(const ReaderLease&) = delete;
+    ReaderLease& operator=(const ReaderLease&) = delete;
+
+    explicit operator bool() const { return reader_ != nullptr; }
+    ReaderConnection* operator->() const { return reader_; }
+
+private:
+    SQLiteService& service_;
+    ReaderConnection* reader_;
+};
+
+SQLiteService::SQLiteService(const std::string& database_path, const SQLiteProfile& profile)
     : database_path_(database_path)
+    , profile_(profile)
     , is_initialized_(false)
-    , storage_(nullptr) {
+    , db_handle_(nullptr)
+    , active_backup_(nullptr)
+    , storage_(nullptr)
+    , leased_readers_(0)
+    , closing_readers_(false)
+    , counts_cached_(false)
+    , order_count_(0)
+    , trade_count_(0)
+    , position_count_(0) {
 }
 
 SQLiteService::~SQLiteService() {
@@ -25,8 +378,16 @@ SQLiteService::~SQLiteService() {
 
 bool SQLiteService::initialize() {
     std::lock_guard<std::mutex> lock(database_mutex_);
+    return open_storage();
+}
 
+bool SQLiteService::open_storage() {
     try {
+        if (!profile_.is_valid()) {
+            Logger::error("SQLiteService: Invalid tuning profile, falling back to defaults");
+            profile_ = SQLiteProfile{};
+        }
+
         // Ensure the directory exists
         std::filesystem::path db_path(database_path_);
         if (db_path.has_parent_path()) {
@@ -34,67 +395,94 @@ bool SQLiteService::initialize() {
         }
 
         // Create the storage object
-        storage_ = std::make_unique<Storage>(sqlite_orm::make_storage(database_path_,
-            sqlite_orm::make_table("orders",
-                sqlite_orm::make_column("order_id", &OrderRow::order_id, sqlite_orm::primary_key()),
-                sqlite_orm::make_column("instrument_symbol", &OrderRow::instrument_symbol),
-                sqlite_orm::make_column("side", &OrderRow::side),
-                sqlite_orm::make_column("type", &OrderRow::type),
-                sqlite_orm::make_column("quantity", &OrderRow::quantity),
-                sqlite_orm::make_column("price", &OrderRow::price),
-                sqlite_orm::make_column("status", &OrderRow::status),
-                sqlite_orm::make_column("filled_quantity", &OrderRow::filled_quantity),
-                sqlite_orm::make_column("total_fill_value", &OrderRow::total_fill_value),
-                sqlite_orm::make_column("created_time", &OrderRow::created_time),
-                sqlite_orm::make_column("last_modified", &OrderRow::last_modified),
-                sqlite_orm::make_column("rejection_reason", &OrderRow::rejection_reason)
-            ),
-            sqlite_orm::make_table("trades",
-                sqlite_orm::make_column("trade_id", &TradeRow::trade_id, sqlite_orm::primary_key()),
-                sqlite_orm::make_column("order_id", &TradeRow::order_id),
-                sqlite_orm::make_column("instrument_symbol", &TradeRow::instrument_symbol),
-                sqlite_orm::make_column("side", &TradeRow::side),
-                sqlite_orm::make_column("quantity", &TradeRow::quantity),
-                sqlite_orm::make_column("price", &TradeRow::price),
-                sqlite_orm::make_column("execution_time", &TradeRow::execution_time),
-                sqlite_orm::make_column("type", &TradeRow::type)
-            ),
-            sqlite_orm::make_table("positions",
-                sqlite_orm::make_column("instrument_symbol", &PositionRow::instrument_symbol, sqlite_orm::primary_key()),
-                sqlite_orm::make_column("quantity", &PositionRow::quantity),
-                sqlite_orm::make_column("average_price", &PositionRow::average_price),
-                sqlite_orm::make_column("realized_pnl", &PositionRow::realized_pnl),
-                sqlite_orm::make_column("unrealized_pnl", &PositionRow::unrealized_pnl),
-                sqlite_orm::make_column("last_updated", &PositionRow::last_updated)
-            )
-        ));
-
-        // Synchronize schema (create tables if they don't exist)
+        storage_ = std::make_unique<Storage>(make_trading_storage(database_path_));
+
+        // Apply the tuning profile on open and keep one connection for the service's lifetime,
+        // so pragmas and cached statements stay valid
+        storage_->on_open = [this](sqlite3* db) {
+            db_handle_ = db;
+            char* error = nullptr;
+            if (sqlite3_exec(db, profile_.to_pragma_sql().c_str(), nullptr, nullptr, &error) != SQLITE_OK) {
+                Logger::warn("SQLiteService: Failed to apply tuning pragmas: " + std::string(error ? error : "unknown"));
+                sqlite3_free(error);
+            }
+        };
+        storage_->open_forever();
+
+        // Synchronize schema (create tables and indexes if they don't exist)
         storage_->sync_schema();
 
-        // Create indices for better performance - using pragma_table_info workaround
-        // Note: sqlite_orm doesn't support raw SQL execution easily
-        // These indices will be created at the schema level or through other means
-        // For now, skip explicit index creation as schema sync handles basic needs
+        if (db_handle_) {
+            order_count_.store(count_rows(db_handle_, "orders"));
+            trade_count_.store(count_rows(db_handle_, "trades"));
+            position_count_.store(count_rows(db_handle_, "positions"));
+            counts_cached_.store(true);
+            open_readers();
+        }
 
         is_initialized_ = true;
-        Logger::info("SQLiteService: Database initialized successfully: " + database_path_);
+        Logger::info("SQLiteService: Database initialized successfully: " + database_path_ +
+                     " (journal_mode=" + profile_.journal_mode + ", synchronous=" + profile_.synchronous + ")");
         return true;
 
     } catch (const std::exception& e) {
         log_error("initialize", e);
         is_initialized_ = false;
+        release_connection_handles();
         storage_.reset();
         return false;
     }
 }
 
+bool SQLiteService::reopen(const std::string& database_path, bool carry_positions) {
+    std::lock_guard<std::mutex> lock(database_mutex_);
+
+    PersistenceBatch carried;
+    try {
+        if (carry_positions && storage_) {
+            carried.positions = db_handle_ ? read_positions(db_handle_, nullptr) : storage_->get_all<PositionRow>();
+        }
+    } catch (const std::exception& e) {
+        log_error("reopen", e);
+        return false;
+    }
+
+    is_initialized_ = false;
+    release_connection_handles();
+    storage_.reset();
+    database_path_ = database_path;
+    if (!open_storage()) {
+        return false;
+    }
+
+    try {
+        if (carried.empty()) {
+            return true;
+        }
+        if (!write_batch(carried)) {
+            return false;
+        }
+        Logger::info("SQLiteService: Carried " + std::to_string(carried.size()) + " positions into " + database_path_);
+        return true;
+    } catch (const std::exception& e) {
+        log_error("reopen", e);
+        return false;
+    }
+}
+
+std::string SQLiteService::get_database_path() const {
+    std::lock_guard<std::mutex> lock(database_mutex_);
+    return database_path_;
+}
+
 void SQLiteService::close() {
     std::lock_guard<std::mutex> lock(database_mutex_);
 
+    is_initialized_ = false;
+    release_connection_handles();
+
     if (storage_) {
         storage_.reset();
-        is_initialized_ = false;
         Logger::info("SQLiteService: Database closed");
     }
 }
@@ -107,9 +495,9 @@ bool SQLiteService::save_trade(const Trade& trade) {
     std::lock_guard<std::mutex> lock(database_mutex_);
 
     try {
-        TradeRow row = trade_to_row(trade);
-        storage_->replace(row);
-        return true;
+        bool ok = write_row(trade_to_row(trade));
+        finish_row_counts(ok);
+        return ok;
     } catch (const std::exception& e) {
         log_error("save_trade", e);
         return false;
@@ -124,9 +512,9 @@ bool SQLiteService::save_order(const Order& order) {
     std::lock_guard<std::mutex> lock(database_mutex_);
 
     try {
-        OrderRow row = order_to_row(order);
-        storage_->replace(row);
-        return true;
+        bool ok = write_row(order_to_row(order));
+        finish_row_counts(ok);
+        return ok;
     } catch (const std::exception& e) {
         log_error("save_order", e);
         return false;
@@ -141,15 +529,75 @@ bool SQLiteService::update_position(const Position& position) {
     std::lock_guard<std::mutex> lock(database_mutex_);
 
     try {
-        PositionRow row = position_to_row(position);
-        storage_->replace(row);
-        return true;
+        bool ok = write_row(position_to_row(position));
+        finish_row_counts(ok);
+        return ok;
     } catch (const std::exception& e) {
         log_error("update_position", e);
         return false;
     }
 }
 
+bool SQLiteService::save_batch(const PersistenceBatch& batch) {
+    if (!is_initialized_) {
+        return false;
+    }
+    if (batch.empty()) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(database_mutex_);
+
+    try {
+        return write_batch(batch);
+    } catch (const std::exception& e) {
+        log_error("save_batch", e);
+        return false;
+    }
+}
+
+bool SQLiteService::write_batch(const PersistenceBatch& batch) {
+    // One transaction (and one journal sync) for the whole batch
+    if (!storage_) {
+        return false;
+    }
+    if (!db_handle_) {
+        return storage_->transaction([&] {
+            for (const auto& row : batch.orders) {
+                storage_->replace(row);
+            }
+            for (const auto& row : batch.trades) {
+                storage_->replace(row);
+            }
+            for (const auto& row : batch.positions) {
+                storage_->replace(row);
+            }
+            return true;
+        });
+    }
+
+    if (!execute_sql("BEGIN IMMEDIATE", "save_batch")) {
+        return false;
+    }
+    bool ok = true;
+    for (size_t i = 0; ok && i < batch.orders.size(); ++i) {
+        ok = write_row(batch.orders[i]);
+    }
+    for (size_t i = 0; ok && i < batch.trades.size(); ++i) {
+        ok = write_row(batch.trades[i]);
+    }
+    for (size_t i = 0; ok && i < batch.positions.size(); ++i) {
+        ok = write_row(batch.positions[i]);
+    }
+    if (!ok || !execute_sql("COMMIT", "save_batch")) {
+        execute_sql("ROLLBACK", "save_batch");
+        finish_row_counts(false);
+        return false;
+    }
+    finish_row_counts(true);
+    return true;
+}
+
 std::vector<std::shared_ptr<Trade>> SQLiteService::load_trades_by_date(
     const std::chrono::system_clock::time_point& date) {
 
@@ -159,15 +607,25 @@ std::vector<std::shared_ptr<Trade>> SQLiteService::load_trades_by_date(
         return trades;
     }
 
-    std::lock_guard<std::mutex> lock(database_mutex_);
-
     try {
         auto [start_time, end_time] = get_date_range(date);
 
-        auto rows = storage_->get_all<TradeRow>(
-            sqlite_orm::where(sqlite_orm::between(&TradeRow::execution_time, start_time, end_time)),
-            sqlite_orm::order_by(&TradeRow::execution_time).desc()
-        );
+        std::vector<TradeRow> rows;
+        if (ReaderLease reader(*this); reader) {
+            HistoryQuery query;
+            query.from = unix_to_timepoint(start_time);
+            query.to = unix_to_timepoint(end_time);
+            rows = read_newest_first(TRADE_SCAN_TABLE, reader->db, reader->mutex, query);
+        } else {
+            std::lock_guard<std::mutex> lock(database_mutex_);
+            if (!storage_) {
+                return trades;
+            }
+            rows = storage_->get_all<TradeRow>(
+                sqlite_orm::where(sqlite_orm::between(&TradeRow::execution_time, start_time, end_time)),
+                sqlite_orm::order_by(&TradeRow::execution_time).desc()
+            );
+        }
 
         trades.reserve(rows.size());
         for (const auto& row : rows) {
@@ -192,15 +650,25 @@ std::vector<std::shared_ptr<Order>> SQLiteService::load_orders_by_date(
         return orders;
     }
 
-    std::lock_guard<std::mutex> lock(database_mutex_);
-
     try {
         auto [start_time, end_time] = get_date_range(date);
 
-        auto rows = storage_->get_all<OrderRow>(
-            sqlite_orm::where(sqlite_orm::between(&OrderRow::created_time, start_time, end_time)),
-            sqlite_orm::order_by(&OrderRow::created_time).desc()
-        );
+        std::vector<OrderRow> rows;
+        if (ReaderLease reader(*this); reader) {
+            HistoryQuery query;
+            query.from = unix_to_timepoint(start_time);
+            query.to = unix_to_timepoint(end_time);
+            rows = read_newest_first(ORDER_SCAN_TABLE, reader->db, reader->mutex, query);
+        } else {
+            std::lock_guard<std::mutex> lock(database_mutex_);
+            if (!storage_) {
+                return orders;
+            }
+            rows = storage_->get_all<OrderRow>(
+                sqlite_orm::where(sqlite_orm::between(&OrderRow::created_time, start_time, end_time)),
+                sqlite_orm::order_by(&OrderRow::created_time).desc()
+            );
+        }
 
         orders.reserve(rows.size());
         for (const auto& row : rows) {
@@ -223,12 +691,19 @@ std::vector<std::shared_ptr<Position>> SQLiteService::load_all_positions() {
         return positions;
     }
 
-    std::lock_guard<std::mutex> lock(database_mutex_);
-
     try {
-        auto rows = storage_->get_all<PositionRow>(
-            sqlite_orm::order_by(&PositionRow::instrument_symbol)
-        );
+        std::vector<PositionRow> rows;
+        if (ReaderLease reader(*this); reader) {
+            rows = read_positions(reader->db, nullptr);
+        } else {
+            std::lock_guard<std::mutex> lock(database_mutex_);
+            if (!storage_) {
+                return positions;
+            }
+            rows = storage_->get_all<PositionRow>(
+                sqlite_orm::order_by(&PositionRow::instrument_symbol)
+            );
+        }
 
         positions.reserve(rows.size());
         for (const auto& row : rows) {
@@ -248,30 +723,112 @@ std::vector<std::shared_ptr<Position>> SQLiteService::load_all_positions() {
 }
 
 bool SQLiteService::backup_to_file(const std::string& filepath) {
+    return backup_online(filepath, BackupOptions{});
+}
+
+bool SQLiteService::backup_online(const std::string& filepath, const BackupOptions& options) {
     if (!is_initialized_) {
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(database_mutex_);
+    const std::string temp_path = filepath + ".tmp";
+    sqlite3* destination = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(database_mutex_);
+        if (!db_handle_) {
+            Logger::error("SQLiteService: Online backup requires a file-backed database");
+            return false;
+        }
+        if (active_backup_) {
+            Logger::warn("SQLiteService: Backup already in progress, skipping " + filepath);
+            return false;
+        }
 
-    try {
-        // Ensure backup directory exists
-        std::filesystem::path backup_path(filepath);
-        if (backup_path.has_parent_path()) {
-            std::filesystem::create_directories(backup_path.parent_path());
+        try {
+            std::filesystem::path backup_path(filepath);
+            if (backup_path.has_parent_path()) {
+                std::filesystem::create_directories(backup_path.parent_path());
+            }
+            std::filesystem::remove(temp_path);
+        } catch (const std::exception& e) {
+            log_error("backup_online", e);
+            return false;
         }
 
-        // Use SQLite backup API - simplified approach
-        // Note: VACUUM INTO requires raw SQL execution
-        // For now, we'll implement a simpler file copy approach
-        // This can be enhanced later with proper SQLite C API integration
+        if (sqlite3_open_v2(temp_path.c_str(), &destination, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) == SQLITE_OK) {
+            active_backup_ = sqlite3_backup_init(destination, "main", db_handle_, "main");
+        }
+        if (!active_backup_) {
+            Logger::error("SQLiteService: Cannot start backup to " + temp_path + ": " +
+                          (destination ? sqlite3_errmsg(destination) : "out of memory"));
+            sqlite3_close(destination);
+            return false;
+        }
+    }
 
-        Logger::info("SQLiteService: Database backed up to: " + filepath);
-        return true;
-    } catch (const std::exception& e) {
-        log_error("backup_to_file", e);
+    // Steps run on the service's own connection, so writes made between steps are
+    // applied to the copy as well instead of restarting it
+    const int pages_per_step = std::max(1, options.pages_per_step);
+    const auto start = std::chrono::steady_clock::now();
+    BackupProgress progress;
+    int rc = SQLITE_OK;
+    bool finished = false;
+    while (!finished) {
+        {
+            std::lock_guard<std::mutex> lock(database_mutex_);
+            if (!active_backup_) {
+                rc = SQLITE_ABORT;   // Connection closed underneath us
+                break;
+            }
+
+            bool cancel = options.cancel_requested && options.cancel_requested->load();
+            rc = cancel ? SQLITE_ABORT : sqlite3_backup_step(active_backup_, pages_per_step);
+            progress.total_pages = sqlite3_backup_pagecount(active_backup_);
+            progress.remaining_pages = sqlite3_backup_remaining(active_backup_);
+            if (rc != SQLITE_OK && rc != SQLITE_BUSY && rc != SQLITE_LOCKED) {
+                int finish_rc = sqlite3_backup_finish(active_backup_);
+                active_backup_ = nullptr;
+                if (rc == SQLITE_DONE && finish_rc != SQLITE_OK) {
+                    rc = finish_rc;
+                }
+                finished = true;
+            }
+        }
+
+        progress.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        if (options.on_progress) {
+            options.on_progress(progress);
+        }
+        if (!finished && options.step_pause.count() > 0) {
+            std::this_thread::sleep_for(options.step_pause);
+        }
+    }
+
+    std::string error = rc == SQLITE_DONE ? "" : (rc == SQLITE_ABORT ? "aborted" : sqlite3_errmsg(destination));
+    if (sqlite3_close(destination) != SQLITE_OK && error.empty()) {
+        error = "failed to close backup file";
+    }
+
+    std::error_code ec;
+    if (error.empty()) {
+        std::filesystem::rename(temp_path, filepath, ec);
+        if (ec) {
+            error = ec.message();
+        }
+    }
+    if (!error.empty()) {
+        std::filesystem::remove(temp_path, ec);
+        Logger::error("SQLiteService: Backup to " + filepath + " failed: " + error);
         return false;
     }
+
+    auto bytes = std::filesystem::file_size(filepath, ec);
+    double seconds = std::max(0.001, std::chrono::duration<double>(progress.elapsed).count());
+    double megabytes = ec ? 0.0 : static_cast<double>(bytes) / (1024.0 * 1024.0);
+    Logger::info("SQLiteService: Database backed up to " + filepath + " (" + std::to_string(progress.total_pages) +
+                 " pages, " + std::to_string(megabytes) + " MB in " + std::to_string(progress.elapsed.count()) +
+                 "ms, " + std::to_string(megabytes / seconds) + " MB/s)");
+    return true;
 }
 
 bool SQLiteService::restore_from_file(const std::string& filepath) {
@@ -284,6 +841,8 @@ bool SQLiteService::restore_from_file(const std::string& filepath) {
         }
 
         // Close current connection
+        is_initialized_ = false;
+        release_connection_handles();
         storage_.reset();
 
         // Copy backup file to current database location
@@ -291,20 +850,19 @@ bool SQLiteService::restore_from_file(const std::string& filepath) {
             std::filesystem::copy_options::overwrite_existing);
 
         // Reinitialize with restored data
-        is_initialized_ = false;
-        return initialize();
+        return open_storage();
 
     } catch (const std::exception& e) {
         log_error("restore_from_file", e);
         // Try to reinitialize even if restore failed
         is_initialized_ = false;
-        initialize();
+        open_storage();
         return false;
     }
 }
 
 bool SQLiteService::is_available() const {
-    return is_initialized_ && storage_ != nullptr;
+    return is_initialized_.load(); // Only set while storage_ is open
 }
 
 std::string SQLiteService::get_status() const {
@@ -313,11 +871,9 @@ std::string SQLiteService::get_status() const {
     }
 
     try {
-        std::lock_guard<std::mutex> lock(database_mutex_);
-
-        auto order_count = storage_->count<OrderRow>();
-        auto trade_count = storage_->count<TradeRow>();
-        auto position_count = storage_->count<PositionRow>();
+        auto order_count = get_order_count();
+        auto trade_count = get_trade_count();
+        auto position_count = get_position_count();
 
         return "Connected - Orders: " + std::to_string(order_count) +
                ", Trades: " + std::to_string(trade_count) +
@@ -327,6 +883,34 @@ std::string SQLiteService::get_status() const {
     }
 }
 
+// Streaming history scans
+
+ScanResult SQLiteService::scan_trades(const HistoryQuery& query, const TradeRowVisitor& visitor) {
+    if (!is_initialized_) {
+        ScanResult result;
+        result.next = query.resume_after;
+        result.ok = false;
+        return result;
+    }
+    if (ReaderLease reader(*this); reader) {
+        return scan_trade_rows(reader->db, reader->mutex, "main", query, visitor);
+    }
+    return scan_trade_rows(db_handle_, database_mutex_, "main", query, visitor);
+}
+
+ScanResult SQLiteService::scan_orders(const HistoryQuery& query, const OrderRowVisitor& visitor) {
+    if (!is_initialized_) {
+        ScanResult result;
+        result.next = query.resume_after;
+        result.ok = false;
+        return result;
+    }
+    if (ReaderLease reader(*this); reader) {
+        return scan_order_rows(reader->db, reader->mutex, "main", query, visitor);
+    }
+    return scan_order_rows(db_handle_, database_mutex_, "main", query, visitor);
+}
+
 // Additional query methods
 
 std::vector<std::shared_ptr<Trade>> SQLiteService::load_trades_by_symbol(const std::string& symbol) {
@@ -336,13 +920,22 @@ std::vector<std::shared_ptr<Trade>> SQLiteService::load_trades_by_symbol(const s
         return trades;
     }
 
-    std::lock_guard<std::mutex> lock(database_mutex_);
-
     try {
-        auto rows = storage_->get_all<TradeRow>(
-            sqlite_orm::where(sqlite_orm::c(&TradeRow::instrument_symbol) == symbol),
-            sqlite_orm::order_by(&TradeRow::execution_time).desc()
-        );
+        std::vector<TradeRow> rows;
+        if (ReaderLease reader(*this); reader) {
+            HistoryQuery query;
+            query.instrument_symbol = symbol;
+            rows = read_newest_first(TRADE_SCAN_TABLE, reader->db, reader->mutex, query);
+        } else {
+            std::lock_guard<std::mutex> lock(database_mutex_);
+            if (!storage_) {
+                return trades;
+            }
+            rows = storage_->get_all<TradeRow>(
+                sqlite_orm::where(sqlite_orm::c(&TradeRow::instrument_symbol) == symbol),
+                sqlite_orm::order_by(&TradeRow::execution_time).desc()
+            );
+        }
 
         trades.reserve(rows.size());
         for (const auto& row : rows) {
@@ -365,13 +958,22 @@ std::vector<std::shared_ptr<Order>> SQLiteService::load_orders_by_symbol(const s
         return orders;
     }
 
-    std::lock_guard<std::mutex> lock(database_mutex_);
-
     try {
-        auto rows = storage_->get_all<OrderRow>(
-            sqlite_orm::where(sqlite_orm::c(&OrderRow::instrument_symbol) == symbol),
-            sqlite_orm::order_by(&OrderRow::created_time).desc()
-        );
+        std::vector<OrderRow> rows;
+        if (ReaderLease reader(*this); reader) {
+            HistoryQuery query;
+            query.instrument_symbol = symbol;
+            rows = read_newest_first(ORDER_SCAN_TABLE, reader->db, reader->mutex, query);
+        } else {
+            std::lock_guard<std::mutex> lock(database_mutex_);
+            if (!storage_) {
+                return orders;
+            }
+            rows = storage_->get_all<OrderRow>(
+                sqlite_orm::where(sqlite_orm::c(&OrderRow::instrument_symbol) == symbol),
+                sqlite_orm::order_by(&OrderRow::created_time).desc()
+            );
+        }
 
         orders.reserve(rows.size());
         for (const auto& row : rows) {
@@ -392,12 +994,19 @@ std::shared_ptr<Position> SQLiteService::load_position_by_symbol(const std::stri
         return nullptr;
     }
 
-    std::lock_guard<std::mutex> lock(database_mutex_);
-
     try {
-        auto rows = storage_->get_all<PositionRow>(
-            sqlite_orm::where(sqlite_orm::c(&PositionRow::instrument_symbol) == symbol)
-        );
+        std::vector<PositionRow> rows;
+        if (ReaderLease reader(*this); reader) {
+            rows = read_positions(reader->db, &symbol);
+        } else {
+            std::lock_guard<std::mutex> lock(database_mutex_);
+            if (!storage_) {
+                return nullptr;
+            }
+            rows = storage_->get_all<PositionRow>(
+                sqlite_orm::where(sqlite_orm::c(&PositionRow::instrument_symbol) == symbol)
+            );
+        }
 
         if (!rows.empty()) {
             return row_to_position(rows[0]);
@@ -415,8 +1024,14 @@ size_t SQLiteService::get_trade_count() const {
     if (!is_initialized_) {
         return 0;
     }
+    if (counts_cached_.load()) {
+        return trade_count_.load();
+    }
 
     std::lock_guard<std::mutex> lock(database_mutex_);
+    if (!storage_) {
+        return 0;
+    }
 
     try {
         return storage_->count<TradeRow>();
@@ -430,8 +1045,14 @@ size_t SQLiteService::get_order_count() const {
     if (!is_initialized_) {
         return 0;
     }
+    if (counts_cached_.load()) {
+        return order_count_.load();
+    }
 
     std::lock_guard<std::mutex> lock(database_mutex_);
+    if (!storage_) {
+        return 0;
+    }
 
     try {
         return storage_->count<OrderRow>();
@@ -445,8 +1066,14 @@ size_t SQLiteService::get_position_count() const {
     if (!is_initialized_) {
         return 0;
     }
+    if (counts_cached_.load()) {
+        return position_count_.load();
+    }
 
     std::lock_guard<std::mutex> lock(database_mutex_);
+    if (!storage_) {
+        return 0;
+    }
 
     try {
         return storage_->count<PositionRow>();
@@ -458,7 +1085,7 @@ size_t SQLiteService::get_position_count() const {
 
 // Helper methods
 
-OrderRow SQLiteService::order_to_row(const Order& order) const {
+OrderRow SQLiteService::order_to_row(const Order& order) {
     OrderRow row;
     row.order_id = order.get_order_id();
     row.instrument_symbol = order.get_instrument_symbol();
@@ -475,7 +1102,7 @@ OrderRow SQLiteService::order_to_row(const Order& order) const {
     return row;
 }
 
-std::shared_ptr<Order> SQLiteService::row_to_order(const OrderRow& row) const {
+std::shared_ptr<Order> SQLiteService::row_to_order(const OrderRow& row) {
     try {
         auto order = std::make_shared<Order>(
             row.order_id,
@@ -483,12 +1110,11 @@ std::shared_ptr<Order> SQLiteService::row_to_order(const OrderRow& row) const {
             static_cast<OrderSide>(row.side),
             static_cast<OrderType>(row.type),
             row.quantity,
-            row.price
+            row.price,
+            unix_to_timepoint(row.created_time)
         );
-
-        // Restore state (this would require additional methods in Order class)
-        // For now, create order in NEW status and let the system manage state
-
+        order->restore_state(static_cast<OrderStatus>(row.status), row.filled_quantity, row.total_fill_value,
+                             unix_to_timepoint(row.last_modified), row.rejection_reason);
         return order;
     } catch (const std::exception& e) {
         log_error("row_to_order", e);
@@ -496,7 +1122,7 @@ std::shared_ptr<Order> SQLiteService::row_to_order(const OrderRow& row) const {
     }
 }
 
-TradeRow SQLiteService::trade_to_row(const Trade& trade) const {
+TradeRow SQLiteService::trade_to_row(const Trade& trade) {
     TradeRow row;
     row.trade_id = trade.get_trade_id();
     row.order_id = trade.get_order_id();
@@ -509,7 +1135,7 @@ TradeRow SQLiteService::trade_to_row(const Trade& trade) const {
     return row;
 }
 
-std::shared_ptr<Trade> SQLiteService::row_to_trade(const TradeRow& row) const {
+std::shared_ptr<Trade> SQLiteService::row_to_trade(const TradeRow& row) {
     try {
         return std::make_shared<Trade>(
             row.trade_id,
@@ -518,7 +1144,8 @@ std::shared_ptr<Trade> SQLiteService::row_to_trade(const TradeRow& row) const {
             static_cast<OrderSide>(row.side),
             row.quantity,
             row.price,
-            static_cast<TradeType>(row.type)
+            static_cast<TradeType>(row.type),
+            unix_to_timepoint(row.execution_time)
         );
     } catch (const std::exception& e) {
         log_error("row_to_trade", e);
@@ -526,7 +1153,7 @@ std::shared_ptr<Trade> SQLiteService::row_to_trade(const TradeRow& row) const {
     }
 }
 
-PositionRow SQLiteService::position_to_row(const Position& position) const {
+PositionRow SQLiteService::position_to_row(const Position& position) {
     PositionRow row;
     row.instrument_symbol = position.get_instrument_symbol();
     row.quantity = position.get_quantity();
@@ -537,13 +1164,11 @@ PositionRow SQLiteService::position_to_row(const Position& position) const {
     return row;
 }
 
-std::shared_ptr<Position> SQLiteService::row_to_position(const PositionRow& row) const {
+std::shared_ptr<Position> SQLiteService::row_to_position(const PositionRow& row) {
     try {
         auto position = std::make_shared<Position>(row.instrument_symbol);
-
-        // Note: Position class would need methods to restore state from database
-        // For now, create empty position and let the system rebuild state
-
+        position->restore_state(row.quantity, row.average_price, row.realized_pnl, row.unrealized_pnl,
+                                unix_to_timepoint(row.last_updated));
         return position;
     } catch (const std::exception& e) {
         log_error("row_to_position", e);
@@ -551,13 +1176,247 @@ std::shared_ptr<Position> SQLiteService::row_to_position(const PositionRow& row)
     }
 }
 
+// Save path
+
+bool SQLiteService::write_row(const OrderRow& row) {
+    if (!storage_) {
+        return false; // Closed by reopen() or restore_from_file() since the caller's initialized check
+    }
+    if (!db_handle_) {
+        storage_->replace(row);
+        return true;
+    }
+
+    sqlite3_stmt* statement = prepare_cached(save_order_statement_,
+        "INSERT INTO orders (order_id, instrument_symbol, side, type, quantity, price, status, "
+        "filled_quantity, total_fill_value, created_time, last_modified, rejection_reason) "
+        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?) "
+        "ON CONFLICT(order_id) DO UPDATE SET instrument_symbol=excluded.instrument_symbol, side=excluded.side, "
+        "type=excluded.type, quantity=excluded.quantity, price=excluded.price, status=excluded.status, "
+        "filled_quantity=excluded.filled_quantity, total_fill_value=excluded.total_fill_value, "
+        "created_time=excluded.created_time, last_modified=excluded.last_modified, "
+        "rejection_reason=excluded.rejection_reason");
+    if (!statement) {
+        return false;
+    }
+
+    sqlite3_bind_text(statement, 1, row.order_id.c_str(), static_cast<int>(row.order_id.size()), SQLITE_STATIC);
+    sqlite3_bind_text(statement, 2, row.instrument_symbol.c_str(), static_cast<int>(row.instrument_symbol.size()), SQLITE_STATIC);
+    sqlite3_bind_int(statement, 3, row.side);
+    sqlite3_bind_int(statement, 4, row.type);
+    sqlite3_bind_double(statement, 5, row.quantity);
+    sqlite3_bind_double(statement, 6, row.price);
+    sqlite3_bind_int(statement, 7, row.status);
+    sqlite3_bind_double(statement, 8, row.filled_quantity);
+    sqlite3_bind_double(statement, 9, row.total_fill_value);
+    sqlite3_bind_int64(statement, 10, row.created_time);
+    sqlite3_bind_int64(statement, 11, row.last_modified);
+    sqlite3_bind_text(statement, 12, row.rejection_reason.c_str(), static_cast<int>(row.rejection_reason.size()), SQLITE_STATIC);
+    return step_counted(statement, "save_order", pending_inserts_.orders);
+}
+
+bool SQLiteService::write_row(const TradeRow& row) {
+    if (!storage_) {
+        return false;
+    }
+    if (!db_handle_) {
+        storage_->replace(row);
+        return true;
+    }
+
+    sqlite3_stmt* statement = prepare_cached(save_trade_statement_,
+        "INSERT INTO trades (trade_id, order_id, instrument_symbol, side, quantity, price, execution_time, type) "
+        "VALUES (?, ?, ?, ?, ?, ?, ?, ?) "
+        "ON CONFLICT(trade_id) DO UPDATE SET order_id=excluded.order_id, instrument_symbol=excluded.instrument_symbol, "
+        "side=excluded.side, quantity=excluded.quantity, price=excluded.price, "
+        "execution_time=excluded.execution_time, type=excluded.type");
+    if (!statement) {
+        return false;
+    }
+
+    sqlite3_bind_text(statement, 1, row.trade_id.c_str(), static_cast<int>(row.trade_id.size()), SQLITE_STATIC);
+    sqlite3_bind_text(statement, 2, row.order_id.c_str(), static_cast<int>(row.order_id.size()), SQLITE_STATIC);
+    sqlite3_bind_text(statement, 3, row.instrument_symbol.c_str(), static_cast<int>(row.instrument_symbol.size()), SQLITE_STATIC);
+    sqlite3_bind_int(statement, 4, row.side);
+    sqlite3_bind_double(statement, 5, row.quantity);
+    sqlite3_bind_double(statement, 6, row.price);
+    sqlite3_bind_int64(statement, 7, row.execution_time);
+    sqlite3_bind_int(statement, 8, row.type);
+    return step_counted(statement, "save_trade", pending_inserts_.trades);
+}
+
+bool SQLiteService::write_row(const PositionRow& row) {
+    if (!storage_) {
+        return false;
+    }
+    if (!db_handle_) {
+        storage_->replace(row);
+        return true;
+    }
+
+    sqlite3_stmt* statement = prepare_cached(save_position_statement_,
+        "INSERT INTO positions (instrument_symbol, quantity, average_price, realized_pnl, unrealized_pnl, last_updated) "
+        "VALUES (?, ?, ?, ?, ?, ?) "
+        "ON CONFLICT(instrument_symbol) DO UPDATE SET quantity=excluded.quantity, "
+        "average_price=excluded.average_price, realized_pnl=excluded.realized_pnl, "
+        "unrealized_pnl=excluded.unrealized_pnl, last_updated=excluded.last_updated");
+    if (!statement) {
+        return false;
+    }
+
+    sqlite3_bind_text(statement, 1, row.instrument_symbol.c_str(), static_cast<int>(row.instrument_symbol.size()), SQLITE_STATIC);
+    sqlite3_bind_double(statement, 2, row.quantity);
+    sqlite3_bind_double(statement, 3, row.average_price);
+    sqlite3_bind_double(statement, 4, row.realized_pnl);
+    sqlite3_bind_double(statement, 5, row.unrealized_pnl);
+    sqlite3_bind_int64(statement, 6, row.last_updated);
+    return step_counted(statement, "update_position", pending_inserts_.positions);
+}
+
+void SQLiteService::release_connection_handles() {
+    // The connection cannot close while a backup or prepared statement still references it
+    if (active_backup_) {
+        sqlite3_backup_finish(active_backup_);
+        active_backup_ = nullptr;
+        Logger::warn("SQLiteService: Aborted backup in progress");
+    }
+    close_readers();
+    save_order_statement_.reset();
+    save_trade_statement_.reset();
+    save_position_statement_.reset();
+    db_handle_ = nullptr;
+    counts_cached_.store(false);
+    pending_inserts_ = RowCounts{};
+}
+
+void SQLiteService::open_readers() {
+    // Readers only help when they do not block the writer
+    if (profile_.reader_connections <= 0 || profile_.journal_mode != "WAL" || database_path_ == ":memory:") {
+        return;
+    }
+
+    const std::string pragmas = profile_.to_reader_pragma_sql();
+    std::lock_guard<std::mutex> lock(reader_pool_mutex_);
+    for (int i = 0; i < profile_.reader_connections; ++i) {
+        sqlite3* db = nullptr;
+        if (sqlite3_open_v2(database_path_.c_str(), &db, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, nullptr) != SQLITE_OK ||
+            sqlite3_exec(db, pragmas.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
+            Logger::warn("SQLiteService: Failed to open reader connection: " +
+                         std::string(db ? sqlite3_errmsg(db) : "out of memory"));
+            sqlite3_close(db);
+            break;
+        }
+        auto reader = std::make_unique<ReaderConnection>();
+        reader->db = db;
+        idle_readers_.push_back(reader.get());
+        readers_.push_back(std::move(reader));
+    }
+}
+
+void SQLiteService::close_readers() {
+    {
+        std::unique_lock<std::mutex> lock(reader_pool_mutex_);
+        closing_readers_ = true;
+        idle_readers_.clear();   // No new leases
+        reader_pool_cv_.wait(lock, [this] { return leased_readers_ == 0; });
+        idle_readers_.clear();
+        for (auto& reader : readers_) {
+            sqlite3_close(reader->db);
+        }
+        readers_.clear();
+        closing_readers_ = false;
+    }
+    reader_pool_cv_.notify_all();   // Waiters in acquire_reader() fall back to the writer
+}
+
+SQLiteService::ReaderConnection* SQLiteService::acquire_reader() {
+    std::unique_lock<std::mutex> lock(reader_pool_mutex_);
+    if (readers_.empty()) {
+        return nullptr;
+    }
+    reader_pool_cv_.wait(lock, [this] { return !idle_readers_.empty() || readers_.empty() || closing_readers_; });
+    if (closing_readers_ || idle_readers_.empty()) {
+        return nullptr;    // Pool closed while waiting
+    }
+    ReaderConnection* reader = idle_readers_.back();
+    idle_readers_.pop_back();
+    ++leased_readers_;
+    return reader;
+}
+
+void SQLiteService::release_reader(ReaderConnection* reader) {
+    {
+        std::lock_guard<std::mutex> lock(reader_pool_mutex_);
+        --leased_readers_;
+        if (!closing_readers_ && std::find_if(readers_.begin(), readers_.end(),
+                                              [reader](const auto& owned) { return owned.get() == reader; }) != readers_.end()) {
+            idle_readers_.push_back(reader);
+        }
+    }
+    reader_pool_cv_.notify_all();
+}
+
+bool SQLiteService::step_counted(sqlite3_stmt* statement, const char* operation, size_t& inserts) {
+    // An upsert that updates leaves the last insert rowid alone, so a nonzero rowid means a new row
+    sqlite3_set_last_insert_rowid(db_handle_, 0);
+    if (!step_statement(statement, operation)) {
+        return false;
+    }
+    if (sqlite3_last_insert_rowid(db_handle_) != 0) {
+        ++inserts;
+    }
+    return true;
+}
+
+void SQLiteService::finish_row_counts(bool committed) {
+    if (committed) {
+        order_count_.fetch_add(pending_inserts_.orders);
+        trade_count_.fetch_add(pending_inserts_.trades);
+        position_count_.fetch_add(pending_inserts_.positions);
+    }
+    pending_inserts_ = RowCounts{};
+}
+
+sqlite3_stmt* SQLiteService::prepare_cached(Statement& statement, const char* sql) {
+    if (!statement) {
+        sqlite3_stmt* prepared = nullptr;
+        if (sqlite3_prepare_v3(db_handle_, sql, -1, SQLITE_PREPARE_PERSISTENT, &prepared, nullptr) != SQLITE_OK) {
+            Logger::error("SQLiteService: Failed to prepare statement: " + std::string(sqlite3_errmsg(db_handle_)));
+            return nullptr;
+        }
+        statement.reset(prepared);
+    }
+    return statement.get();
+}
+
+bool SQLiteService::step_statement(sqlite3_stmt* statement, const char* operation) {
+    int result = sqlite3_step(statement);
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
+    if (result != SQLITE_DONE) {
+        Logger::error("SQLiteService: Error in " + std::string(operation) + ": " + sqlite3_errmsg(db_handle_));
+        return false;
+    }
+    return true;
+}
+
+bool SQLiteService::execute_sql(const char* sql, const char* operation) {
+    char* error = nullptr;
+    if (sqlite3_exec(db_handle_, sql, nullptr, nullptr, &error) != SQLITE_OK) {
+        Logger::error("SQLiteService: Error in " + std::string(operation) + ": " + std::string(error ? error : "unknown"));
+        sqlite3_free(error);
+        return false;
+    }
+    return true;
+}
+
 // Time conversion helpers
 
-std::int64_t SQLiteService::timepoint_to_unix(const std::chrono::system_clock::time_point& tp) const {
+std::int64_t SQLiteService::timepoint_to_unix(const std::chrono::system_clock::time_point& tp) {
     return std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
 }
 
-std::chrono::system_clock::time_point SQLiteService::unix_to_timepoint(std::int64_t unix_time) const {
+std::chrono::system_clock::time_point SQLiteService::unix_to_timepoint(std::int64_t unix_time) {
     return std::chrono::system_clock::from_time_t(unix_time);
 }
 
@@ -585,7 +1444,7 @@ std::pair<std::int64_t, std::int64_t> SQLiteService::get_date_range(
 
 // Error handling
 
-void SQLiteService::log_error(const std::string& operation, const std::exception& e) const {
+void SQLiteService::log_error(const std::string& operation, const std::exception& e) {
     std::string error_msg = "SQLiteService::" + operation + " failed: " + e.what();
     Logger::error("SQLiteService: " + error_msg);
 }
@@ -1,12 +1,17 @@
 #pragma once
 
 #include "contracts/trading_engine_api.hpp"
+#include "utils/config.hpp"
 #include <sqlite_orm/sqlite_orm.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 #include <mutex>
 #include <optional>
+#include <condition_variable>
 
 namespace trading {
 
@@ -51,19 +56,192 @@ struct PositionRow {
     std::int64_t last_updated;   // Unix timestamp
 };
 
+/**
+ * Storage schema shared by every SQLiteService connection. Secondary indexes cover
+ * the columns the load_* and scan_* queries filter and sort on; the symbol indexes
+ * carry the time column so per-symbol scans page through the index without sorting.
+ */
+inline auto make_trading_storage(const std::string& database_path) {
+    using namespace sqlite_orm;
+    return make_storage(database_path,
+        make_index("idx_orders_symbol_created_time", &OrderRow::instrument_symbol, &OrderRow::created_time),
+        make_index("idx_orders_created_time", &OrderRow::created_time),
+        make_index("idx_trades_symbol_execution_time", &TradeRow::instrument_symbol, &TradeRow::execution_time),
+        make_index("idx_trades_execution_time", &TradeRow::execution_time),
+        make_table("orders",
+            make_column("order_id", &OrderRow::order_id, primary_key()),
+            make_column("instrument_symbol", &OrderRow::instrument_symbol),
+            make_column("side", &OrderRow::side),
+            make_column("type", &OrderRow::type),
+            make_column("quantity", &OrderRow::quantity),
+            make_column("price", &OrderRow::price),
+            make_column("status", &OrderRow::status),
+            make_column("filled_quantity", &OrderRow::filled_quantity),
+            make_column("total_fill_value", &OrderRow::total_fill_value),
+            make_column("created_time", &OrderRow::created_time),
+            make_column("last_modified", &OrderRow::last_modified),
+            make_column("rejection_reason", &OrderRow::rejection_reason)
+        ),
+        make_table("trades",
+            make_column("trade_id", &TradeRow::trade_id, primary_key()),
+            make_column("order_id", &TradeRow::order_id),
+            make_column("instrument_symbol", &TradeRow::instrument_symbol),
+            make_column("side", &TradeRow::side),
+            make_column("quantity", &TradeRow::quantity),
+            make_column("price", &TradeRow::price),
+            make_column("execution_time", &TradeRow::execution_time),
+            make_column("type", &TradeRow::type)
+        ),
+        make_table("positions",
+            make_column("instrument_symbol", &PositionRow::instrument_symbol, primary_key()),
+            make_column("quantity", &PositionRow::quantity),
+            make_column("average_price", &PositionRow::average_price),
+            make_column("realized_pnl", &PositionRow::realized_pnl),
+            make_column("unrealized_pnl", &PositionRow::unrealized_pnl),
+            make_column("last_updated", &PositionRow::last_updated)
+        )
+    );
+}
+
+/**
+ * SQLite Tuning Profile
+ * Connection pragmas applied whenever the database is opened
+ */
+struct SQLiteProfile {
+    std::string journal_mode = "WAL";      // WAL, DELETE, TRUNCATE, PERSIST, MEMORY, OFF
+    std::string synchronous = "NORMAL";    // OFF, NORMAL, FULL, EXTRA
+    std::int64_t mmap_size_bytes = 256LL * 1024 * 1024;
+    int cache_size_kib = 64 * 1024;
+    int busy_timeout_ms = 5000;
+    int reader_connections = 2;            // Read-only query connections in WAL mode; 0 = queries use the writer
+
+    static SQLiteProfile from_config(const PersistenceConfig& config);
+    bool is_valid() const;
+    std::string to_pragma_sql() const;
+    std::string to_reader_pragma_sql() const;
+};
+
+/**
+ * Persistence Batch
+ * Rows written together in a single transaction, in enqueue order per table
+ */
+struct PersistenceBatch {
+    std::vector<OrderRow> orders;
+    std::vector<TradeRow> trades;
+    std::vector<PositionRow> positions;
+
+    bool empty() const { return orders.empty() && trades.empty() && positions.empty(); }
+    size_t size() const { return orders.size() + trades.size() + positions.size(); }
+    void clear() {
+        orders.clear();
+        trades.clear();
+        positions.clear();
+    }
+};
+
+/**
+ * Backup Progress
+ * Reported after every step of an online backup
+ */
+struct BackupProgress {
+    int total_pages = 0;
+    int remaining_pages = 0;
+    std::chrono::milliseconds elapsed{0};
+
+    double fraction_complete() const {
+        return total_pages > 0 ? 1.0 - static_cast<double>(remaining_pages) / total_pages : 0.0;
+    }
+};
+
+/**
+ * Backup Options
+ * The source is copied in steps of pages_per_step, taking database_mutex_ only for
+ * each step so writers keep flowing in between
+ */
+struct BackupOptions {
+    int pages_per_step = 256;
+    std::chrono::milliseconds step_pause{2};
+    std::function<void(const BackupProgress&)> on_progress;
+    const std::atomic<bool>* cancel_requested = nullptr;
+};
+
+/**
+ * Resume Token
+ * Sort key of the last row a history scan delivered; the next scan starts after it.
+ * Serialises as "<time>:<id>" so reporting jobs can persist it between runs.
+ */
+struct ResumeToken {
+    std::int64_t time = 0;
+    std::string id;
+
+    bool empty() const { return id.empty(); }
+    std::string to_string() const;
+    static std::optional<ResumeToken> parse(const std::string& token);
+};
+
+/**
+ * History Query
+ * Filter, projection and paging for streaming scans. Rows arrive in (time, id)
+ * order, page_size rows per database_mutex_ hold; columns limits the fields read
+ * (empty reads all, the sort key is always read).
+ */
+struct HistoryQuery {
+    std::optional<std::string> instrument_symbol;
+    std::chrono::system_clock::time_point from = std::chrono::system_clock::time_point::min();   // Inclusive
+    std::chrono::system_clock::time_point to = std::chrono::system_clock::time_point::max();     // Inclusive
+    std::vector<std::string> columns;
+    size_t page_size = 1000;
+    size_t max_rows = 0;         // 0 = no limit
+    ResumeToken resume_after;
+};
+
+/**
+ * Scan Result
+ * next is the resume token for the following scan; complete is set once the
+ * last matching row has been delivered
+ */
+struct ScanResult {
+    size_t rows = 0;
+    ResumeToken next;
+    bool complete = false;
+    bool ok = true;
+};
+
+// Return false to stop a scan early
+using TradeRowVisitor = std::function<bool(const TradeRow&)>;
+using OrderRowVisitor = std::function<bool(const OrderRow&)>;
+
+/**
+ * History scans over any open connection. schema names the database to read
+ * ("main" or an ATTACH alias) and must be a plain identifier; db is read under
+ * mutex, which is held for one page at a time.
+ */
+ScanResult scan_trade_rows(sqlite3* const& db, std::mutex& mutex, const std::string& schema,
+                           const HistoryQuery& query, const TradeRowVisitor& visitor);
+ScanResult scan_order_rows(sqlite3* const& db, std::mutex& mutex, const std::string& schema,
+                           const HistoryQuery& query, const OrderRowVisitor& visitor);
+
 /**
  * SQLite Persistence Service
- * Implements ACID-compliant storage for trading data using sqlite_orm
+ * Implements ACID-compliant storage for trading data using sqlite_orm. Writes go
+ * through one connection behind database_mutex_; in WAL mode queries lease one of
+ * a pool of read-only connections instead, and row counts are kept by the writer,
+ * so reporting and UI polling never wait on order and trade persistence.
  */
 class SQLiteService : public IPersistenceService {
 public:
-    explicit SQLiteService(const std::string& database_path);
+    explicit SQLiteService(const std::string& database_path, const SQLiteProfile& profile = SQLiteProfile{});
     virtual ~SQLiteService();
 
     // Database initialization
     bool initialize();
     void close();
 
+    // Switch the connection to another database file; carry_positions copies the
+    // positions table across while writers are held off
+    bool reopen(const std::string& database_path, bool carry_positions);
+    std::string get_database_path() const;
+
     // IPersistenceService implementation
     bool save_trade(const Trade& trade) override;
     bool save_order(const Order& order) override;
@@ -86,74 +264,118 @@ public:
     std::vector<std::shared_ptr<Order>> load_orders_by_symbol(const std::string& symbol);
     std::shared_ptr<Position> load_position_by_symbol(const std::string& symbol);
 
-    // Statistics
+    // Streaming history scans - bounded memory, the lock is released between pages
+    ScanResult scan_trades(const HistoryQuery& query, const TradeRowVisitor& visitor);
+    ScanResult scan_orders(const HistoryQuery& query, const OrderRowVisitor& visitor);
+
+    // Online backup with the sqlite3_backup API; the file appears under filepath only once complete
+    bool backup_online(const std::string& filepath, const BackupOptions& options);
+
+    // Batched writes - all rows are committed in one transaction or none are
+    bool save_batch(const PersistenceBatch& batch);
+
+    // Row conversion (also used to snapshot domain objects for write-behind persistence)
+    static OrderRow order_to_row(const Order& order);
+    static TradeRow trade_to_row(const Trade& trade);
+    static PositionRow position_to_row(const Position& position);
+    static std::shared_ptr<Order> row_to_order(const OrderRow& row);
+    static std::shared_ptr<Trade> row_to_trade(const TradeRow& row);
+    static std::shared_ptr<Position> row_to_position(const PositionRow& row);
+
+    // Statistics - cached by the writer for file-backed databases
     size_t get_trade_count() const;
     size_t get_order_count() const;
     size_t get_position_count() const;
 
 private:
+    struct StatementDeleter {
+        void operator()(sqlite3_stmt* statement) const { sqlite3_finalize(statement); }
+    };
+    using Statement = std::unique_ptr<sqlite3_stmt, StatementDeleter>;
+
     std::string database_path_;
-    bool is_initialized_;
+    SQLiteProfile profile_;
+    // Read without the lock as a fast path; storage_ and db_handle_ are re-checked under database_mutex_
+    std::atomic<bool> is_initialized_;
     mutable std::mutex database_mutex_;
 
+    // Raw handle of the persistent connection (null for in-memory databases, which use the ORM paths)
+    sqlite3* db_handle_;
+
+    // Online backup in progress on db_handle_, finished early by close()
+    sqlite3_backup* active_backup_;
+
+    // Cached save statements, prepared on first use
+    Statement save_order_statement_;
+    Statement save_trade_statement_;
+    Statement save_position_statement_;
+
     // sqlite_orm storage type
-    using Storage = decltype(sqlite_orm::make_storage("",
-        sqlite_orm::make_table("orders",
-            sqlite_orm::make_column("order_id", &OrderRow::order_id, sqlite_orm::primary_key()),
-            sqlite_orm::make_column("instrument_symbol", &OrderRow::instrument_symbol),
-            sqlite_orm::make_column("side", &OrderRow::side),
-            sqlite_orm::make_column("type", &OrderRow::type),
-            sqlite_orm::make_column("quantity", &OrderRow::quantity),
-            sqlite_orm::make_column("price", &OrderRow::price),
-            sqlite_orm::make_column("status", &OrderRow::status),
-            sqlite_orm::make_column("filled_quantity", &OrderRow::filled_quantity),
-            sqlite_orm::make_column("total_fill_value", &OrderRow::total_fill_value),
-            sqlite_orm::make_column("created_time", &OrderRow::created_time),
-            sqlite_orm::make_column("last_modified", &OrderRow::last_modified),
-            sqlite_orm::make_column("rejection_reason", &OrderRow::rejection_reason)
-        ),
-        sqlite_orm::make_table("trades",
-            sqlite_orm::make_column("trade_id", &TradeRow::trade_id, sqlite_orm::primary_key()),
-            sqlite_orm::make_column("order_id", &TradeRow::order_id),
-            sqlite_orm::make_column("instrument_symbol", &TradeRow::instrument_symbol),
-            sqlite_orm::make_column("side", &TradeRow::side),
-            sqlite_orm::make_column("quantity", &TradeRow::quantity),
-            sqlite_orm::make_column("price", &TradeRow::price),
-            sqlite_orm::make_column("execution_time", &TradeRow::execution_time),
-            sqlite_orm::make_column("type", &TradeRow::type)
-        ),
-        sqlite_orm::make_table("positions",
-            sqlite_orm::make_column("instrument_symbol", &PositionRow::instrument_symbol, sqlite_orm::primary_key()),
-            sqlite_orm::make_column("quantity", &PositionRow::quantity),
-            sqlite_orm::make_column("average_price", &PositionRow::average_price),
-            sqlite_orm::make_column("realized_pnl", &PositionRow::realized_pnl),
-            sqlite_orm::make_column("unrealized_pnl", &PositionRow::unrealized_pnl),
-            sqlite_orm::make_column("last_updated", &PositionRow::last_updated)
-        )
-    ));
+    using Storage = decltype(make_trading_storage(""));
 
     std::unique_ptr<Storage> storage_;
 
-    // Helper methods
-    OrderRow order_to_row(const Order& order) const;
-    std::shared_ptr<Order> row_to_order(const OrderRow& row) const;
+    // Read-only query connections, leased for one query at a time
+    struct ReaderConnection {
+        sqlite3* db = nullptr;
+        std::mutex mutex;        // Held by scans for one page at a time
+    };
+    class ReaderLease;
+    std::vector<std::unique_ptr<ReaderConnection>> readers_;
+    std::vector<ReaderConnection*> idle_readers_;
+    size_t leased_readers_;
+    bool closing_readers_;   // Set while close_readers() waits; returned leases are not pooled again
+    std::mutex reader_pool_mutex_;
+    std::condition_variable reader_pool_cv_;
+
+    // Row counts maintained by the writer when db_handle_ is set; inserts are staged until commit
+    struct RowCounts {
+        size_t orders = 0;
+        size_t trades = 0;
+        size_t positions = 0;
+    };
+    std::atomic<bool> counts_cached_;
+    std::atomic<size_t> order_count_;
+    std::atomic<size_t> trade_count_;
+    std::atomic<size_t> position_count_;
+    RowCounts pending_inserts_;
 
-    TradeRow trade_to_row(const Trade& trade) const;
-    std::shared_ptr<Trade> row_to_trade(const TradeRow& row) const;
+    // Open storage_ on database_path_ (caller holds database_mutex_)
+    bool open_storage();
 
-    PositionRow position_to_row(const Position& position) const;
-    std::shared_ptr<Position> row_to_position(const PositionRow& row) const;
+    // Reader pool; open and close run under database_mutex_, close waits for leases to return
+    void open_readers();
+    void close_readers();
+    ReaderConnection* acquire_reader();   // nullptr when there is no pool
+    void release_reader(ReaderConnection* reader);
+
+    // Step an upsert, staging it in inserts if it added a row
+    bool step_counted(sqlite3_stmt* statement, const char* operation, size_t& inserts);
+    // Fold staged inserts into the cached counts, or drop them after a rollback
+    void finish_row_counts(bool committed);
 
     // Time conversion helpers
-    std::int64_t timepoint_to_unix(const std::chrono::system_clock::time_point& tp) const;
-    std::chrono::system_clock::time_point unix_to_timepoint(std::int64_t unix_time) const;
+    static std::int64_t timepoint_to_unix(const std::chrono::system_clock::time_point& tp);
+    static std::chrono::system_clock::time_point unix_to_timepoint(std::int64_t unix_time);
 
     // Date range helpers
     std::pair<std::int64_t, std::int64_t> get_date_range(
         const std::chrono::system_clock::time_point& date) const;
 
+    // Finish the backup and statements that reference db_handle_ (caller holds database_mutex_)
+    void release_connection_handles();
+
+    // Save path (caller holds database_mutex_)
+    bool write_batch(const PersistenceBatch& batch);
+    bool write_row(const OrderRow& row);
+    bool write_row(const TradeRow& row);
+    bool write_row(const PositionRow& row);
+    sqlite3_stmt* prepare_cached(Statement& statement, const char* sql);
+    bool step_statement(sqlite3_stmt* statement, const char* operation);
+    bool execute_sql(const char* sql, const char* operation);
+
     // Error handling
-    void log_error(const std::string& operation, const std::exception& e) const;
+    static void log_error(const std::string& operation, const std::exception& e);
     bool handle_database_error(const std::string& operation) const;
 };
 
@@ -3,69 +3,108 @@
 #include <signal.h>
 #include <thread>
 #include <chrono>
+#include <cstdlib>
+#include <optional>
+#include <string>
 
 // Core components
 #include "core/engine/trading_engine.hpp"
 #include "core/risk/risk_manager.hpp"
 #include "infrastructure/persistence/sqlite_service.hpp"
+#include "infrastructure/persistence/async_persistence_writer.hpp"
+#include "infrastructure/persistence/event_journal.hpp"
+#include "infrastructure/persistence/journal_compactor.hpp"
+#include "infrastructure/persistence/snapshot_store.hpp"
+#include "infrastructure/persistence/backup_scheduler.hpp"
+#include "infrastructure/persistence/eod_exporter.hpp"
+#include "infrastructure/persistence/partition_manager.hpp"
 #include "infrastructure/market_data/market_data_provider.hpp"
 
 // UI components
 #include "ui/managers/ui_manager.hpp"
+#include "ui/models/ui_data_model.hpp"
 #include "ui/rendering/opengl_context.hpp"
-#include "ui/components/market_data_panel.hpp"
-#include "ui/components/order_entry_panel.hpp"
-#include "ui/components/positions_panel.hpp"
-#include "ui/components/trades_panel.hpp"
-#include "ui/components/status_panel.hpp"
 
 // Utilities
 #include "utils/config.hpp"
+#include "utils/config_watcher.hpp"
 #include "utils/logging.hpp"
+#include "utils/async_logging.hpp"
+#include "utils/binary_event_log.hpp"
 #include "utils/exceptions.hpp"
 
 using namespace trading;
 
+/**
+ * Command line overrides, applied on top of the configuration file
+ */
+struct LaunchOptions {
+    std::string config_path = "config/trading_system.json";
+    std::optional<bool> headless;
+    std::optional<int> stats_interval_seconds;
+};
+
 class TradingApplication {
 private:
     // Core components
     std::shared_ptr<ConfigurationManager> config_manager_;
+    std::unique_ptr<ConfigWatcher> config_watcher_;
     TradingSystemConfig config_;
     std::shared_ptr<SQLiteService> persistence_;
+    std::shared_ptr<AsyncPersistenceWriter> async_persistence_;
+    std::shared_ptr<EventJournal> event_journal_;
+    std::shared_ptr<JournalCompactor> journal_compactor_;
+    std::shared_ptr<SnapshotStore> snapshot_store_;
+    std::shared_ptr<BackupScheduler> backup_scheduler_;
+    std::shared_ptr<DayPartitionManager> partition_manager_;
+    std::shared_ptr<BinaryEventLog> binary_event_log_;
     std::shared_ptr<RiskManager> risk_manager_;
     std::shared_ptr<MarketDataProvider> market_data_provider_;
     std::shared_ptr<TradingEngine> trading_engine_;
 
     // UI components
     std::shared_ptr<ui::UIManager> ui_manager_;
-    std::shared_ptr<ui::MarketDataPanel> market_data_panel_;
-    std::shared_ptr<ui::OrderEntryPanel> order_entry_panel_;
-    std::shared_ptr<ui::PositionsPanel> positions_panel_;
-    std::shared_ptr<ui::TradesPanel> trades_panel_;
-    std::shared_ptr<ui::StatusPanel> status_panel_;
+    std::shared_ptr<ui::UIDataModel> ui_data_model_;   // Backend threads publish, the UI thread reads per frame
 
     // Application state
+    LaunchOptions options_;
     std::atomic<bool> running_;
     std::atomic<bool> shutdown_requested_;
 
+    // Set by SIGINT/SIGTERM; the handler does nothing else, run() notices and returns
+    static std::atomic<bool> stop_signal_;
+    static_assert(std::atomic<bool>::is_always_lock_free, "stop flag must be safe to set from a signal handler");
+
 public:
-    TradingApplication() : running_(false), shutdown_requested_(false) {}
+    explicit TradingApplication(LaunchOptions options = {})
+        : options_(std::move(options)), running_(false), shutdown_requested_(false) {}
 
     bool initialize() {
         try {
             LOG_INFO("Initializing Trading System...");
 
             // Load configuration
-            config_manager_ = std::make_shared<ConfigurationManager>();
+            config_manager_ = std::make_shared<ConfigurationManager>(options_.config_path);
             config_ = config_manager_->get_configuration();
             if (!load_configuration()) {
                 LOG_ERROR("Failed to load configuration");
                 return false;
             }
+            if (options_.headless) {
+                config_.headless = *options_.headless;
+            }
+            if (options_.stats_interval_seconds) {
+                config_.stats_interval_seconds = *options_.stats_interval_seconds;
+            }
 
             // Initialize logging
             initialize_logging();
 
+            // Panels are the only consumer of the UI data model; without them nothing would drain it
+            if (!config_.headless) {
+                ui_data_model_ = std::make_shared<ui::UIDataModel>();
+            }
+
             // Initialize core components
             if (!initialize_persistence()) {
                 LOG_ERROR("Failed to initialize persistence service");
@@ -88,13 +127,16 @@ public:
             }
 
             // Initialize UI components
-            if (!initialize_ui()) {
+            if (config_.headless) {
+                LOG_INFO("Running headless: no UI");
+                running_ = true;
+            } else if (!initialize_ui()) {
                 LOG_ERROR("Failed to initialize UI");
                 return false;
             }
 
-            // Setup signal handlers
-            setup_signal_handlers();
+            // Apply config file edits to the running components
+            setup_config_reload();
 
             LOG_INFO("Trading System initialized successfully");
             return true;
@@ -126,9 +168,19 @@ public:
                 TRADING_LOG_INFO("Subscribed to {}", symbol);
             }
 
-            // Start UI main loop
-            LOG_INFO("Starting UI...");
-            ui_manager_->run(); // This blocks until UI is closed
+            if (ui_manager_) {
+                // Start UI main loop
+                LOG_INFO("Starting UI...");
+                std::jthread signal_watcher([this](std::stop_token ui_closed) {
+                    while (!ui_closed.stop_requested() && !stop_signal_.load()) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    }
+                    ui_manager_->request_close();
+                });
+                ui_manager_->run(); // This blocks until UI is closed or a stop signal arrives
+            } else {
+                run_service_loop();
+            }
 
         } catch (const std::exception& e) {
             TRADING_LOG_ERROR("Exception during execution: {}", e.what());
@@ -138,11 +190,17 @@ public:
     }
 
     void shutdown() {
+        if (shutdown_requested_.exchange(true)) {
+            return;
+        }
         LOG_INFO("Shutdown requested");
-        shutdown_requested_ = true;
 
         try {
             // Shutdown components in reverse order
+            if (config_watcher_) {
+                config_watcher_->stop();
+            }
+
             if (ui_manager_) {
                 ui_manager_->shutdown();
             }
@@ -155,10 +213,50 @@ public:
                 trading_engine_->shutdown();
             }
 
+            if (event_journal_) {
+                event_journal_->flush();
+            }
+
+            if (journal_compactor_) {
+                journal_compactor_->stop();
+            }
+
+            if (event_journal_) {
+                event_journal_->close();
+            }
+
+            if (async_persistence_) {
+                async_persistence_->stop();
+            }
+
+            // End-of-day export once every pending write has reached SQLite
+            if (persistence_ && (config_.persistence.auto_export_trades || config_.persistence.auto_export_orders)) {
+                EodExporter exporter(persistence_, EodExporter::from_config(config_.persistence));
+                auto report = exporter.export_day(std::chrono::system_clock::now());
+                if (!report.success) {
+                    TRADING_LOG_ERROR("End-of-day export to {} failed", report.directory);
+                }
+            }
+
+            if (backup_scheduler_) {
+                backup_scheduler_->stop();
+            }
+
+            if (partition_manager_) {
+                partition_manager_->stop();
+            }
+
             if (persistence_) {
                 persistence_->close();
             }
 
+            if (binary_event_log_) {
+                binary_event_log_->close();
+            }
+
+            // Write out queued hot-path records before the sinks go away
+            AsyncLogger::stop();
+
             running_ = false;
             LOG_INFO("Trading System shutdown complete");
 
@@ -198,13 +296,38 @@ private:
         auto log_config = config_.logging;
 
         Logger::initialize(log_config.log_file_path);
+        if (log_config.async_enabled) {
+            AsyncLogger::Config async_config;
+            async_config.queue_capacity = static_cast<size_t>(log_config.async_queue_capacity);
+            AsyncLogger::start(async_config);
+        }
+        if (log_config.binary_event_log) {
+            BinaryEventLog::Config event_log_config;
+            event_log_config.directory = log_config.event_log_directory;
+            event_log_config.segment_size_bytes = static_cast<size_t>(log_config.event_log_segment_size_mb) * 1024 * 1024;
+            binary_event_log_ = std::make_shared<BinaryEventLog>(event_log_config);
+            if (!binary_event_log_->open()) {
+                TRADING_LOG_WARN("Binary event log unavailable; continuing without it");
+                binary_event_log_.reset();
+            }
+        }
         TRADING_LOG_INFO("Logging initialized: level={}, file={}",
                         log_config.log_level, log_config.log_file_path);
     }
 
     bool initialize_persistence() {
-        persistence_ = std::make_shared<SQLiteService>(config_.persistence.database_path);
-        if (!persistence_->initialize()) {
+        persistence_ = std::make_shared<SQLiteService>(config_.persistence.database_path,
+                                                       SQLiteProfile::from_config(config_.persistence));
+
+        // With day partitions the service opens today's file instead of database_path
+        if (config_.persistence.partition_by_day) {
+            partition_manager_ = std::make_shared<DayPartitionManager>(
+                persistence_, DayPartitionManager::from_config(config_.persistence));
+            if (!partition_manager_->open()) {
+                return false;
+            }
+            partition_manager_->start();
+        } else if (!persistence_->initialize()) {
             return false;
         }
 
@@ -213,6 +336,45 @@ private:
             return false;
         }
 
+        if (config_.persistence.async_writes) {
+            AsyncPersistenceWriter::Config writer_config;
+            writer_config.batch_size = static_cast<size_t>(config_.persistence.async_batch_size);
+            writer_config.flush_interval = std::chrono::milliseconds(config_.persistence.async_flush_interval_ms);
+            writer_config.queue_capacity = static_cast<size_t>(config_.persistence.async_queue_capacity);
+            async_persistence_ = std::make_shared<AsyncPersistenceWriter>(persistence_, writer_config);
+            async_persistence_->start();
+        }
+
+        if (config_.persistence.journal_enabled) {
+            EventJournal::Config journal_config;
+            journal_config.directory = config_.persistence.journal_directory;
+            journal_config.segment_size_bytes = static_cast<size_t>(config_.persistence.journal_segment_size_mb) * 1024 * 1024;
+            journal_config.sync_on_commit = config_.persistence.journal_sync_on_commit;
+            journal_config.retain_for_snapshots = true;
+            event_journal_ = std::make_shared<EventJournal>(journal_config);
+            if (!event_journal_->open()) {
+                TRADING_LOG_ERROR("Failed to open event journal at {}", journal_config.directory);
+                return false;
+            }
+
+            // Starting the compactor folds any records left by a previous run before positions are loaded
+            JournalCompactor::Config compactor_config;
+            compactor_config.interval = std::chrono::milliseconds(config_.persistence.journal_compaction_interval_ms);
+            journal_compactor_ = std::make_shared<JournalCompactor>(event_journal_, persistence_, compactor_config);
+            journal_compactor_->start();
+
+            SnapshotStore::Config snapshot_config;
+            snapshot_config.directory = config_.persistence.snapshot_directory;
+            snapshot_config.retain_count = static_cast<size_t>(config_.persistence.snapshot_retain_count);
+            snapshot_store_ = std::make_shared<SnapshotStore>(snapshot_config);
+        }
+
+        if (config_.persistence.auto_backup) {
+            backup_scheduler_ = std::make_shared<BackupScheduler>(persistence_,
+                                                                  BackupScheduler::from_config(config_.persistence));
+            backup_scheduler_->start();
+        }
+
         TRADING_LOG_INFO("Persistence service initialized: {}", persistence_->get_status());
         return true;
     }
@@ -238,32 +400,25 @@ private:
 
         // Set up market data callbacks
         market_data_provider_->set_tick_callback([this](const MarketTick& tick) {
-            // Update market data panel
-            if (market_data_panel_) {
-                std::vector<ui::MarketDataRow> data;
-                ui::MarketDataRow row;
-                row.symbol = tick.instrument_symbol;
-                row.bid_price = tick.bid_price;
-                row.ask_price = tick.ask_price;
-                row.last_price = tick.last_price;
-                row.spread = tick.get_spread();
-                row.change_percent = 0.0; // Would be calculated from previous price
-                row.last_update = tick.timestamp;
-                row.is_stale = false;
-                data.push_back(row);
-                market_data_panel_->update_data(data);
-            }
-
-            // Update status panel
-            if (status_panel_) {
-                status_panel_->update_heartbeat();
+            // Feed heartbeat for the circuit breaker's staleness trigger
+            if (risk_manager_) {
+                risk_manager_->on_market_data(tick);
+            }
+
+            if (binary_event_log_) {
+                binary_event_log_->log_market_data(tick.instrument_symbol, tick.bid_price, tick.ask_price,
+                                                   tick.last_price, tick.volume, tick.timestamp);
+            }
+
+            if (ui_data_model_) {
+                ui_data_model_->publish_quote(tick);
             }
         });
 
         market_data_provider_->set_connection_callback([this](bool connected) {
             TRADING_LOG_INFO("Market data connection status: {}", connected ? "Connected" : "Disconnected");
-            if (status_panel_) {
-                status_panel_->set_market_data_connected(connected);
+            if (ui_data_model_) {
+                ui_data_model_->publish_connection(connected);
             }
         });
 
@@ -273,35 +428,55 @@ private:
 
     bool initialize_trading_engine() {
         trading_engine_ = std::make_shared<TradingEngine>(risk_manager_, persistence_);
+        if (async_persistence_) {
+            trading_engine_->set_async_persistence(async_persistence_);
+        }
+        if (event_journal_) {
+            trading_engine_->set_event_journal(event_journal_);
+        }
+        if (binary_event_log_) {
+            trading_engine_->set_binary_event_log(binary_event_log_);
+        }
+        if (snapshot_store_) {
+            trading_engine_->set_snapshot_store(snapshot_store_,
+                                                std::chrono::seconds(config_.persistence.snapshot_interval_seconds));
+        }
+        trading_engine_->set_position_flush_interval(
+            std::chrono::milliseconds(config_.persistence.position_flush_interval_ms));
         if (!trading_engine_->initialize()) {
             return false;
         }
 
         // Set up trading engine callbacks
+        // The engine already logs each order and fill at INFO; these per-event traces stay off the
+        // callback thread's critical path and compile out of release builds
         trading_engine_->set_order_update_callback([this](const ExecutionReport& report) {
-            TRADING_LOG_INFO("Order update: {} - {} -> {}", report.order_id,
+            ASYNC_LOG_DEBUG("Order update: {} - {} -> {}", report.order_id,
                     order_status_to_string(report.old_status),
                     order_status_to_string(report.new_status));
 
-            // Update UI panels
-            update_order_displays();
+            if (ui_data_model_) {
+                ui_data_model_->publish_order(report);
+            }
         });
 
         trading_engine_->set_trade_callback([this](const Trade& trade) {
-            TRADING_LOG_INFO("Trade executed: {} {} {} @ {}", trade.get_trade_id(),
-                    trade.get_side() == OrderSide::BUY ? "BUY" : "SELL",
+            ASYNC_LOG_DEBUG("Trade executed: {} {} {} @ {}", trade.get_trade_id(),
+                    order_side_to_string(trade.get_side()),
                     trade.get_quantity(), trade.get_price());
 
-            // Update UI panels
-            update_trade_displays();
+            if (ui_data_model_) {
+                ui_data_model_->publish_trade(trade);
+            }
         });
 
         trading_engine_->set_position_update_callback([this](const Position& position) {
-            TRADING_LOG_INFO("Position updated: {} - {} @ {}", position.get_instrument_symbol(),
+            ASYNC_LOG_DEBUG("Position updated: {} - {} @ {}", position.get_instrument_symbol(),
                     position.get_quantity(), position.get_average_price());
 
-            // Update UI panels
-            update_position_displays();
+            if (ui_data_model_) {
+                ui_data_model_->publish_position(position);
+            }
         });
 
         LOG_INFO("Trading engine initialized");
@@ -311,17 +486,13 @@ private:
     bool initialize_ui() {
         try {
             // Initialize UI manager
-            ui_manager_ = std::make_shared<ui::UIManager>();
+            ui::UIManager::UIManagerConfig ui_config;
+            apply_ui_config(ui_config, config_.ui);
+            ui_manager_ = std::make_shared<ui::UIManager>(ui_config);
             if (!ui_manager_->initialize()) {
                 return false;
             }
-
-            // Create UI panels
-            market_data_panel_ = std::make_shared<ui::MarketDataPanel>();
-            order_entry_panel_ = std::make_shared<ui::OrderEntryPanel>();
-            positions_panel_ = std::make_shared<ui::PositionsPanel>();
-            trades_panel_ = std::make_shared<ui::TradesPanel>();
-            status_panel_ = std::make_shared<ui::StatusPanel>();
+            ui_manager_->set_data_model(ui_data_model_);
 
             // Setup panel callbacks
             setup_ui_callbacks();
@@ -336,9 +507,69 @@ private:
         }
     }
 
+    void setup_config_reload() {
+        config_manager_->subscribe(ConfigSection::RISK_MANAGEMENT,
+            [this](const TradingSystemConfig&, const TradingSystemConfig& current) {
+                risk_manager_->update_config(current.risk_management);
+                LOG_INFO("Risk limits updated from configuration");
+            });
+
+        config_manager_->subscribe(ConfigSection::MARKET_DATA,
+            [this](const TradingSystemConfig& previous, const TradingSystemConfig& current) {
+                const auto& before = previous.market_data.symbols;
+                const auto& after = current.market_data.symbols;
+                for (const auto& symbol : after) {
+                    if (std::find(before.begin(), before.end(), symbol) == before.end() &&
+                        market_data_provider_->subscribe(symbol)) {
+                        TRADING_LOG_INFO("Subscribed to {}", symbol);
+                    }
+                }
+                for (const auto& symbol : before) {
+                    if (std::find(after.begin(), after.end(), symbol) == after.end() &&
+                        market_data_provider_->unsubscribe(symbol)) {
+                        TRADING_LOG_INFO("Unsubscribed from {}", symbol);
+                    }
+                }
+            });
+
+        // Panel state belongs to the UI thread
+        config_manager_->subscribe(ConfigSection::UI,
+            [this](const TradingSystemConfig&, const TradingSystemConfig& current) {
+                if (!ui_manager_) {
+                    return;
+                }
+                ui_manager_->post_to_ui_thread([this, ui_config = current.ui]() {
+                    auto manager_config = ui_manager_->get_config();
+                    apply_ui_config(manager_config, ui_config);
+                    ui_manager_->set_config(manager_config);
+                    LOG_INFO("UI settings updated from configuration");
+                });
+            });
+
+        for (auto section : {ConfigSection::PERSISTENCE, ConfigSection::LOGGING}) {
+            config_manager_->subscribe(section, [](const TradingSystemConfig&, const TradingSystemConfig&) {
+                TRADING_LOG_WARN("Persistence and logging settings take effect after a restart");
+            });
+        }
+
+        if (config_.hot_reload) {
+            config_watcher_ = std::make_unique<ConfigWatcher>(config_manager_);
+            config_watcher_->start();
+        }
+    }
+
+    static void apply_ui_config(ui::UIManager::UIManagerConfig& manager_config, const UIConfig& ui_config) {
+        manager_config.ui_refresh_rate_ms = ui_config.refresh_rate_ms;
+        manager_config.data_update_rate_ms = ui_config.market_data_refresh;
+        manager_config.price_precision = ui_config.precision;
+        manager_config.auto_sort = ui_config.auto_sort;
+        manager_config.show_unrealized_pnl = ui_config.show_unrealized_pnl;
+        manager_config.max_displayed_trades = ui_config.max_trade_history;
+    }
+
     void setup_ui_callbacks() {
         // Order entry callbacks
-        order_entry_panel_->set_submit_callback([this](const ui::OrderFormData& form_data) {
+        ui_manager_->set_order_submit_callback([this](const ui::OrderFormData& form_data) {
             try {
                 OrderRequest request;
                 request.instrument_symbol = form_data.symbol;
@@ -351,7 +582,6 @@ private:
                 std::string order_id = trading_engine_->submit_order(request);
                 if (!order_id.empty()) {
                     TRADING_LOG_INFO("Order submitted: {}", order_id);
-                    order_entry_panel_->reset_form();
                 } else {
                     LOG_ERROR("Failed to submit order");
                 }
@@ -361,152 +591,124 @@ private:
         });
 
         // Market data panel callbacks
-        market_data_panel_->set_symbol_click_callback([this](const std::string& symbol) {
-            order_entry_panel_->set_instrument(symbol);
-            TRADING_LOG_INFO("Selected symbol: {}", symbol);
-        });
-
-        market_data_panel_->set_subscribe_callback([this](const std::string& symbol) {
+        ui_manager_->set_symbol_subscribe_callback([this](const std::string& symbol) {
             if (market_data_provider_->subscribe(symbol)) {
                 TRADING_LOG_INFO("Subscribed to {}", symbol);
             } else {
                 TRADING_LOG_ERROR("Failed to subscribe to {}", symbol);
             }
         });
-
-        // Position panel callbacks
-        positions_panel_->set_position_click_callback([this](const std::string& symbol) {
-            order_entry_panel_->set_instrument(symbol);
-            TRADING_LOG_INFO("Selected position: {}", symbol);
-        });
     }
 
-    void update_order_displays() {
-        if (!ui_manager_) return;
-
-        try {
-            auto working_orders = trading_engine_->get_working_orders();
-            std::vector<ui::OrderRow> order_rows;
-
-            for (const auto& order : working_orders) {
-                ui::OrderRow row;
-                row.order_id = order->get_order_id();
-                row.symbol = order->get_instrument_symbol();
-                row.side = (order->get_side() == OrderSide::BUY) ? "BUY" : "SELL";
-                row.type = (order->get_type() == OrderType::MARKET) ? "MARKET" : "LIMIT";
-                row.status = order_status_to_string(order->get_status());
-                row.quantity = order->get_quantity();
-                row.price = order->get_price();
-                row.filled_quantity = order->get_filled_quantity();
-                row.remaining_quantity = order->get_remaining_quantity();
-                row.created_time = order->get_created_time();
-                row.last_modified = order->get_last_modified();
-                order_rows.push_back(row);
-            }
-
-            // Update UI with order data
-            // ui_manager_->update_orders(order_rows);
-
-        } catch (const std::exception& e) {
-            TRADING_LOG_ERROR("Error updating order displays: {}", e.what());
-        }
+public:
+    // SIGINT/SIGTERM only raise the stop flag; a second signal falls back to the default action,
+    // so a shutdown that hangs can still be interrupted
+    static void install_signal_handlers() {
+        signal(SIGINT, on_stop_signal);
+        signal(SIGTERM, on_stop_signal);
     }
 
-    void update_trade_displays() {
-        if (!trades_panel_) return;
-
-        try {
-            auto daily_trades = trading_engine_->get_daily_trades();
-            std::vector<ui::TradeRow> trade_rows;
+private:
+    static void on_stop_signal(int signal_number) {
+        stop_signal_.store(true);
+        signal(signal_number, SIG_DFL);
+    }
 
-            for (const auto& trade : daily_trades) {
-                ui::TradeRow row;
-                row.trade_id = trade->get_trade_id();
-                row.order_id = trade->get_order_id();
-                row.symbol = trade->get_instrument_symbol();
-                row.side = (trade->get_side() == OrderSide::BUY) ? "BUY" : "SELL";
-                row.quantity = trade->get_quantity();
-                row.price = trade->get_price();
-                row.notional_value = trade->get_notional_value();
-                row.execution_time = trade->get_execution_time();
-                trade_rows.push_back(row);
+    // Headless main thread: wait for a stop signal, logging a status line every stats interval
+    void run_service_loop() {
+        LOG_INFO("Running as a service; send SIGINT or SIGTERM to stop");
+        auto last_stats = std::chrono::steady_clock::now();
+        size_t last_ticks = market_data_provider_->get_total_tick_count();
+
+        while (!stop_signal_.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+            // Picks up hot-reloaded intervals; the command line override wins
+            int interval_seconds = options_.stats_interval_seconds.value_or(
+                config_manager_->get_snapshot()->stats_interval_seconds);
+            auto now = std::chrono::steady_clock::now();
+            if (interval_seconds <= 0 || now - last_stats < std::chrono::seconds(interval_seconds)) {
+                continue;
             }
 
-            trades_panel_->update_data(trade_rows);
-
-        } catch (const std::exception& e) {
-            TRADING_LOG_ERROR("Error updating trade displays: {}", e.what());
+            double elapsed = std::chrono::duration<double>(now - last_stats).count();
+            size_t ticks = market_data_provider_->get_total_tick_count();
+            log_service_stats(static_cast<double>(ticks - last_ticks) / elapsed);
+            last_stats = now;
+            last_ticks = ticks;
         }
-    }
-
-    void update_position_displays() {
-        if (!positions_panel_) return;
 
-        try {
-            auto positions = trading_engine_->get_all_positions();
-            std::vector<ui::PositionRow> position_rows;
+        LOG_INFO("Stop signal received");
+    }
 
-            for (const auto& position : positions) {
-                ui::PositionRow row;
-                row.symbol = position->get_instrument_symbol();
-                row.quantity = position->get_quantity();
-                row.average_price = position->get_average_price();
-                row.current_price = 0.0; // Would get from market data
-                row.market_value = position->get_market_value(row.current_price);
-                row.unrealized_pnl = position->get_unrealized_pnl();
-                row.realized_pnl = position->get_realized_pnl();
-                row.total_pnl = position->get_total_pnl(row.current_price);
-                row.change_percent = 0.0; // Would calculate from current vs average price
-                position_rows.push_back(row);
+    void log_service_stats(double ticks_per_second) {
+        TRADING_LOG_INFO("Stats: feed {} ({} symbols, {:.1f} ticks/s), orders {}, trades {}, positions {}, "
+                         "daily P&L {:.2f}, trading {}",
+                         market_data_provider_->is_connected() ? "connected" : "disconnected",
+                         market_data_provider_->get_subscription_count(), ticks_per_second,
+                         trading_engine_->get_order_count(), trading_engine_->get_trade_count(),
+                         trading_engine_->get_position_count(), risk_manager_->get_daily_pnl(),
+                         risk_manager_->is_trading_enabled() ? "enabled" : "halted");
+
+        if (async_persistence_) {
+            auto stats = async_persistence_->get_statistics();
+            TRADING_LOG_INFO("Stats: persistence {} written, {} failed, {} rejected, {} pending", stats.records_written,
+                             stats.records_failed, stats.records_rejected,
+                             async_persistence_->get_enqueued_sequence() - async_persistence_->get_durable_sequence());
+            if (stats.durability_stalled) {
+                TRADING_LOG_ERROR("Stats: persistence durability is stalled; dropped rows must be recovered from the journal");
             }
-
-            positions_panel_->update_data(position_rows);
-
-        } catch (const std::exception& e) {
-            TRADING_LOG_ERROR("Error updating position displays: {}", e.what());
         }
     }
+};
 
-    void setup_signal_handlers() {
-        // Set up signal handler for graceful shutdown
-        signal(SIGINT, [](int) {
-            std::cout << "\nShutdown signal received..." << std::endl;
-            // Note: This is a simplified signal handler
-            // In production, you'd want a more sophisticated approach
-            exit(0);
-        });
+std::atomic<bool> TradingApplication::stop_signal_{false};
 
-        signal(SIGTERM, [](int) {
-            std::cout << "\nTermination signal received..." << std::endl;
-            exit(0);
-        });
-    }
+void print_usage(const char* program) {
+    std::cout << "Usage: " << program << " [--config path] [--headless] [--stats-interval seconds]" << std::endl;
+    std::cout << "  --config path             Configuration file (default config/trading_system.json)" << std::endl;
+    std::cout << "  --headless                Run without the UI: engine, feed, risk and persistence only" << std::endl;
+    std::cout << "  --stats-interval seconds  Status line period in headless mode; 0 disables" << std::endl;
+}
 
-    std::string order_status_to_string(OrderStatus status) {
-        switch (status) {
-            case OrderStatus::NEW: return "NEW";
-            case OrderStatus::ACCEPTED: return "ACCEPTED";
-            case OrderStatus::PARTIALLY_FILLED: return "PARTIALLY_FILLED";
-            case OrderStatus::FILLED: return "FILLED";
-            case OrderStatus::CANCELED: return "CANCELED";
-            case OrderStatus::REJECTED: return "REJECTED";
-            default: return "UNKNOWN";
+// Returns false when the program should exit; exit_code is set accordingly
+bool parse_arguments(int argc, char* argv[], LaunchOptions& options, int& exit_code) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--headless") {
+            options.headless = true;
+        } else if (arg == "--config" && i + 1 < argc) {
+            options.config_path = argv[++i];
+        } else if (arg == "--stats-interval" && i + 1 < argc) {
+            char* end = nullptr;
+            long seconds = std::strtol(argv[++i], &end, 10);
+            if (*end != '\0' || seconds < 0) {
+                std::cerr << "Invalid --stats-interval: " << argv[i] << std::endl;
+                exit_code = 1;
+                return false;
+            }
+            options.stats_interval_seconds = static_cast<int>(seconds);
+        } else if (arg == "--help" || arg == "-h") {
+            print_usage(argv[0]);
+            exit_code = 0;
+            return false;
+        } else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            print_usage(argv[0]);
+            exit_code = 1;
+            return false;
         }
     }
-};
-
-// Global application instance for signal handling
-std::unique_ptr<TradingApplication> g_app;
+    return true;
+}
 
-void signal_handler(int signal) {
-    std::cout << "\nReceived signal " << signal << ", shutting down gracefully..." << std::endl;
-    if (g_app) {
-        g_app->shutdown();
+int main(int argc, char* argv[]) {
+    LaunchOptions options;
+    int exit_code = 0;
+    if (!parse_arguments(argc, argv, options, exit_code)) {
+        return exit_code;
     }
-    exit(0);
-}
 
-int main(int /*argc*/, char* /*argv*/[]) {
     std::cout << "=== C++ Trading System ===" << std::endl;
     std::cout << "Version: 1.0.0" << std::endl;
     std::cout << "Built: " << __DATE__ << " " << __TIME__ << std::endl;
@@ -514,23 +716,22 @@ int main(int /*argc*/, char* /*argv*/[]) {
 
     try {
         // Create application instance
-        g_app = std::make_unique<TradingApplication>();
+        auto app = std::make_unique<TradingApplication>(std::move(options));
 
-        // Set up signal handlers
-        signal(SIGINT, signal_handler);
-        signal(SIGTERM, signal_handler);
+        // Signals only request the stop; shutdown runs below on the main thread
+        TradingApplication::install_signal_handlers();
 
         // Initialize application
-        if (!g_app->initialize()) {
+        if (!app->initialize()) {
             std::cerr << "Failed to initialize trading system" << std::endl;
             return 1;
         }
 
         // Run application
-        g_app->run();
+        app->run();
 
         // Clean shutdown
-        g_app->shutdown();
+        app->shutdown();
 
     } catch (const std::exception& e) {
         std::cerr << "Fatal error: " << e.what() << std::endl;
@@ -542,4 +743,4 @@ int main(int /*argc*/, char* /*argv*/[]) {
 
     std::cout << "Trading system shutdown complete" << std::endl;
     return 0;
-}
\ No newline at end of file
+}
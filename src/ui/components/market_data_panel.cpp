@@ -1,5 +1,7 @@
 #include "market_data_panel.hpp"
 #include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <sstream>
 #include <iomanip>
 
@@ -22,7 +24,10 @@ void MarketDataPanel::render() {
         ImGui::SameLine();
 
         ImGui::SetNextItemWidth(80);
-        ImGui::SliderInt("Precision", &precision_, 0, 6, "%d");
+        if (ImGui::SliderInt("Precision", &precision_, 0, 6, "%d")) {
+            std::lock_guard<std::mutex> lock(data_mutex_);
+            format_rows();
+        }
 
         ImGui::Separator();
 
@@ -44,11 +49,13 @@ void MarketDataPanel::update_data(const std::vector<MarketDataRow>& data) {
     if (auto_sort_) {
         sort_data();
     }
+    format_rows();
 }
 
 void MarketDataPanel::clear_data() {
     std::lock_guard<std::mutex> lock(data_mutex_);
     market_data_.clear();
+    row_text_.clear();
 }
 
 void MarketDataPanel::set_symbol_click_callback(std::function<void(const std::string&)> callback) {
@@ -60,14 +67,18 @@ void MarketDataPanel::set_subscribe_callback(std::function<void(const std::strin
 }
 
 void MarketDataPanel::set_auto_sort(bool enabled) {
+    std::lock_guard<std::mutex> lock(data_mutex_);
     auto_sort_ = enabled;
     if (enabled) {
         sort_data();
+        format_rows();
     }
 }
 
 void MarketDataPanel::set_precision(int decimal_places) {
+    std::lock_guard<std::mutex> lock(data_mutex_);
     precision_ = std::max(0, std::min(6, decimal_places));
+    format_rows();
 }
 
 void MarketDataPanel::sort_data() {
@@ -100,6 +111,25 @@ void MarketDataPanel::sort_data() {
     });
 }
 
+void MarketDataPanel::format_rows() {
+    char buffer[32];
+    row_text_.resize(market_data_.size());
+    for (size_t i = 0; i < market_data_.size(); ++i) {
+        const auto& row = market_data_[i];
+        auto& text = row_text_[i];
+        std::snprintf(buffer, sizeof(buffer), "%.*f", precision_, row.last_price);
+        text.last = buffer;
+        std::snprintf(buffer, sizeof(buffer), "%.*f", precision_, row.bid_price);
+        text.bid = buffer;
+        std::snprintf(buffer, sizeof(buffer), "%.*f", precision_, row.ask_price);
+        text.ask = buffer;
+        std::snprintf(buffer, sizeof(buffer), "%.*f", precision_, row.spread);
+        text.spread = buffer;
+        std::snprintf(buffer, sizeof(buffer), "%+.2f%%", row.change_percent);
+        text.change = buffer;
+    }
+}
+
 void MarketDataPanel::render_table() {
     std::lock_guard<std::mutex> lock(data_mutex_);
 
@@ -121,6 +151,7 @@ void MarketDataPanel::render_table() {
         ImGui::TableSetupColumn("Ask", ImGuiTableColumnFlags_None, 80.0f, 3);
         ImGui::TableSetupColumn("Spread", ImGuiTableColumnFlags_None, 60.0f, 4);
         ImGui::TableSetupColumn("Change %", ImGuiTableColumnFlags_None, 80.0f, 5);
+        ImGui::TableSetupScrollFreeze(0, 1);
         ImGui::TableHeadersRow();
 
         // Handle sorting
@@ -130,47 +161,51 @@ void MarketDataPanel::render_table() {
                 sort_column_ = sort_specs->Specs[0].ColumnUserID;
                 sort_ascending_ = sort_specs->Specs[0].SortDirection == ImGuiSortDirection_Ascending;
                 sort_data();
+                format_rows();
             }
             sort_specs->SpecsDirty = false;
         }
 
-        // Table data rows
-        for (const auto& row : market_data_) {
-            ImGui::TableNextRow();
-
-            // Symbol column (clickable)
-            ImGui::TableSetColumnIndex(0);
-            if (ImGui::Selectable(row.symbol.c_str(), false, ImGuiSelectableFlags_SpanAllColumns)) {
-                if (symbol_click_callback_) {
-                    symbol_click_callback_(row.symbol);
+        // Only the rows in view are submitted; their text was formatted on update
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(market_data_.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                const auto& row = market_data_[static_cast<size_t>(i)];
+                const auto& text = row_text_[static_cast<size_t>(i)];
+                ImGui::TableNextRow();
+
+                // Symbol column (clickable)
+                ImGui::TableSetColumnIndex(0);
+                if (ImGui::Selectable(row.symbol.c_str(), false, ImGuiSelectableFlags_SpanAllColumns)) {
+                    if (symbol_click_callback_) {
+                        symbol_click_callback_(row.symbol);
+                    }
                 }
-            }
 
-            // Last Price
-            ImGui::TableSetColumnIndex(1);
-            ImGui::TextColored(ImVec4(1.0f, 1.0f, 1.0f, row.is_stale ? 0.5f : 1.0f),
-                             "%.*f", precision_, row.last_price);
-
-            // Bid Price
-            ImGui::TableSetColumnIndex(2);
-            ImGui::TextColored(ImVec4(0.5f, 0.8f, 1.0f, row.is_stale ? 0.5f : 1.0f),
-                             "%.*f", precision_, row.bid_price);
-
-            // Ask Price
-            ImGui::TableSetColumnIndex(3);
-            ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.5f, row.is_stale ? 0.5f : 1.0f),
-                             "%.*f", precision_, row.ask_price);
-
-            // Spread
-            ImGui::TableSetColumnIndex(4);
-            ImGui::Text("%.*f", precision_, row.spread);
-
-            // Change %
-            ImGui::TableSetColumnIndex(5);
-            ImU32 change_color = get_price_color(row.change_percent);
-            ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(change_color),
-                             "%+.2f%%", row.change_percent);
+                // Last Price
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextColored(ImVec4(1.0f, 1.0f, 1.0f, row.is_stale ? 0.5f : 1.0f), "%s", text.last.c_str());
+
+                // Bid Price
+                ImGui::TableSetColumnIndex(2);
+                ImGui::TextColored(ImVec4(0.5f, 0.8f, 1.0f, row.is_stale ? 0.5f : 1.0f), "%s", text.bid.c_str());
+
+                // Ask Price
+                ImGui::TableSetColumnIndex(3);
+                ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.5f, row.is_stale ? 0.5f : 1.0f), "%s", text.ask.c_str());
+
+                // Spread
+                ImGui::TableSetColumnIndex(4);
+                ImGui::TextUnformatted(text.spread.c_str());
+
+                // Change %
+                ImGui::TableSetColumnIndex(5);
+                ImU32 change_color = get_price_color(row.change_percent);
+                ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(change_color), "%s", text.change.c_str());
+            }
         }
+        clipper.End();
 
         ImGui::EndTable();
     }
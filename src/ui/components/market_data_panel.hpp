@@ -15,6 +15,17 @@ namespace trading::ui {
 class MarketDataPanel : public IMarketDataPanel {
 private:
     std::vector<MarketDataRow> market_data_;
+
+    // Display strings at the current precision, formatted when rows, their order
+    // or the precision change (parallel to market_data_)
+    struct RowText {
+        std::string last;
+        std::string bid;
+        std::string ask;
+        std::string spread;
+        std::string change;
+    };
+    std::vector<RowText> row_text_;
     std::function<void(const std::string&)> symbol_click_callback_;
     std::function<void(const std::string&)> subscribe_callback_;
     bool auto_sort_ = true;
@@ -30,6 +41,7 @@ private:
     int sort_column_ = 0; // 0=symbol, 1=last_price, 2=bid, 3=ask, 4=spread, 5=change%
 
     void sort_data();
+    void format_rows();
     void render_table();
     void render_add_symbol_popup();
     ImU32 get_price_color(double change_percent) const;
@@ -1,4 +1,5 @@
 #include "positions_panel.hpp"
+#include <cstdio>
 #include <iomanip>
 #include <sstream>
 #include <numeric>
@@ -28,11 +29,14 @@ void PositionsPanel::render() {
 void PositionsPanel::update_data(const std::vector<PositionRow>& positions) {
     std::lock_guard<std::mutex> lock(data_mutex_);
     positions_ = positions;
+    format_positions();
 }
 
 void PositionsPanel::clear_data() {
     std::lock_guard<std::mutex> lock(data_mutex_);
     positions_.clear();
+    position_text_.clear();
+    summary_ = Summary{};
     selected_symbol_.clear();
 }
 
@@ -89,76 +93,78 @@ void PositionsPanel::render_table() {
             ImGui::TableSetupColumn("Change %", ImGuiTableColumnFlags_None, 80.0f);
         }
 
+        ImGui::TableSetupScrollFreeze(0, 1);
         ImGui::TableHeadersRow();
 
-        // Table data rows
-        for (const auto& position : positions_) {
-            ImGui::TableNextRow();
-
-            // Symbol column (clickable)
-            ImGui::TableSetColumnIndex(0);
-            bool is_selected = (position.symbol == selected_symbol_);
-            if (ImGui::Selectable(position.symbol.c_str(), is_selected, ImGuiSelectableFlags_SpanAllColumns)) {
-                selected_symbol_ = position.symbol;
-                if (position_click_callback_) {
-                    position_click_callback_(position.symbol);
+        // Only the rows in view are submitted; their text was formatted on update
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(positions_.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                const auto& position = positions_[static_cast<size_t>(i)];
+                const auto& text = position_text_[static_cast<size_t>(i)];
+                ImGui::TableNextRow();
+
+                // Symbol column (clickable)
+                ImGui::TableSetColumnIndex(0);
+                bool is_selected = (position.symbol == selected_symbol_);
+                if (ImGui::Selectable(position.symbol.c_str(), is_selected, ImGuiSelectableFlags_SpanAllColumns)) {
+                    selected_symbol_ = position.symbol;
+                    if (position_click_callback_) {
+                        position_click_callback_(position.symbol);
+                    }
                 }
-            }
 
-            // Quantity with LONG/SHORT indicator
-            ImGui::TableSetColumnIndex(1);
-            ImU32 qty_color = (position.quantity > 0) ? IM_COL32(0, 255, 0, 255) : IM_COL32(255, 0, 0, 255);
-            ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(qty_color),
-                             "%.0f %s", std::abs(position.quantity),
-                             position.quantity > 0 ? "L" : "S");
-
-            // Average Price
-            ImGui::TableSetColumnIndex(2);
-            ImGui::Text("%.2f", position.average_price);
-
-            // Current Price
-            ImGui::TableSetColumnIndex(3);
-            ImGui::Text("%.2f", position.current_price);
-
-            // Market Value
-            ImGui::TableSetColumnIndex(4);
-            ImGui::Text("%s", format_currency(position.market_value).c_str());
-
-            int col_index = 5;
-
-            if (show_pnl_) {
-                // Unrealized P&L
-                ImGui::TableSetColumnIndex(col_index++);
-                ImU32 unrealized_color = get_pnl_color(position.unrealized_pnl);
-                ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(unrealized_color),
-                                 "%s", format_currency(position.unrealized_pnl).c_str());
-
-                // Total P&L
-                ImGui::TableSetColumnIndex(col_index++);
-                ImU32 total_color = get_pnl_color(position.total_pnl);
-                ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(total_color),
-                                 "%s", format_currency(position.total_pnl).c_str());
-            }
+                // Quantity with LONG/SHORT indicator
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(text.quantity_color), "%s", text.quantity.c_str());
 
-            if (show_unrealized_) {
-                // Change %
-                ImGui::TableSetColumnIndex(col_index++);
-                ImU32 change_color = get_pnl_color(position.change_percent);
-                ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(change_color),
-                                 "%s", format_percentage(position.change_percent).c_str());
-            }
+                // Average Price
+                ImGui::TableSetColumnIndex(2);
+                ImGui::TextUnformatted(text.average_price.c_str());
+
+                // Current Price
+                ImGui::TableSetColumnIndex(3);
+                ImGui::TextUnformatted(text.current_price.c_str());
+
+                // Market Value
+                ImGui::TableSetColumnIndex(4);
+                ImGui::TextUnformatted(text.market_value.c_str());
+
+                int col_index = 5;
 
-            // Context menu for position actions
-            if (ImGui::BeginPopupContextItem()) {
-                if (ImGui::MenuItem("Close Position")) {
-                    if (close_position_callback_) {
-                        close_position_callback_(position.symbol);
+                if (show_pnl_) {
+                    // Unrealized P&L
+                    ImGui::TableSetColumnIndex(col_index++);
+                    ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(get_pnl_color(position.unrealized_pnl)),
+                                     "%s", text.unrealized_pnl.c_str());
+
+                    // Total P&L
+                    ImGui::TableSetColumnIndex(col_index++);
+                    ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(get_pnl_color(position.total_pnl)),
+                                     "%s", text.total_pnl.c_str());
+                }
+
+                if (show_unrealized_) {
+                    // Change %
+                    ImGui::TableSetColumnIndex(col_index++);
+                    ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(get_pnl_color(position.change_percent)),
+                                     "%s", text.change_percent.c_str());
+                }
+
+                // Context menu for position actions
+                if (ImGui::BeginPopupContextItem()) {
+                    if (ImGui::MenuItem("Close Position")) {
+                        if (close_position_callback_) {
+                            close_position_callback_(position.symbol);
+                        }
                     }
+                    ImGui::MenuItem("View Details", nullptr, false, false); // Disabled for now
+                    ImGui::EndPopup();
                 }
-                ImGui::MenuItem("View Details", nullptr, false, false); // Disabled for now
-                ImGui::EndPopup();
             }
         }
+        clipper.End();
 
         ImGui::EndTable();
     }
@@ -172,44 +178,66 @@ void PositionsPanel::render_summary() {
         return;
     }
 
-    // Calculate portfolio totals
-    double total_market_value = 0.0;
-    double total_unrealized_pnl = 0.0;
-    double total_realized_pnl = 0.0;
-    double total_pnl = 0.0;
-
-    for (const auto& position : positions_) {
-        total_market_value += position.market_value;
-        total_unrealized_pnl += position.unrealized_pnl;
-        total_realized_pnl += position.realized_pnl;
-        total_pnl += position.total_pnl;
-    }
-
     // Display summary
     ImGui::Text("Portfolio Summary:");
     ImGui::SameLine();
     ImGui::Text("Positions: %zu", positions_.size());
 
-    ImGui::Text("Market Value: %s", format_currency(total_market_value).c_str());
+    ImGui::Text("Market Value: %s", summary_.market_value.c_str());
     ImGui::SameLine(200);
 
     if (show_pnl_) {
-        ImU32 unrealized_color = get_pnl_color(total_unrealized_pnl);
+        ImU32 unrealized_color = get_pnl_color(summary_.unrealized_pnl);
         ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(unrealized_color),
-                         "Unrealized: %s", format_currency(total_unrealized_pnl).c_str());
+                         "Unrealized: %s", summary_.unrealized_text.c_str());
         ImGui::SameLine(250);
 
-        ImU32 realized_color = get_pnl_color(total_realized_pnl);
+        ImU32 realized_color = get_pnl_color(summary_.realized_pnl);
         ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(realized_color),
-                         "Realized: %s", format_currency(total_realized_pnl).c_str());
+                         "Realized: %s", summary_.realized_text.c_str());
         ImGui::SameLine(400);
 
-        ImU32 total_color = get_pnl_color(total_pnl);
+        ImU32 total_color = get_pnl_color(summary_.total_pnl);
         ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(total_color),
-                         "Total P&L: %s", format_currency(total_pnl).c_str());
+                         "Total P&L: %s", summary_.total_text.c_str());
     }
 }
 
+void PositionsPanel::format_positions() {
+    char buffer[32];
+    double total_market_value = 0.0;
+    summary_ = Summary{};
+    position_text_.clear();
+    position_text_.reserve(positions_.size());
+
+    for (const auto& position : positions_) {
+        PositionText text;
+        std::snprintf(buffer, sizeof(buffer), "%.0f %s", std::abs(position.quantity),
+                      position.quantity > 0 ? "L" : "S");
+        text.quantity = buffer;
+        text.quantity_color = (position.quantity > 0) ? IM_COL32(0, 255, 0, 255) : IM_COL32(255, 0, 0, 255);
+        std::snprintf(buffer, sizeof(buffer), "%.2f", position.average_price);
+        text.average_price = buffer;
+        std::snprintf(buffer, sizeof(buffer), "%.2f", position.current_price);
+        text.current_price = buffer;
+        text.market_value = format_currency(position.market_value);
+        text.unrealized_pnl = format_currency(position.unrealized_pnl);
+        text.total_pnl = format_currency(position.total_pnl);
+        text.change_percent = format_percentage(position.change_percent);
+        position_text_.push_back(std::move(text));
+
+        total_market_value += position.market_value;
+        summary_.unrealized_pnl += position.unrealized_pnl;
+        summary_.realized_pnl += position.realized_pnl;
+        summary_.total_pnl += position.total_pnl;
+    }
+
+    summary_.market_value = format_currency(total_market_value);
+    summary_.unrealized_text = format_currency(summary_.unrealized_pnl);
+    summary_.realized_text = format_currency(summary_.realized_pnl);
+    summary_.total_text = format_currency(summary_.total_pnl);
+}
+
 ImU32 PositionsPanel::get_pnl_color(double pnl) const {
     if (pnl > 0.0) {
         return IM_COL32(0, 255, 0, 255); // Green for profit
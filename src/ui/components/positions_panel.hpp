@@ -14,6 +14,31 @@ namespace trading::ui {
 class PositionsPanel : public IPositionsPanel {
 private:
     std::vector<PositionRow> positions_;
+
+    // Display strings and colours, formatted when positions change (parallel to positions_)
+    struct PositionText {
+        std::string quantity;
+        std::string average_price;
+        std::string current_price;
+        std::string market_value;
+        std::string unrealized_pnl;
+        std::string total_pnl;
+        std::string change_percent;
+        ImU32 quantity_color;
+    };
+    std::vector<PositionText> position_text_;
+
+    // Portfolio totals, recomputed when positions change
+    struct Summary {
+        double unrealized_pnl = 0.0;
+        double realized_pnl = 0.0;
+        double total_pnl = 0.0;
+        std::string market_value;
+        std::string unrealized_text;
+        std::string realized_text;
+        std::string total_text;
+    };
+    Summary summary_;
     std::function<void(const std::string&)> position_click_callback_;
     std::function<void(const std::string&)> close_position_callback_;
     mutable std::mutex data_mutex_;
@@ -28,6 +53,7 @@ private:
     // Helper methods
     void render_table();
     void render_summary();
+    void format_positions();
     ImU32 get_pnl_color(double pnl) const;
     std::string format_currency(double value) const;
     std::string format_percentage(double percentage) const;
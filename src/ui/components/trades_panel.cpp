@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <iomanip>
 #include <sstream>
+#include <cstdio>
 #include <cstring>
 
 namespace trading::ui {
@@ -27,14 +28,49 @@ void TradesPanel::render() {
 void TradesPanel::update_data(const std::vector<TradeRow>& trades) {
     std::lock_guard<std::mutex> lock(data_mutex_);
     trades_ = trades;
+    trade_text_.clear();
+    trade_text_.reserve(trades_.size());
+    for (const auto& trade : trades_) {
+        trade_text_.push_back(format_trade(trade));
+    }
     apply_filters();
-    sort_trades();
+}
+
+void TradesPanel::append_data(const std::vector<TradeRow>& trades) {
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    auto today_start = std::chrono::time_point_cast<std::chrono::days>(std::chrono::system_clock::now());
+    trades_.reserve(trades_.size() + trades.size());
+    trade_text_.reserve(trades_.size() + trades.size());
+    for (const auto& trade : trades) {
+        trades_.push_back(trade);
+        trade_text_.push_back(format_trade(trade));
+        if (passes_filters(trade, today_start)) {
+            add_filtered(trades_.size() - 1);
+        }
+    }
 }
 
 void TradesPanel::clear_data() {
     std::lock_guard<std::mutex> lock(data_mutex_);
     trades_.clear();
-    filtered_trades_.clear();
+    trade_text_.clear();
+    filtered_indices_.clear();
+    summary_ = Summary{};
+}
+
+size_t TradesPanel::get_trade_count() const {
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    return trades_.size();
+}
+
+size_t TradesPanel::get_filtered_count() const {
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    return filtered_indices_.size();
+}
+
+TradeRow TradesPanel::get_displayed_trade(size_t position) const {
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    return displayed_trade(position);
 }
 
 void TradesPanel::set_show_today_only(bool show_today) {
@@ -52,7 +88,9 @@ void TradesPanel::set_max_displayed_trades(int max_trades) {
 
 void TradesPanel::render_controls() {
     // Filter controls
-    ImGui::Checkbox("Today Only", &show_today_only_);
+    if (ImGui::Checkbox("Today Only", &show_today_only_)) {
+        apply_filters();
+    }
     if (ImGui::IsItemHovered()) {
         ImGui::SetTooltip("Show only trades from today");
     }
@@ -95,13 +133,13 @@ void TradesPanel::render_controls() {
 void TradesPanel::render_table() {
     std::lock_guard<std::mutex> lock(data_mutex_);
 
-    if (filtered_trades_.empty()) {
+    if (filtered_indices_.empty()) {
         ImGui::Text("No trades to display");
         return;
     }
 
     // Limit display count
-    size_t display_count = std::min(static_cast<size_t>(max_displayed_trades_), filtered_trades_.size());
+    size_t display_count = std::min(static_cast<size_t>(max_displayed_trades_), filtered_indices_.size());
 
     // Table setup
     const ImGuiTableFlags table_flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
@@ -116,52 +154,57 @@ void TradesPanel::render_table() {
         ImGui::TableSetupColumn("Price", ImGuiTableColumnFlags_None, 80.0f);
         ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_None, 100.0f);
         ImGui::TableSetupColumn("Order ID", ImGuiTableColumnFlags_None, 100.0f);
+        ImGui::TableSetupScrollFreeze(0, 1);
         ImGui::TableHeadersRow();
 
-        // Table data rows
-        for (size_t i = 0; i < display_count; ++i) {
-            const auto& trade = filtered_trades_[i];
-            ImGui::TableNextRow();
-
-            // Time
-            ImGui::TableSetColumnIndex(0);
-            ImGui::Text("%s", format_time(trade.execution_time).c_str());
-
-            // Symbol
-            ImGui::TableSetColumnIndex(1);
-            ImGui::Text("%s", trade.symbol.c_str());
-
-            // Side
-            ImGui::TableSetColumnIndex(2);
-            ImU32 side_color = get_side_color(trade.side);
-            ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(side_color), "%s", trade.side.c_str());
-
-            // Quantity
-            ImGui::TableSetColumnIndex(3);
-            ImGui::Text("%.0f", trade.quantity);
-
-            // Price
-            ImGui::TableSetColumnIndex(4);
-            ImGui::Text("%.2f", trade.price);
-
-            // Value
-            ImGui::TableSetColumnIndex(5);
-            ImGui::Text("%s", format_currency(trade.notional_value).c_str());
-
-            // Order ID (truncated)
-            ImGui::TableSetColumnIndex(6);
-            std::string short_order_id = trade.order_id.length() > 8 ?
-                                       trade.order_id.substr(0, 8) + "..." :
-                                       trade.order_id;
-            ImGui::Text("%s", short_order_id.c_str());
-
-            // Tooltip with full order ID
-            if (ImGui::IsItemHovered()) {
-                ImGui::SetTooltip("Full Order ID: %s\nTrade ID: %s",
-                                trade.order_id.c_str(),
-                                trade.trade_id.c_str());
+        // Only the rows in view are submitted; their text was formatted on arrival
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(display_count));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                size_t index = displayed_index(static_cast<size_t>(i));
+                const auto& trade = trades_[index];
+                const auto& text = trade_text_[index];
+                ImGui::TableNextRow();
+
+                // Time
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted(text.time.c_str());
+
+                // Symbol
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextUnformatted(trade.symbol.c_str());
+
+                // Side
+                ImGui::TableSetColumnIndex(2);
+                ImU32 side_color = get_side_color(trade.side);
+                ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(side_color), "%s", trade.side.c_str());
+
+                // Quantity
+                ImGui::TableSetColumnIndex(3);
+                ImGui::TextUnformatted(text.quantity.c_str());
+
+                // Price
+                ImGui::TableSetColumnIndex(4);
+                ImGui::TextUnformatted(text.price.c_str());
+
+                // Value
+                ImGui::TableSetColumnIndex(5);
+                ImGui::TextUnformatted(text.value.c_str());
+
+                // Order ID (truncated)
+                ImGui::TableSetColumnIndex(6);
+                ImGui::TextUnformatted(text.short_order_id.c_str());
+
+                // Tooltip with full order ID
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Full Order ID: %s\nTrade ID: %s",
+                                    trade.order_id.c_str(),
+                                    trade.trade_id.c_str());
+                }
             }
         }
+        clipper.End();
 
         // Auto-scroll to bottom if enabled
         if (auto_scroll_ && ImGui::GetScrollY() >= ImGui::GetScrollMaxY()) {
@@ -172,87 +215,105 @@ void TradesPanel::render_table() {
     }
 
     // Display count info
-    if (filtered_trades_.size() > display_count) {
-        ImGui::Text("Showing %zu of %zu trades", display_count, filtered_trades_.size());
+    if (filtered_indices_.size() > display_count) {
+        ImGui::Text("Showing %zu of %zu trades", display_count, filtered_indices_.size());
     } else {
-        ImGui::Text("Total: %zu trades", filtered_trades_.size());
+        ImGui::Text("Total: %zu trades", filtered_indices_.size());
     }
 }
 
 void TradesPanel::render_trade_summary() {
     std::lock_guard<std::mutex> lock(data_mutex_);
 
-    if (filtered_trades_.empty()) {
+    if (filtered_indices_.empty()) {
         ImGui::Text("Trade Summary: No trades");
         return;
     }
 
-    // Calculate summary statistics
-    double total_volume = 0.0;
-    double total_value = 0.0;
-    size_t buy_count = 0;
-    size_t sell_count = 0;
-
-    for (const auto& trade : filtered_trades_) {
-        total_volume += trade.quantity;
-        total_value += trade.notional_value;
-        if (trade.side == "BUY") {
-            buy_count++;
-        } else {
-            sell_count++;
-        }
-    }
-
-    double avg_trade_size = filtered_trades_.empty() ? 0.0 : total_volume / filtered_trades_.size();
+    // Totals are kept up to date as trades are filtered in
+    double avg_trade_size = summary_.total_volume / filtered_indices_.size();
 
     // Display summary
     ImGui::Text("Summary:");
     ImGui::SameLine();
-    ImGui::Text("Trades: %zu (%zu BUY, %zu SELL)", filtered_trades_.size(), buy_count, sell_count);
+    ImGui::Text("Trades: %zu (%zu BUY, %zu SELL)", filtered_indices_.size(), summary_.buy_count, summary_.sell_count);
 
-    ImGui::Text("Volume: %.0f shares", total_volume);
+    ImGui::Text("Volume: %.0f shares", summary_.total_volume);
     ImGui::SameLine(200);
-    ImGui::Text("Value: %s", format_currency(total_value).c_str());
+    ImGui::Text("Value: %s", format_currency(summary_.total_value).c_str());
     ImGui::SameLine(350);
     ImGui::Text("Avg Size: %.0f", avg_trade_size);
 }
 
 void TradesPanel::apply_filters() {
-    filtered_trades_.clear();
+    filtered_indices_.clear();
+    summary_ = Summary{};
 
     auto now = std::chrono::system_clock::now();
     auto today_start = std::chrono::time_point_cast<std::chrono::days>(now);
 
-    for (const auto& trade : trades_) {
-        // Today filter
-        if (show_today_only_) {
-            if (trade.execution_time < today_start) {
-                continue;
-            }
+    for (size_t i = 0; i < trades_.size(); ++i) {
+        if (passes_filters(trades_[i], today_start)) {
+            add_filtered(i);
         }
+    }
+}
 
-        // Symbol filter
-        if (!symbol_filter_.empty()) {
-            if (trade.symbol.find(symbol_filter_) == std::string::npos) {
-                continue;
-            }
-        }
+bool TradesPanel::passes_filters(const TradeRow& trade, std::chrono::system_clock::time_point today_start) const {
+    // Today filter
+    if (show_today_only_ && trade.execution_time < today_start) {
+        return false;
+    }
 
-        filtered_trades_.push_back(trade);
+    // Symbol filter
+    if (!symbol_filter_.empty() && trade.symbol.find(symbol_filter_) == std::string::npos) {
+        return false;
     }
 
-    sort_trades();
+    return true;
+}
+
+void TradesPanel::add_filtered(size_t index) {
+    // Fills arrive in time order, so this is almost always an append
+    const auto& trade = trades_[index];
+    auto position = filtered_indices_.end();
+    if (!filtered_indices_.empty() && trades_[filtered_indices_.back()].execution_time > trade.execution_time) {
+        position = std::upper_bound(filtered_indices_.begin(), filtered_indices_.end(), index,
+                                    [this](size_t a, size_t b) {
+                                        return trades_[a].execution_time < trades_[b].execution_time;
+                                    });
+    }
+    filtered_indices_.insert(position, index);
+
+    summary_.total_volume += trade.quantity;
+    summary_.total_value += trade.notional_value;
+    if (trade.side == "BUY") {
+        summary_.buy_count++;
+    } else {
+        summary_.sell_count++;
+    }
+}
+
+size_t TradesPanel::displayed_index(size_t position) const {
+    size_t slot = sort_by_time_desc_ ? filtered_indices_.size() - 1 - position : position;
+    return filtered_indices_[slot];
+}
+
+const TradeRow& TradesPanel::displayed_trade(size_t position) const {
+    return trades_[displayed_index(position)];
 }
 
-void TradesPanel::sort_trades() {
-    std::sort(filtered_trades_.begin(), filtered_trades_.end(),
-              [this](const TradeRow& a, const TradeRow& b) {
-                  if (sort_by_time_desc_) {
-                      return a.execution_time > b.execution_time; // Newest first
-                  } else {
-                      return a.execution_time < b.execution_time; // Oldest first
-                  }
-              });
+TradesPanel::TradeText TradesPanel::format_trade(const TradeRow& trade) const {
+    char buffer[32];
+    TradeText text;
+    text.time = format_time(trade.execution_time);
+    std::snprintf(buffer, sizeof(buffer), "%.0f", trade.quantity);
+    text.quantity = buffer;
+    std::snprintf(buffer, sizeof(buffer), "%.2f", trade.price);
+    text.price = buffer;
+    text.value = format_currency(trade.notional_value);
+    text.short_order_id = trade.order_id.length() > 8 ? trade.order_id.substr(0, 8) + "..." : trade.order_id;
+    return text;
 }
 
 std::string TradesPanel::format_time(const std::chrono::system_clock::time_point& time) const {
@@ -16,6 +16,16 @@ private:
     std::vector<TradeRow> trades_;
     mutable std::mutex data_mutex_;
 
+    // Display strings, formatted once when a trade arrives (parallel to trades_)
+    struct TradeText {
+        std::string time;
+        std::string quantity;
+        std::string price;
+        std::string value;
+        std::string short_order_id;
+    };
+    std::vector<TradeText> trade_text_;
+
     // Display options
     bool show_today_only_ = false;
     bool auto_scroll_ = true;
@@ -33,13 +43,27 @@ private:
     void render_table();
     void render_trade_summary();
     void apply_filters();
-    void sort_trades();
+    bool passes_filters(const TradeRow& trade, std::chrono::system_clock::time_point today_start) const;
+    void add_filtered(size_t index);
+    size_t displayed_index(size_t position) const;
+    const TradeRow& displayed_trade(size_t position) const;
+    TradeText format_trade(const TradeRow& trade) const;
     std::string format_time(const std::chrono::system_clock::time_point& time) const;
     std::string format_currency(double value) const;
     ImU32 get_side_color(const std::string& side) const;
 
-    // Filtered and sorted data
-    std::vector<TradeRow> filtered_trades_;
+    // Indices into trades_ that pass the filters, oldest first; read back to front
+    // when sorting newest first, so neither appends nor the sort toggle re-sort
+    std::vector<size_t> filtered_indices_;
+
+    // Running totals over the filtered trades
+    struct Summary {
+        double total_volume = 0.0;
+        double total_value = 0.0;
+        size_t buy_count = 0;
+        size_t sell_count = 0;
+    };
+    Summary summary_;
 
 public:
     TradesPanel() = default;
@@ -48,8 +72,14 @@ public:
     // Main interface
     void render();
     void update_data(const std::vector<TradeRow>& trades);
+    void append_data(const std::vector<TradeRow>& trades);   // New trades only; existing rows are untouched
     void clear_data();
 
+    // Queries
+    size_t get_trade_count() const;
+    size_t get_filtered_count() const;
+    TradeRow get_displayed_trade(size_t position) const;    // In display order, after filters
+
     // Configuration
     void set_show_today_only(bool show_today);
     void set_auto_scroll(bool auto_scroll);
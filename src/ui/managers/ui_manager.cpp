@@ -21,11 +21,22 @@ UIManager::~UIManager() {
 
 bool UIManager::initialize() {
     try {
-        // Initialize OpenGL context
-        gl_context_ = std::make_unique<OpenGLContext>(config_.window_config, config_.imgui_config);
-        if (!gl_context_->initialize()) {
-            TRADING_LOG_ERROR("Failed to initialize OpenGL context");
-            return false;
+        if (config_.headless) {
+            HeadlessContext::Config headless_config;
+            headless_config.width = config_.window_config.width;
+            headless_config.height = config_.window_config.height;
+            headless_context_ = std::make_unique<HeadlessContext>(headless_config);
+            if (!headless_context_->initialize()) {
+                TRADING_LOG_ERROR("Failed to initialize headless ImGui context");
+                return false;
+            }
+        } else {
+            // Initialize OpenGL context
+            gl_context_ = std::make_unique<OpenGLContext>(config_.window_config, config_.imgui_config);
+            if (!gl_context_->initialize()) {
+                TRADING_LOG_ERROR("Failed to initialize OpenGL context");
+                return false;
+            }
         }
 
         // Initialize UI panels
@@ -37,6 +48,7 @@ bool UIManager::initialize() {
 
         // Setup panel callbacks
         setup_callbacks();
+        apply_display_options();
 
         is_initialized_ = true;
         TRADING_LOG_INFO("UI Manager initialized successfully");
@@ -60,18 +72,40 @@ void UIManager::run() {
     while (is_running_ && !should_close_) {
         // Poll events
         gl_context_->poll_events();
+        render_frame();
+    }
+
+    TRADING_LOG_INFO("UI main loop ended");
+}
+
+void UIManager::render_frame() {
+    if (!is_initialized_) {
+        return;
+    }
+
+    run_ui_tasks();
+    apply_data_model();
 
-        // Start ImGui frame
+    // Start ImGui frame
+    if (gl_context_) {
         gl_context_->begin_frame();
+    } else {
+        headless_context_->begin_frame();
+    }
 
-        // Render UI panels
-        render_panels();
+    // Render UI panels
+    render_panels();
 
-        // End frame and swap buffers
+    // End frame and swap buffers
+    if (gl_context_) {
         gl_context_->end_frame();
+    } else {
+        headless_context_->end_frame();
     }
+}
 
-    TRADING_LOG_INFO("UI main loop ended");
+HeadlessContext::FrameStats UIManager::get_headless_frame_stats() const {
+    return headless_context_ ? headless_context_->get_frame_stats() : HeadlessContext::FrameStats{};
 }
 
 void UIManager::shutdown() {
@@ -93,6 +127,10 @@ void UIManager::shutdown() {
         gl_context_->shutdown();
         gl_context_.reset();
     }
+    if (headless_context_) {
+        headless_context_->shutdown();
+        headless_context_.reset();
+    }
 
     is_initialized_ = false;
 }
@@ -129,6 +167,10 @@ void UIManager::update_market_data(const std::vector<MarketDataRow>& data) {
 void UIManager::update_orders(const std::vector<OrderRow>& orders) {
     std::lock_guard<std::mutex> lock(data_mutex_);
     orders_cache_ = orders;
+    orders_index_.clear();
+    for (size_t i = 0; i < orders_cache_.size(); ++i) {
+        orders_index_[orders_cache_[i].order_id] = i;
+    }
     // Orders are typically displayed in multiple panels, so no direct update here
 }
 
@@ -142,9 +184,8 @@ void UIManager::update_positions(const std::vector<PositionRow>& positions) {
 }
 
 void UIManager::update_trades(const std::vector<TradeRow>& trades) {
+    // The trades panel owns the blotter; no second copy is kept here
     std::lock_guard<std::mutex> lock(data_mutex_);
-    trades_cache_ = trades;
-
     if (trades_panel_) {
         trades_panel_->update_data(trades);
     }
@@ -248,6 +289,12 @@ void UIManager::setup_callbacks() {
 
     // Market Data Panel callbacks
     if (market_data_panel_) {
+        market_data_panel_->set_symbol_click_callback([this](const std::string& symbol) {
+            if (order_entry_panel_) {
+                order_entry_panel_->set_instrument(symbol);
+            }
+        });
+
         market_data_panel_->set_subscribe_callback([this](const std::string& symbol) {
             if (symbol_subscribe_callback_) {
                 symbol_subscribe_callback_(symbol);
@@ -257,6 +304,12 @@ void UIManager::setup_callbacks() {
 
     // Positions Panel callbacks
     if (positions_panel_) {
+        positions_panel_->set_position_click_callback([this](const std::string& symbol) {
+            if (order_entry_panel_) {
+                order_entry_panel_->set_instrument(symbol);
+            }
+        });
+
         positions_panel_->set_close_position_callback([this](const std::string& symbol) {
             // Create a market sell order to close the position
             OrderFormData close_order;
@@ -299,12 +352,120 @@ void UIManager::save_layout(const std::string& layout_file) {
 
 void UIManager::set_config(const UIManagerConfig& config) {
     config_ = config;
+    apply_display_options();
 }
 
 const UIManager::UIManagerConfig& UIManager::get_config() const {
     return config_;
 }
 
+void UIManager::set_data_model(std::shared_ptr<UIDataModel> model) {
+    data_model_ = std::move(model);
+}
+
+void UIManager::post_to_ui_thread(std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(ui_tasks_mutex_);
+    ui_tasks_.push_back(std::move(task));
+}
+
+void UIManager::run_ui_tasks() {
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard<std::mutex> lock(ui_tasks_mutex_);
+        tasks.swap(ui_tasks_);
+    }
+    for (auto& task : tasks) {
+        task();
+    }
+}
+
+void UIManager::apply_data_model() {
+    if (!data_model_) {
+        return;
+    }
+
+    // Rows are built here, on the UI thread, and only for channels that changed
+    auto changes = data_model_->sync();
+    if (changes.quotes) {
+        std::vector<MarketDataRow> rows;
+        rows.reserve(data_model_->quotes().size());
+        for (const auto& quote : data_model_->quotes()) {
+            rows.push_back(UIDataModel::to_row(quote));
+        }
+        update_market_data(rows);
+    }
+    if (changes.orders) {
+        apply_order_updates(data_model_->order_updates());
+    }
+    if (changes.trades && trades_panel_) {
+        std::vector<TradeRow> rows;
+        rows.reserve(data_model_->new_trades().size());
+        for (const auto& trade : data_model_->new_trades()) {
+            rows.push_back(UIDataModel::to_row(trade));
+        }
+        trades_panel_->append_data(rows);
+    }
+    if (changes.positions || changes.quotes) {
+        std::unordered_map<std::string, double> last_prices;
+        for (const auto& quote : data_model_->quotes()) {
+            last_prices[quote.symbol] = quote.last_price;
+        }
+        std::vector<PositionRow> rows;
+        rows.reserve(data_model_->positions().size());
+        for (const auto& position : data_model_->positions()) {
+            auto it = last_prices.find(position.symbol);
+            rows.push_back(UIDataModel::to_row(position, it != last_prices.end() ? it->second : 0.0));
+        }
+        update_positions(rows);
+    }
+
+    if (status_panel_) {
+        status_panel_->set_market_data_connected(data_model_->is_connected());
+        if (changes.quotes) {
+            status_panel_->update_heartbeat();
+        }
+    }
+}
+
+void UIManager::apply_order_updates(std::span<const OrderUpdate> updates) {
+    std::lock_guard<std::mutex> lock(data_mutex_);
+    for (const auto& update : updates) {
+        auto it = orders_index_.find(update.order_id);
+        bool working = update.status != OrderStatus::FILLED && update.status != OrderStatus::CANCELED &&
+                       update.status != OrderStatus::REJECTED;
+        if (working) {
+            if (it != orders_index_.end()) {
+                orders_cache_[it->second] = UIDataModel::to_row(update);
+            } else {
+                orders_index_.emplace(update.order_id, orders_cache_.size());
+                orders_cache_.push_back(UIDataModel::to_row(update));
+            }
+        } else if (it != orders_index_.end()) {
+            // Swap the last row into the finished order's slot
+            size_t slot = it->second;
+            orders_index_.erase(it);
+            if (slot + 1 != orders_cache_.size()) {
+                orders_cache_[slot] = std::move(orders_cache_.back());
+                orders_index_[orders_cache_[slot].order_id] = slot;
+            }
+            orders_cache_.pop_back();
+        }
+    }
+}
+
+void UIManager::apply_display_options() {
+    if (market_data_panel_) {
+        market_data_panel_->set_precision(config_.price_precision);
+        market_data_panel_->set_auto_sort(config_.auto_sort);
+    }
+    if (positions_panel_) {
+        positions_panel_->set_show_unrealized(config_.show_unrealized_pnl);
+    }
+    if (trades_panel_) {
+        trades_panel_->set_max_displayed_trades(config_.max_displayed_trades);
+    }
+}
+
 bool UIManager::is_running() const {
     return is_running_;
 }
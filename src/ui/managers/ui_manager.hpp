@@ -2,11 +2,13 @@
 
 #include "contracts/ui_interface.hpp"
 #include "../rendering/opengl_context.hpp"
+#include "../rendering/headless_context.hpp"
 #include "../components/market_data_panel.hpp"
 #include "../components/order_entry_panel.hpp"
 #include "../components/positions_panel.hpp"
 #include "../components/trades_panel.hpp"
 #include "../components/status_panel.hpp"
+#include "../models/ui_data_model.hpp"
 
 #include <memory>
 #include <vector>
@@ -35,6 +37,10 @@ public:
         OpenGLContext::WindowConfig window_config;
         OpenGLContext::ImGuiConfig imgui_config;
 
+        // Render into an offscreen ImGui context (window_config size) with no window,
+        // GPU or event loop; frames are driven by render_frame()
+        bool headless = false;
+
         // Layout configuration
         bool enable_docking = true;
         bool show_demo_window = false;
@@ -44,6 +50,12 @@ public:
         int ui_refresh_rate_ms = 16;  // ~60 FPS
         int data_update_rate_ms = 100; // 10 Hz for data updates
 
+        // Panel display options
+        int price_precision = 2;
+        bool auto_sort = true;
+        bool show_unrealized_pnl = true;
+        int max_displayed_trades = 1000;
+
         // Panel visibility
         bool show_market_data_panel = true;
         bool show_order_entry_panel = true;
@@ -65,6 +77,13 @@ public:
     void run() override;
     void shutdown() override;
 
+    // Ask run() to return after the current frame (any thread)
+    void request_close() { should_close_ = true; }
+
+    // One frame: posted tasks, data model pickup, panels; run() calls it in a loop
+    void render_frame();
+    HeadlessContext::FrameStats get_headless_frame_stats() const;
+
     // Window management
     void show_market_data_window(bool show = true) override;
     void show_order_entry_window(bool show = true) override;
@@ -94,6 +113,12 @@ public:
     void set_config(const UIManagerConfig& config);
     const UIManagerConfig& get_config() const;
 
+    // Backend state picked up once per frame; set before run()
+    void set_data_model(std::shared_ptr<UIDataModel> model);
+
+    // Run a task on the UI thread before the next frame (thread-safe); for changes to panel state
+    void post_to_ui_thread(std::function<void()> task);
+
     // State queries
     bool is_running() const;
     bool is_initialized() const;
@@ -107,6 +132,7 @@ private:
 
     // Core components
     std::unique_ptr<OpenGLContext> gl_context_;
+    std::unique_ptr<HeadlessContext> headless_context_;
 
     // UI Panels
     std::unique_ptr<MarketDataPanel> market_data_panel_;
@@ -121,14 +147,19 @@ private:
     std::atomic<bool> should_close_;
 
     // Data synchronization
+    std::shared_ptr<UIDataModel> data_model_;
     mutable std::mutex data_mutex_;
     std::vector<MarketDataRow> market_data_cache_;
     std::vector<OrderRow> orders_cache_;
+    std::unordered_map<std::string, size_t> orders_index_;   // order_id -> orders_cache_ slot
     std::vector<PositionRow> positions_cache_;
-    std::vector<TradeRow> trades_cache_;
     bool connection_status_;
     std::string connection_status_text_;
 
+    // Tasks posted from other threads, run at the start of each frame
+    std::mutex ui_tasks_mutex_;
+    std::vector<std::function<void()>> ui_tasks_;
+
     // Callbacks
     std::function<void(const OrderFormData&)> order_submit_callback_;
     std::function<void(const std::string&)> order_cancel_callback_;
@@ -158,12 +189,15 @@ private:
     void setup_callbacks();
 
     // Main loop
-    void render_frame();
     void render_menu_bar();
     void render_toolbar();
     void render_dockspace();
     void render_panels();
     void render_debug_windows();
+    void run_ui_tasks();
+    void apply_data_model();
+    void apply_order_updates(std::span<const OrderUpdate> updates);
+    void apply_display_options();
 
     // Data updates
     void update_panel_data();
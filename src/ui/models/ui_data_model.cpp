@@ -0,0 +1,205 @@
+#include "ui_data_model.hpp"
+#include "core/models/market_tick.hpp"
+#include "core/models/order.hpp"
+#include "core/models/position.hpp"
+#include "core/models/trade.hpp"
+
+#include <algorithm>
+
+namespace trading::ui {
+
+void UIDataModel::publish_quote(const MarketTick& tick) {
+    QuoteUpdate quote;
+    quote.symbol = tick.instrument_symbol;
+    quote.bid_price = tick.bid_price;
+    quote.ask_price = tick.ask_price;
+    quote.last_price = tick.last_price;
+    quote.volume = tick.volume;
+    quote.timestamp = tick.timestamp;
+    upsert(quotes_, tick.instrument_symbol, std::move(quote));
+
+    last_quote_ns_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::system_clock::now().time_since_epoch()).count(),
+                         std::memory_order_relaxed);
+    quotes_published_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void UIDataModel::publish_order(const ExecutionReport& report) {
+    OrderUpdate order;
+    order.order_id = report.order_id;
+    order.symbol = report.symbol;
+    order.side = report.side;
+    order.type = report.type;
+    order.status = report.new_status;
+    order.quantity = report.quantity;
+    order.price = report.price;
+    order.filled_quantity = report.filled_quantity;
+    order.remaining_quantity = report.remaining_quantity;
+    order.created_time = report.created_time;
+    order.last_modified = report.timestamp;
+    append(orders_, std::move(order));
+}
+
+void UIDataModel::publish_trade(const Trade& trade) {
+    TradeUpdate update;
+    update.trade_id = trade.get_trade_id();
+    update.order_id = trade.get_order_id();
+    update.symbol = trade.get_instrument_symbol();
+    update.side = trade.get_side();
+    update.quantity = trade.get_quantity();
+    update.price = trade.get_price();
+    update.execution_time = trade.get_execution_time();
+
+    append(trades_, std::move(update));
+}
+
+void UIDataModel::publish_position(const Position& position) {
+    PositionUpdate update;
+    update.symbol = position.get_instrument_symbol();
+    update.quantity = position.get_quantity();
+    update.average_price = position.get_average_price();
+    update.realized_pnl = position.get_realized_pnl();
+    update.unrealized_pnl = position.get_unrealized_pnl();
+    upsert(positions_, update.symbol, std::move(update));
+}
+
+void UIDataModel::publish_connection(bool connected) {
+    connected_.store(connected, std::memory_order_relaxed);
+}
+
+UIDataModel::Changes UIDataModel::sync() {
+    Changes changes;
+    changes.quotes = quotes_.buffer.update_front();
+    changes.orders = take_deltas(orders_);
+    changes.trades = take_deltas(trades_);
+    changes.positions = positions_.buffer.update_front();
+    return changes;
+}
+
+std::chrono::system_clock::time_point UIDataModel::last_quote_time() const {
+    return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::nanoseconds(last_quote_ns_.load(std::memory_order_relaxed))));
+}
+
+MarketDataRow UIDataModel::to_row(const QuoteUpdate& quote) {
+    MarketDataRow row;
+    row.symbol = quote.symbol;
+    row.bid_price = quote.bid_price;
+    row.ask_price = quote.ask_price;
+    row.last_price = quote.last_price;
+    row.spread = quote.ask_price - quote.bid_price;
+    row.change_percent = 0.0; // Would be calculated from previous close
+    row.last_update = quote.timestamp;
+    row.is_stale = false;
+    return row;
+}
+
+OrderRow UIDataModel::to_row(const OrderUpdate& order) {
+    OrderRow row;
+    row.order_id = order.order_id;
+    row.symbol = order.symbol;
+    row.side = order_side_to_string(order.side);
+    row.type = order_type_to_string(order.type);
+    row.status = order_status_to_string(order.status);
+    row.quantity = order.quantity;
+    row.price = order.price;
+    row.filled_quantity = order.filled_quantity;
+    row.remaining_quantity = order.remaining_quantity;
+    row.created_time = order.created_time;
+    row.last_modified = order.last_modified;
+    return row;
+}
+
+TradeRow UIDataModel::to_row(const TradeUpdate& trade) {
+    TradeRow row;
+    row.trade_id = trade.trade_id;
+    row.order_id = trade.order_id;
+    row.symbol = trade.symbol;
+    row.side = order_side_to_string(trade.side);
+    row.quantity = trade.quantity;
+    row.price = trade.price;
+    row.notional_value = trade.quantity * trade.price;
+    row.execution_time = trade.execution_time;
+    return row;
+}
+
+PositionRow UIDataModel::to_row(const PositionUpdate& position, double current_price) {
+    PositionRow row;
+    row.symbol = position.symbol;
+    row.quantity = position.quantity;
+    row.average_price = position.average_price;
+    row.current_price = current_price;
+    row.market_value = position.quantity * current_price;
+    row.unrealized_pnl = current_price > 0.0 ? position.quantity * (current_price - position.average_price)
+                                             : position.unrealized_pnl;
+    row.realized_pnl = position.realized_pnl;
+    row.total_pnl = row.realized_pnl + row.unrealized_pnl;
+    row.change_percent = (current_price > 0.0 && position.average_price > 0.0)
+                             ? (current_price - position.average_price) / position.average_price * 100.0
+                             : 0.0;
+    return row;
+}
+
+template<typename T>
+void UIDataModel::upsert(KeyedChannel<T>& channel, const std::string& key, T&& value) {
+    std::lock_guard<std::mutex> lock(channel.producer_mutex);
+    auto it = channel.index.find(key);
+    if (it != channel.index.end()) {
+        channel.master[it->second] = std::move(value);
+    } else {
+        channel.index.emplace(key, channel.master.size());
+        channel.master.push_back(std::move(value));
+    }
+    channel.buffer.write([&channel](std::vector<T>& back) { back = channel.master; });
+}
+
+template<typename T>
+void UIDataModel::append(DeltaChannel<T>& channel, T&& delta) {
+    std::lock_guard<std::mutex> lock(channel.producer_mutex);
+    delta.sequence = ++channel.next_sequence;
+
+    // Whatever the UI thread has applied no longer needs to travel
+    const uint64_t acknowledged = channel.acknowledged.load(std::memory_order_acquire);
+    while (!channel.pending.empty() &&
+           (channel.pending.front().sequence <= acknowledged || channel.pending.size() >= MAX_PENDING_DELTAS)) {
+        channel.pending.pop_front();
+    }
+    channel.pending.push_back(std::move(delta));
+
+    // The back slot is a stale copy: drop what is no longer pending and append only what it is missing
+    channel.buffer.write([&channel](std::vector<T>& back) {
+        const uint64_t oldest = channel.pending.front().sequence;
+        auto stale_end = std::find_if(back.begin(), back.end(),
+                                      [oldest](const T& entry) { return entry.sequence >= oldest; });
+        back.erase(back.begin(), stale_end);
+
+        auto missing = channel.pending.begin();
+        if (!back.empty()) {
+            missing = std::upper_bound(channel.pending.begin(), channel.pending.end(), back.back().sequence,
+                                       [](uint64_t sequence, const T& entry) { return sequence < entry.sequence; });
+        }
+        back.insert(back.end(), missing, channel.pending.end());
+    });
+}
+
+template<typename T>
+bool UIDataModel::take_deltas(DeltaChannel<T>& channel) {
+    if (!channel.buffer.update_front()) {
+        channel.delta_begin = channel.buffer.front().size();
+        return false;
+    }
+
+    // A slot may still hold deltas applied from an earlier one; skip past them
+    const auto& front = channel.buffer.front();
+    auto first_new = std::upper_bound(front.begin(), front.end(), channel.applied,
+                                      [](uint64_t applied, const T& delta) { return applied < delta.sequence; });
+    channel.delta_begin = static_cast<size_t>(first_new - front.begin());
+    if (first_new == front.end()) {
+        return false;
+    }
+    channel.applied = front.back().sequence;
+    channel.acknowledged.store(channel.applied, std::memory_order_release);
+    return true;
+}
+
+} // namespace trading::ui
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "contracts/trading_engine_api.hpp"
+#include "contracts/ui_interface.hpp"
+#include "core/messaging/triple_buffer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace trading {
+class Trade;
+class Position;
+}
+
+namespace trading::ui {
+
+// Raw state as published by producer threads; formatting into rows happens on the UI thread
+
+struct QuoteUpdate {
+    std::string symbol;
+    double bid_price = 0.0;
+    double ask_price = 0.0;
+    double last_price = 0.0;
+    double volume = 0.0;
+    std::chrono::system_clock::time_point timestamp;
+};
+
+struct OrderUpdate {
+    uint64_t sequence = 0;      // Assigned on publish; increases across all order updates
+    std::string order_id;
+    std::string symbol;
+    OrderSide side = OrderSide::BUY;
+    OrderType type = OrderType::MARKET;
+    OrderStatus status = OrderStatus::NEW;
+    double quantity = 0.0;
+    double price = 0.0;
+    double filled_quantity = 0.0;
+    double remaining_quantity = 0.0;
+    std::chrono::system_clock::time_point created_time;
+    std::chrono::system_clock::time_point last_modified;
+};
+
+struct TradeUpdate {
+    uint64_t sequence = 0;      // Assigned on publish; increases across all trades
+    std::string trade_id;
+    std::string order_id;
+    std::string symbol;
+    OrderSide side = OrderSide::BUY;
+    double quantity = 0.0;
+    double price = 0.0;
+    std::chrono::system_clock::time_point execution_time;
+};
+
+struct PositionUpdate {
+    std::string symbol;
+    double quantity = 0.0;
+    double average_price = 0.0;
+    double realized_pnl = 0.0;
+    double unrealized_pnl = 0.0;
+};
+
+/**
+ * UI Data Model
+ * Hands backend state to the UI thread without either side waiting on the other.
+ * Producer threads (market data, engine callbacks) copy raw fields into per-channel
+ * triple buffers; the UI thread calls sync() once per frame to pick up the latest
+ * snapshot of each channel and only then formats rows for the panels. Producers
+ * never format strings or take a lock the render loop holds, and a burst of
+ * updates between two frames costs the UI one snapshot rather than one per update.
+ *
+ * Quotes and positions are small keyed sets published whole. Trades and order
+ * updates are deltas: each gets a sequence number, the UI thread sees only the
+ * ones past the last sequence it applied, and acknowledging them lets producers
+ * drop them, so per-frame work follows the update rate rather than the day's
+ * trade count. A UI thread that stops syncing loses the oldest deltas past
+ * MAX_PENDING_DELTAS instead of holding them without bound.
+ */
+class UIDataModel {
+public:
+    struct Changes {
+        bool quotes = false;
+        bool orders = false;
+        bool trades = false;
+        bool positions = false;
+
+        bool any() const { return quotes || orders || trades || positions; }
+    };
+
+    static constexpr size_t MAX_PENDING_DELTAS = 16384;
+
+    UIDataModel() = default;
+
+    // Non-copyable (producers and the UI thread hold references into the buffers)
+    UIDataModel(const UIDataModel&) = delete;
+    UIDataModel& operator=(const UIDataModel&) = delete;
+
+    // Producer side (any thread)
+    void publish_quote(const MarketTick& tick);
+    void publish_order(const ExecutionReport& report);
+    void publish_trade(const Trade& trade);
+    void publish_position(const Position& position);
+    void publish_connection(bool connected);
+
+    // Consumer side (UI thread only), valid until the next sync(): the latest quote and
+    // position sets, and the trades/order updates published since the previous sync()
+    Changes sync();
+    const std::vector<QuoteUpdate>& quotes() const { return quotes_.buffer.front(); }
+    const std::vector<PositionUpdate>& positions() const { return positions_.buffer.front(); }
+    std::span<const TradeUpdate> new_trades() const { return trades_.deltas(); }
+    std::span<const OrderUpdate> order_updates() const { return orders_.deltas(); }
+
+    // Lock-free status fields, readable from any thread
+    bool is_connected() const { return connected_.load(std::memory_order_relaxed); }
+    std::chrono::system_clock::time_point last_quote_time() const;
+    uint64_t quotes_published() const { return quotes_published_.load(std::memory_order_relaxed); }
+
+    // Row formatting for the panels (UI thread)
+    static MarketDataRow to_row(const QuoteUpdate& quote);
+    static OrderRow to_row(const OrderUpdate& order);
+    static TradeRow to_row(const TradeUpdate& trade);
+    static PositionRow to_row(const PositionUpdate& position, double current_price);
+
+private:
+    // Producers serialise on the channel's mutex, which makes the triple buffer's
+    // single producer; the UI thread only ever touches buffer.update_front()/front()
+    template<typename T>
+    struct KeyedChannel {
+        std::mutex producer_mutex;
+        std::vector<T> master;
+        std::unordered_map<std::string, size_t> index;
+        TripleBuffer<std::vector<T>> buffer;
+    };
+
+    template<typename T>
+    struct DeltaChannel {
+        std::mutex producer_mutex;
+        std::deque<T> pending;                      // Published, not yet acknowledged (oldest first)
+        uint64_t next_sequence = 0;
+        std::atomic<uint64_t> acknowledged{0};      // Highest sequence the UI thread applied
+        TripleBuffer<std::vector<T>> buffer;
+
+        // Consumer-owned
+        uint64_t applied = 0;
+        size_t delta_begin = 0;
+
+        std::span<const T> deltas() const {
+            const auto& front = buffer.front();
+            return std::span<const T>(front).subspan(delta_begin);
+        }
+    };
+
+    KeyedChannel<QuoteUpdate> quotes_;
+    KeyedChannel<PositionUpdate> positions_;
+    DeltaChannel<TradeUpdate> trades_;
+    DeltaChannel<OrderUpdate> orders_;
+
+    std::atomic<bool> connected_{false};
+    std::atomic<int64_t> last_quote_ns_{0};
+    std::atomic<uint64_t> quotes_published_{0};
+
+    template<typename T>
+    static void upsert(KeyedChannel<T>& channel, const std::string& key, T&& value);
+    template<typename T>
+    static void append(DeltaChannel<T>& channel, T&& delta);
+    template<typename T>
+    static bool take_deltas(DeltaChannel<T>& channel);
+};
+
+} // namespace trading::ui
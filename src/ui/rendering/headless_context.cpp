@@ -0,0 +1,77 @@
+#include "headless_context.hpp"
+#include "../../utils/logging.hpp"
+
+#include <string>
+
+namespace trading::ui {
+
+HeadlessContext::HeadlessContext()
+    : HeadlessContext(Config{}) {
+}
+
+HeadlessContext::HeadlessContext(const Config& config)
+    : config_(config),
+      context_(nullptr) {
+}
+
+HeadlessContext::~HeadlessContext() {
+    shutdown();
+}
+
+bool HeadlessContext::initialize() {
+    if (context_) {
+        return true;
+    }
+
+    IMGUI_CHECKVERSION();
+    context_ = ImGui::CreateContext();
+    ImGui::SetCurrentContext(context_);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;   // No layout file on disk
+    io.DisplaySize = ImVec2(static_cast<float>(config_.width), static_cast<float>(config_.height));
+    io.DeltaTime = config_.frame_time_seconds;
+
+    // Rasterise the font atlas on the CPU, which a renderer backend would otherwise do
+    unsigned char* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    Logger::info("HeadlessContext: ImGui context ready (" + std::to_string(config_.width) + "x" +
+                 std::to_string(config_.height) + ", no window)");
+    return true;
+}
+
+void HeadlessContext::shutdown() {
+    if (!context_) {
+        return;
+    }
+    ImGui::DestroyContext(context_);
+    context_ = nullptr;
+}
+
+void HeadlessContext::begin_frame() {
+    if (!context_) {
+        return;
+    }
+    ImGui::SetCurrentContext(context_);
+    ImGui::GetIO().DeltaTime = config_.frame_time_seconds;
+    ImGui::NewFrame();
+}
+
+void HeadlessContext::end_frame() {
+    if (!context_) {
+        return;
+    }
+    ImGui::Render();
+
+    const ImDrawData* draw_data = ImGui::GetDrawData();
+    frame_stats_ = FrameStats{};
+    if (draw_data) {
+        frame_stats_.draw_lists = draw_data->CmdListsCount;
+        frame_stats_.vertices = draw_data->TotalVtxCount;
+        frame_stats_.indices = draw_data->TotalIdxCount;
+    }
+}
+
+} // namespace trading::ui
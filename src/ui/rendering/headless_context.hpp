@@ -0,0 +1,52 @@
+#pragma once
+
+#include <imgui.h>
+
+namespace trading::ui {
+
+/**
+ * Headless ImGui Context
+ * Runs the ImGui frame lifecycle with no window, input or GPU backend: frames are
+ * built and tessellated into draw lists that nothing presents. Used to render the
+ * panels on machines without a display, e.g. to measure UI cost on CI.
+ */
+class HeadlessContext {
+public:
+    struct Config {
+        int width = 1920;
+        int height = 1080;
+        float frame_time_seconds = 1.0f / 60.0f;   // io.DeltaTime fed to every frame
+    };
+
+    // What the last frame produced for a renderer to draw
+    struct FrameStats {
+        int draw_lists = 0;
+        int vertices = 0;
+        int indices = 0;
+    };
+
+    HeadlessContext();
+    explicit HeadlessContext(const Config& config);
+    ~HeadlessContext();
+
+    // Non-copyable (owns an ImGui context)
+    HeadlessContext(const HeadlessContext&) = delete;
+    HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+    bool initialize();
+    void shutdown();
+    bool is_initialized() const { return context_ != nullptr; }
+
+    // Frame lifecycle
+    void begin_frame();
+    void end_frame();
+
+    FrameStats get_frame_stats() const { return frame_stats_; }
+
+private:
+    Config config_;
+    ImGuiContext* context_;
+    FrameStats frame_stats_;
+};
+
+} // namespace trading::ui
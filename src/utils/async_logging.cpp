@@ -0,0 +1,247 @@
+#include "async_logging.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace trading {
+
+// LogRecord implementation
+
+LogArg* LogRecord::next_arg() {
+    if (arg_count >= MAX_ARGS) {
+        return nullptr;
+    }
+    return &args[arg_count++];
+}
+
+void LogRecord::add_text(std::string_view value) {
+    LogArg* arg = next_arg();
+    if (!arg) {
+        return;
+    }
+    auto length = static_cast<uint16_t>(std::min(value.size(), TEXT_CAPACITY - text_used));
+    std::memcpy(text + text_used, value.data(), length);
+    arg->type = LogArg::Type::TEXT;
+    arg->text.offset = text_used;
+    arg->text.length = length;
+    text_used = static_cast<uint16_t>(text_used + length);
+}
+
+std::string LogRecord::to_string() const {
+    std::string message;
+    message.reserve(std::strlen(format) + text_used + 16 * arg_count);
+    auto out = std::back_inserter(message);
+
+    size_t next = 0;
+    for (const char* p = format; *p; ++p) {
+        if ((p[0] == '{' && p[1] == '{') || (p[0] == '}' && p[1] == '}')) {
+            message.push_back(*p++);
+            continue;
+        }
+        if (p[0] != '{' || p[1] != '}') {
+            message.push_back(*p);
+            continue;
+        }
+        ++p;
+        if (next >= arg_count) {
+            message += "{}";
+            continue;
+        }
+        const LogArg& arg = args[next++];
+        switch (arg.type) {
+            case LogArg::Type::INT: fmt::format_to(out, "{}", arg.i); break;
+            case LogArg::Type::UINT: fmt::format_to(out, "{}", arg.u); break;
+            case LogArg::Type::DOUBLE: fmt::format_to(out, "{}", arg.d); break;
+            case LogArg::Type::BOOL: message += arg.b ? "true" : "false"; break;
+            case LogArg::Type::CHAR: message.push_back(arg.c); break;
+            case LogArg::Type::TEXT: message.append(text + arg.text.offset, arg.text.length); break;
+        }
+    }
+
+    if (suppressed > 0) {
+        fmt::format_to(out, " [{} similar messages suppressed]", suppressed);
+    }
+    return message;
+}
+
+// LogRateLimiter implementation
+
+LogRateLimiter::LogRateLimiter(uint32_t max_per_second)
+    : max_per_second_(max_per_second)
+    , window_start_ns_(0)
+    , window_count_(0)
+    , suppressed_(0) {
+}
+
+bool LogRateLimiter::allow(uint32_t& suppressed) {
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t window_start = window_start_ns_.load(std::memory_order_relaxed);
+    if (now - window_start >= 1000000000LL &&
+        window_start_ns_.compare_exchange_strong(window_start, now, std::memory_order_relaxed)) {
+        window_count_.store(0, std::memory_order_relaxed);
+    }
+
+    if (window_count_.fetch_add(1, std::memory_order_relaxed) < max_per_second_) {
+        suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+    suppressed_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+// AsyncLogger implementation
+
+namespace {
+
+struct AsyncLoggerState {
+    std::unique_ptr<LockFreeQueue<LogRecord>> queue;
+    AsyncLogger::Config config;
+    std::thread writer_thread;
+    std::atomic<bool> running{false};
+    std::atomic<bool> stop_requested{false};
+    std::atomic<uint32_t> submitters{0};    // Producers between their running check and their push
+    std::mutex mutex;                        // Pairs with the condition variables; guards lifecycle
+    std::condition_variable writer_cv;
+    std::condition_variable drained_cv;
+    std::atomic<uint64_t> records_queued{0};
+    std::atomic<uint64_t> records_written{0};
+    std::atomic<uint64_t> records_dropped{0};
+    std::atomic<uint64_t> records_suppressed{0};
+};
+
+AsyncLoggerState& state() {
+    static AsyncLoggerState instance;
+    return instance;
+}
+
+void write_record(const LogRecord& record) {
+    Logger::log(record.level, record.time, record.to_string());
+}
+
+void writer_loop() {
+    auto& s = state();
+    LogRecord record;
+    for (;;) {
+        bool wrote = false;
+        while (s.queue->try_pop(record)) {
+            write_record(record);
+            s.records_written.fetch_add(1, std::memory_order_release);
+            wrote = true;
+        }
+
+        std::unique_lock<std::mutex> lock(s.mutex);
+        if (wrote) {
+            s.drained_cv.notify_all();
+        }
+        if (s.stop_requested.load() && s.queue->empty()) {
+            break;
+        }
+        s.writer_cv.wait_for(lock, s.config.idle_wait);
+    }
+}
+
+} // namespace
+
+bool AsyncLogger::start() {
+    return start(Config{});
+}
+
+bool AsyncLogger::start(const Config& config) {
+    auto& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    if (s.running.load()) {
+        return true;
+    }
+
+    s.config = config;
+    if (!s.queue) {
+        // Kept for the life of the process so a producer racing stop() never sees it freed
+        s.queue = std::make_unique<LockFreeQueue<LogRecord>>(std::max<size_t>(config.queue_capacity, 1));
+    }
+    s.stop_requested.store(false);
+    s.writer_thread = std::thread(writer_loop);
+    s.running.store(true, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogger::stop() {
+    auto& s = state();
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        if (!s.running.exchange(false)) {
+            return;
+        }
+        s.stop_requested.store(true);
+    }
+    s.writer_cv.notify_all();
+    if (s.writer_thread.joinable()) {
+        s.writer_thread.join();
+    }
+
+    // Producers that saw running just before stop may still be pushing; their records go out below
+    while (s.submitters.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+    LogRecord record;
+    while (s.queue->try_pop(record)) {
+        write_record(record);
+        s.records_written.fetch_add(1, std::memory_order_release);
+    }
+}
+
+bool AsyncLogger::is_running() {
+    return state().running.load(std::memory_order_acquire);
+}
+
+bool AsyncLogger::flush(std::chrono::milliseconds timeout) {
+    auto& s = state();
+    if (!is_running()) {
+        return true;
+    }
+
+    const uint64_t target = s.records_queued.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(s.mutex);
+    s.writer_cv.notify_one();
+    return s.drained_cv.wait_for(lock, timeout, [&s, target] {
+        return s.records_written.load(std::memory_order_acquire) >= target;
+    });
+}
+
+AsyncLogger::Statistics AsyncLogger::get_statistics() {
+    auto& s = state();
+    Statistics stats;
+    stats.records_written = s.records_written.load();
+    stats.records_dropped = s.records_dropped.load();
+    stats.records_suppressed = s.records_suppressed.load();
+    return stats;
+}
+
+void AsyncLogger::submit(LogRecord&& record) {
+    auto& s = state();
+    if (record.suppressed > 0) {
+        s.records_suppressed.fetch_add(record.suppressed, std::memory_order_relaxed);
+    }
+
+    // Registered before checking running, so stop() either is seen here or waits for this push
+    s.submitters.fetch_add(1, std::memory_order_seq_cst);
+    if (!s.running.load(std::memory_order_seq_cst)) {
+        s.submitters.fetch_sub(1, std::memory_order_release);
+        write_record(record);
+        return;
+    }
+    if (!s.queue->try_push(std::move(record))) {
+        s.submitters.fetch_sub(1, std::memory_order_release);
+        s.records_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    s.records_queued.fetch_add(1, std::memory_order_release);
+    s.submitters.fetch_sub(1, std::memory_order_release);
+}
+
+} // namespace trading
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "logging.hpp"
+#include "core/messaging/lock_free_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Calls below this level compile to nothing: 0 TRACE, 1 DEBUG, 2 INFO, 3 WARN, 4 ERROR, 5 CRITICAL
+#ifndef TRADING_LOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define TRADING_LOG_ACTIVE_LEVEL 2
+#else
+#define TRADING_LOG_ACTIVE_LEVEL 1
+#endif
+#endif
+
+namespace trading {
+
+/**
+ * Log Argument
+ * One captured argument: scalars by value, text as a slice of the record's arena
+ */
+struct LogArg {
+    enum class Type : uint8_t { INT, UINT, DOUBLE, BOOL, CHAR, TEXT };
+
+    Type type = Type::INT;
+    union {
+        int64_t i;
+        uint64_t u;
+        double d;
+        bool b;
+        char c;
+        struct {
+            uint16_t offset;
+            uint16_t length;
+        } text;
+    };
+
+    LogArg() : i(0) {}
+};
+
+/**
+ * Log Record
+ * Fixed-size capture of one log call: the format string (which must outlive the
+ * record, i.e. a literal), up to MAX_ARGS arguments and TEXT_CAPACITY bytes of
+ * copied text. Building a record never allocates; text beyond the arena and
+ * arguments beyond MAX_ARGS are truncated.
+ */
+struct LogRecord {
+    static constexpr size_t MAX_ARGS = 8;
+    static constexpr size_t TEXT_CAPACITY = 256;
+
+    Logger::Level level = Logger::Level::INFO;
+    const char* format = "";
+    std::chrono::system_clock::time_point time;
+    uint32_t suppressed = 0;          // Calls dropped by this call site's rate limiter since the last record
+    uint8_t arg_count = 0;
+    uint16_t text_used = 0;
+    LogArg args[MAX_ARGS];
+    char text[TEXT_CAPACITY];
+
+    template<typename T>
+    void add(const T& value);
+
+    // "{}" placeholders replaced by the arguments in order; "{{" and "}}" are literal braces
+    std::string to_string() const;
+
+private:
+    LogArg* next_arg();
+    void add_text(std::string_view value);
+};
+
+/**
+ * Log Rate Limiter
+ * Allows up to max_per_second calls per one-second window at one call site and
+ * counts the rest, so the next message that gets through can say how many were
+ * dropped. Lock-free; concurrent callers may overshoot a window by a few calls.
+ */
+class LogRateLimiter {
+public:
+    explicit LogRateLimiter(uint32_t max_per_second);
+
+    // suppressed receives the number of calls dropped since the last allowed one
+    bool allow(uint32_t& suppressed);
+
+private:
+    const uint32_t max_per_second_;
+    std::atomic<int64_t> window_start_ns_;
+    std::atomic<uint32_t> window_count_;
+    std::atomic<uint32_t> suppressed_;
+};
+
+/**
+ * Async Logger
+ * Hot-path logging through a pre-allocated ring: callers capture a LogRecord
+ * and push it without formatting or allocating, and a background thread formats
+ * it and writes it to the Logger sinks with the original timestamp. A full ring
+ * drops the record (counted) rather than blocking the caller. When the logger
+ * is not running, records are formatted and written on the calling thread.
+ */
+class AsyncLogger {
+public:
+    struct Config {
+        size_t queue_capacity = 16384;
+        std::chrono::milliseconds idle_wait{5};
+    };
+
+    struct Statistics {
+        uint64_t records_written = 0;
+        uint64_t records_dropped = 0;
+        uint64_t records_suppressed = 0;     // Rate-limited calls, as reported by the next record from their call site
+    };
+
+    static bool start();
+    static bool start(const Config& config);
+    // Writes everything already queued before returning
+    static void stop();
+    static bool is_running();
+
+    // Wait until every record queued so far has been written
+    static bool flush(std::chrono::milliseconds timeout = std::chrono::milliseconds(1000));
+
+    static Statistics get_statistics();
+
+    template<typename... Args>
+    static void log(Logger::Level level, const char* format, const Args&... args) {
+        log_suppressed(level, 0, format, args...);
+    }
+
+    template<typename... Args>
+    static void log_suppressed(Logger::Level level, uint32_t suppressed, const char* format, const Args&... args) {
+        if (!Logger::should_log(level)) {
+            return;
+        }
+        LogRecord record;
+        record.level = level;
+        record.format = format;
+        record.time = std::chrono::system_clock::now();
+        record.suppressed = suppressed;
+        (record.add(args), ...);
+        submit(std::move(record));
+    }
+
+private:
+    static void submit(LogRecord&& record);
+};
+
+// LogRecord implementation
+
+template<typename T>
+void LogRecord::add(const T& value) {
+    using Value = std::decay_t<T>;
+    if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        add_text(std::string_view(value));
+    } else {
+        LogArg* arg = next_arg();
+        if (!arg) {
+            return;
+        }
+        if constexpr (std::is_same_v<Value, bool>) {
+            arg->type = LogArg::Type::BOOL;
+            arg->b = value;
+        } else if constexpr (std::is_same_v<Value, char>) {
+            arg->type = LogArg::Type::CHAR;
+            arg->c = value;
+        } else if constexpr (std::is_enum_v<Value>) {
+            arg->type = LogArg::Type::INT;
+            arg->i = static_cast<int64_t>(value);
+        } else if constexpr (std::is_integral_v<Value> && std::is_signed_v<Value>) {
+            arg->type = LogArg::Type::INT;
+            arg->i = static_cast<int64_t>(value);
+        } else if constexpr (std::is_integral_v<Value>) {
+            arg->type = LogArg::Type::UINT;
+            arg->u = static_cast<uint64_t>(value);
+        } else if constexpr (std::is_floating_point_v<Value>) {
+            arg->type = LogArg::Type::DOUBLE;
+            arg->d = static_cast<double>(value);
+        } else {
+            static_assert(std::is_arithmetic_v<Value>, "Unsupported async log argument type");
+        }
+    }
+}
+
+} // namespace trading
+
+// Hot-path logging; calls below TRADING_LOG_ACTIVE_LEVEL are discarded at compile time
+#define ASYNC_LOG(level, ...) do { \
+    if constexpr (static_cast<int>(level) >= TRADING_LOG_ACTIVE_LEVEL) { \
+        trading::AsyncLogger::log(level, __VA_ARGS__); \
+    } \
+} while(0)
+
+#define ASYNC_LOG_TRACE(...) ASYNC_LOG(trading::Logger::Level::TRACE, __VA_ARGS__)
+#define ASYNC_LOG_DEBUG(...) ASYNC_LOG(trading::Logger::Level::DEBUG, __VA_ARGS__)
+#define ASYNC_LOG_INFO(...) ASYNC_LOG(trading::Logger::Level::INFO, __VA_ARGS__)
+#define ASYNC_LOG_WARN(...) ASYNC_LOG(trading::Logger::Level::WARN, __VA_ARGS__)
+#define ASYNC_LOG_ERROR(...) ASYNC_LOG(trading::Logger::Level::ERROR, __VA_ARGS__)
+
+// At most max_per_second records per second from this call site
+#define ASYNC_LOG_RATE_LIMITED(level, max_per_second, ...) do { \
+    if constexpr (static_cast<int>(level) >= TRADING_LOG_ACTIVE_LEVEL) { \
+        static trading::LogRateLimiter trading_log_limiter(max_per_second); \
+        uint32_t trading_log_suppressed = 0; \
+        if (trading_log_limiter.allow(trading_log_suppressed)) { \
+            trading::AsyncLogger::log_suppressed(level, trading_log_suppressed, __VA_ARGS__); \
+        } \
+    } \
+} while(0)
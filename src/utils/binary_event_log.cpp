@@ -0,0 +1,507 @@
+#include "binary_event_log.hpp"
+#include "logging.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace trading {
+
+namespace {
+
+#define EVENT_FIELD(Struct, member, field_type) \
+    EventField{#member, field_type, static_cast<std::uint16_t>(offsetof(Struct, member)), \
+               static_cast<std::uint16_t>(sizeof(Struct::member))}
+
+const EventField ORDER_FIELDS[] = {
+    EVENT_FIELD(OrderEventFields, order_id, EventFieldType::TEXT),
+    EVENT_FIELD(OrderEventFields, symbol, EventFieldType::TEXT),
+    EVENT_FIELD(OrderEventFields, side, EventFieldType::INT8),
+    EVENT_FIELD(OrderEventFields, type, EventFieldType::INT8),
+    EVENT_FIELD(OrderEventFields, status, EventFieldType::INT8),
+    EVENT_FIELD(OrderEventFields, quantity, EventFieldType::FLOAT64),
+    EVENT_FIELD(OrderEventFields, price, EventFieldType::FLOAT64),
+    EVENT_FIELD(OrderEventFields, filled_quantity, EventFieldType::FLOAT64),
+};
+
+const EventField TRADE_FIELDS[] = {
+    EVENT_FIELD(TradeEventFields, trade_id, EventFieldType::TEXT),
+    EVENT_FIELD(TradeEventFields, order_id, EventFieldType::TEXT),
+    EVENT_FIELD(TradeEventFields, symbol, EventFieldType::TEXT),
+    EVENT_FIELD(TradeEventFields, side, EventFieldType::INT8),
+    EVENT_FIELD(TradeEventFields, type, EventFieldType::INT8),
+    EVENT_FIELD(TradeEventFields, quantity, EventFieldType::FLOAT64),
+    EVENT_FIELD(TradeEventFields, price, EventFieldType::FLOAT64),
+};
+
+const EventField MARKET_DATA_FIELDS[] = {
+    EVENT_FIELD(MarketDataFields, symbol, EventFieldType::TEXT),
+    EVENT_FIELD(MarketDataFields, bid_price, EventFieldType::FLOAT64),
+    EVENT_FIELD(MarketDataFields, ask_price, EventFieldType::FLOAT64),
+    EVENT_FIELD(MarketDataFields, last_price, EventFieldType::FLOAT64),
+    EVENT_FIELD(MarketDataFields, volume, EventFieldType::FLOAT64),
+    EVENT_FIELD(MarketDataFields, exchange_time_ns, EventFieldType::INT64),
+};
+
+#undef EVENT_FIELD
+
+const EventSchemaInfo SCHEMAS[] = {
+    {EventSchema::ORDER, "order", sizeof(OrderEventFields), ORDER_FIELDS, std::size(ORDER_FIELDS)},
+    {EventSchema::TRADE, "trade", sizeof(TradeEventFields), TRADE_FIELDS, std::size(TRADE_FIELDS)},
+    {EventSchema::MARKET_DATA, "market_data", sizeof(MarketDataFields), MARKET_DATA_FIELDS,
+     std::size(MARKET_DATA_FIELDS)},
+};
+
+constexpr size_t RECORD_ALIGNMENT = 8;
+constexpr size_t MIN_SEGMENT_SIZE = 64 * 1024;
+
+std::int64_t now_ns(std::chrono::system_clock::time_point time = std::chrono::system_clock::now()) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+template<size_t N>
+void copy_text(char (&destination)[N], std::string_view value) {
+    std::memset(destination, 0, N);
+    std::memcpy(destination, value.data(), std::min(value.size(), N));
+}
+
+std::string_view field_text(const std::uint8_t* payload, const EventField& field) {
+    const auto* text = reinterpret_cast<const char*>(payload + field.offset);
+    const void* end = std::memchr(text, '\0', field.size);
+    return std::string_view(text, end ? static_cast<size_t>(static_cast<const char*>(end) - text) : field.size);
+}
+
+void append_value(std::string& out, const std::uint8_t* payload, const EventField& field) {
+    char buffer[32];
+    std::to_chars_result result{buffer, std::errc()};
+    switch (field.type) {
+        case EventFieldType::TEXT:
+            out.append(field_text(payload, field));
+            return;
+        case EventFieldType::INT8: {
+            std::int8_t value;
+            std::memcpy(&value, payload + field.offset, sizeof(value));
+            result = std::to_chars(buffer, buffer + sizeof(buffer), static_cast<int>(value));
+            break;
+        }
+        case EventFieldType::INT64: {
+            std::int64_t value;
+            std::memcpy(&value, payload + field.offset, sizeof(value));
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            break;
+        }
+        case EventFieldType::FLOAT64: {
+            double value;
+            std::memcpy(&value, payload + field.offset, sizeof(value));
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            break;
+        }
+    }
+    out.append(buffer, result.ptr);
+}
+
+void append_csv_value(std::string& out, const std::uint8_t* payload, const EventField& field) {
+    if (field.type != EventFieldType::TEXT) {
+        append_value(out, payload, field);
+        return;
+    }
+    auto text = field_text(payload, field);
+    if (text.find_first_of(",\"\n") == std::string_view::npos) {
+        out.append(text);
+        return;
+    }
+    out.push_back('"');
+    for (char c : text) {
+        if (c == '"') {
+            out.push_back('"');
+        }
+        out.push_back(c);
+    }
+    out.push_back('"');
+}
+
+// "YYYY-MM-DD HH:MM:SS.nnnnnnnnn" in UTC
+std::string format_timestamp(std::int64_t timestamp_ns) {
+    using namespace std::chrono;
+    auto time = sys_time<nanoseconds>(nanoseconds(timestamp_ns));
+    auto day = floor<days>(time);
+    year_month_day date(day);
+    hh_mm_ss<nanoseconds> clock_time(time - day);
+    char buffer[40];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u %02d:%02d:%02d.%09lld", static_cast<int>(date.year()),
+                  static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()),
+                  static_cast<int>(clock_time.hours().count()), static_cast<int>(clock_time.minutes().count()),
+                  static_cast<int>(clock_time.seconds().count()),
+                  static_cast<long long>(clock_time.subseconds().count()));
+    return buffer;
+}
+
+} // namespace
+
+BinaryEventLog::BinaryEventLog(const Config& config)
+    : config_(config)
+    , is_open_(false)
+    , base_(nullptr)
+    , capacity_(0)
+    , used_(0)
+#ifdef _WIN32
+    , file_handle_(nullptr)
+    , mapping_handle_(nullptr)
+#else
+    , fd_(-1)
+#endif
+    , records_written_(0)
+    , bytes_written_(0)
+    , segments_created_(0)
+    , records_dropped_(0) {
+    config_.segment_size_bytes = std::max(config_.segment_size_bytes, MIN_SEGMENT_SIZE);
+}
+
+BinaryEventLog::~BinaryEventLog() {
+    close();
+}
+
+bool BinaryEventLog::open() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (is_open_.load()) {
+        return true;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(config_.directory, ec);
+    if (ec || !open_segment()) {
+        Logger::error("BinaryEventLog: Cannot open event log in " + config_.directory);
+        return false;
+    }
+    is_open_.store(true);
+    Logger::info("BinaryEventLog: Writing events to " + config_.directory);
+    return true;
+}
+
+void BinaryEventLog::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!is_open_.exchange(false)) {
+        return;
+    }
+    close_segment();
+    Logger::info("BinaryEventLog: Closed after " + std::to_string(records_written_.load()) + " records");
+}
+
+bool BinaryEventLog::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!base_) {
+        return false;
+    }
+#ifdef _WIN32
+    return FlushViewOfFile(base_, used_) != 0;
+#else
+    return ::msync(base_, used_, MS_SYNC) == 0;
+#endif
+}
+
+bool BinaryEventLog::log_order(std::string_view order_id, std::string_view symbol, int side, int type, int status,
+                               double quantity, double price, double filled_quantity) {
+    OrderEventFields fields{};
+    copy_text(fields.order_id, order_id);
+    copy_text(fields.symbol, symbol);
+    fields.side = static_cast<std::int8_t>(side);
+    fields.type = static_cast<std::int8_t>(type);
+    fields.status = static_cast<std::int8_t>(status);
+    fields.quantity = quantity;
+    fields.price = price;
+    fields.filled_quantity = filled_quantity;
+    return append(EventSchema::ORDER, &fields, sizeof(fields));
+}
+
+bool BinaryEventLog::log_trade(std::string_view trade_id, std::string_view order_id, std::string_view symbol,
+                               int side, int type, double quantity, double price) {
+    TradeEventFields fields{};
+    copy_text(fields.trade_id, trade_id);
+    copy_text(fields.order_id, order_id);
+    copy_text(fields.symbol, symbol);
+    fields.side = static_cast<std::int8_t>(side);
+    fields.type = static_cast<std::int8_t>(type);
+    fields.quantity = quantity;
+    fields.price = price;
+    return append(EventSchema::TRADE, &fields, sizeof(fields));
+}
+
+bool BinaryEventLog::log_market_data(std::string_view symbol, double bid_price, double ask_price, double last_price,
+                                     double volume, std::chrono::system_clock::time_point exchange_time) {
+    MarketDataFields fields{};
+    copy_text(fields.symbol, symbol);
+    fields.bid_price = bid_price;
+    fields.ask_price = ask_price;
+    fields.last_price = last_price;
+    fields.volume = volume;
+    fields.exchange_time_ns = now_ns(exchange_time);
+    return append(EventSchema::MARKET_DATA, &fields, sizeof(fields));
+}
+
+BinaryEventLog::Statistics BinaryEventLog::get_statistics() const {
+    Statistics stats;
+    stats.records_written = records_written_.load();
+    stats.bytes_written = bytes_written_.load();
+    stats.segments_created = segments_created_.load();
+    stats.records_dropped = records_dropped_.load();
+    return stats;
+}
+
+bool BinaryEventLog::append(EventSchema schema, const void* payload, size_t payload_size) {
+    EventRecordHeader header{};
+    header.schema_id = static_cast<std::uint16_t>(schema);
+    header.size = static_cast<std::uint16_t>((sizeof(header) + payload_size + RECORD_ALIGNMENT - 1) &
+                                             ~(RECORD_ALIGNMENT - 1));
+    header.timestamp_ns = now_ns();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!base_) {
+        records_dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (used_ + header.size > capacity_) {
+        close_segment();
+        if (!open_segment()) {
+            Logger::error("BinaryEventLog: Cannot start a new segment in " + config_.directory);
+            records_dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    // The mapping is zero-filled, so padding needs no write
+    std::memcpy(base_ + used_, &header, sizeof(header));
+    std::memcpy(base_ + used_ + sizeof(header), payload, payload_size);
+    used_ += header.size;
+    const auto used_bytes = static_cast<std::uint64_t>(used_);
+    std::memcpy(base_ + offsetof(EventLogFileHeader, used_bytes), &used_bytes, sizeof(used_bytes));
+
+    records_written_.fetch_add(1, std::memory_order_relaxed);
+    bytes_written_.fetch_add(header.size, std::memory_order_relaxed);
+    return true;
+}
+
+bool BinaryEventLog::open_segment() {
+    const size_t capacity = config_.segment_size_bytes;
+    std::int64_t created = now_ns();
+
+    // Names sort by creation time; step past a name that is already taken
+    for (int attempt = 0; attempt < 16; ++attempt, ++created) {
+        char name[48];
+        std::snprintf(name, sizeof(name), "events-%020lld.bin", static_cast<long long>(created));
+        const std::string path = (std::filesystem::path(config_.directory) / name).string();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_NEW,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            if (GetLastError() == ERROR_FILE_EXISTS) continue;
+            return false;
+        }
+        ULARGE_INTEGER size;
+        size.QuadPart = capacity;
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, size.HighPart, size.LowPart, nullptr);
+        void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, capacity) : nullptr;
+        if (!view) {
+            if (mapping) CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+        file_handle_ = file;
+        mapping_handle_ = mapping;
+#else
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            if (errno == EEXIST) continue;
+            return false;
+        }
+        void* view = ::ftruncate(fd, static_cast<off_t>(capacity)) == 0
+                         ? ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                         : MAP_FAILED;
+        if (view == MAP_FAILED) {
+            ::close(fd);
+            std::filesystem::remove(path);
+            return false;
+        }
+        fd_ = fd;
+#endif
+
+        base_ = static_cast<std::uint8_t*>(view);
+        capacity_ = capacity;
+        used_ = sizeof(EventLogFileHeader);
+
+        EventLogFileHeader file_header{};
+        std::memcpy(file_header.magic, EventLogFileHeader::MAGIC, sizeof(file_header.magic));
+        file_header.version = EventLogFileHeader::VERSION;
+        file_header.header_size = sizeof(EventLogFileHeader);
+        file_header.used_bytes = used_;
+        file_header.created_ns = created;
+        std::memcpy(base_, &file_header, sizeof(file_header));
+
+        segments_created_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void BinaryEventLog::close_segment() {
+    if (!base_) {
+        return;
+    }
+
+    // Trim the preallocated tail so closed segments are only as large as their records
+#ifdef _WIN32
+    FlushViewOfFile(base_, used_);
+    UnmapViewOfFile(base_);
+    CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    LARGE_INTEGER end;
+    end.QuadPart = static_cast<LONGLONG>(used_);
+    SetFilePointerEx(static_cast<HANDLE>(file_handle_), end, nullptr, FILE_BEGIN);
+    SetEndOfFile(static_cast<HANDLE>(file_handle_));
+    CloseHandle(static_cast<HANDLE>(file_handle_));
+    file_handle_ = nullptr;
+    mapping_handle_ = nullptr;
+#else
+    ::msync(base_, used_, MS_SYNC);
+    ::munmap(base_, capacity_);
+    if (::ftruncate(fd_, static_cast<off_t>(used_)) != 0) {
+        Logger::warn("BinaryEventLog: Could not trim segment");
+    }
+    ::close(fd_);
+    fd_ = -1;
+#endif
+
+    base_ = nullptr;
+    capacity_ = 0;
+    used_ = 0;
+}
+
+// Offline reading
+
+const EventSchemaInfo* BinaryEventLog::find_schema(std::uint16_t schema_id) {
+    for (const auto& schema : SCHEMAS) {
+        if (static_cast<std::uint16_t>(schema.id) == schema_id) {
+            return &schema;
+        }
+    }
+    return nullptr;
+}
+
+const EventSchemaInfo* BinaryEventLog::find_schema(std::string_view name) {
+    for (const auto& schema : SCHEMAS) {
+        if (name == schema.name) {
+            return &schema;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<std::string> BinaryEventLog::list_segments(const std::string& directory) {
+    std::vector<std::string> segments;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        const auto name = entry.path().filename().string();
+        if (entry.is_regular_file() && name.rfind("events-", 0) == 0 && entry.path().extension() == ".bin") {
+            segments.push_back(entry.path().string());
+        }
+    }
+    std::sort(segments.begin(), segments.end());
+    return segments;
+}
+
+bool BinaryEventLog::read_segment(const std::string& path, const RecordVisitor& visitor) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    EventLogFileHeader file_header;
+    if (data.size() < sizeof(file_header)) {
+        return false;
+    }
+    std::memcpy(&file_header, data.data(), sizeof(file_header));
+    if (std::memcmp(file_header.magic, EventLogFileHeader::MAGIC, sizeof(file_header.magic)) != 0 ||
+        file_header.version != EventLogFileHeader::VERSION || file_header.header_size < sizeof(file_header)) {
+        return false;
+    }
+
+    const size_t end = static_cast<size_t>(std::min<std::uint64_t>(file_header.used_bytes, data.size()));
+    size_t position = file_header.header_size;
+    while (position + sizeof(EventRecordHeader) <= end) {
+        EventRecordHeader header;
+        std::memcpy(&header, data.data() + position, sizeof(header));
+        if (header.schema_id == 0 || header.size < sizeof(header) || position + header.size > end) {
+            break;
+        }
+        const auto* schema = find_schema(header.schema_id);
+        if (schema && header.size < sizeof(header) + schema->payload_size) {
+            break;   // Truncated record
+        }
+        if (!visitor(header, data.data() + position + sizeof(header))) {
+            break;
+        }
+        position += header.size;
+    }
+    return true;
+}
+
+std::string BinaryEventLog::format_text(const EventRecordHeader& header, const std::uint8_t* payload) {
+    std::string out = format_timestamp(header.timestamp_ns);
+    const auto* schema = find_schema(header.schema_id);
+    if (!schema) {
+        out += " schema=" + std::to_string(header.schema_id) + " (" +
+               std::to_string(header.size - sizeof(header)) + " bytes)";
+        return out;
+    }
+
+    out.push_back(' ');
+    out.append(schema->name);
+    for (size_t i = 0; i < schema->field_count; ++i) {
+        out.push_back(' ');
+        out.append(schema->fields[i].name);
+        out.push_back('=');
+        append_value(out, payload, schema->fields[i]);
+    }
+    return out;
+}
+
+std::string BinaryEventLog::format_csv_header(const EventSchemaInfo& schema) {
+    std::string out = "timestamp_ns";
+    for (size_t i = 0; i < schema.field_count; ++i) {
+        out.push_back(',');
+        out.append(schema.fields[i].name);
+    }
+    return out;
+}
+
+std::string BinaryEventLog::format_csv_row(const EventRecordHeader& header, const std::uint8_t* payload) {
+    std::string out = std::to_string(header.timestamp_ns);
+    if (const auto* schema = find_schema(header.schema_id)) {
+        for (size_t i = 0; i < schema->field_count; ++i) {
+            out.push_back(',');
+            append_csv_value(out, payload, schema->fields[i]);
+        }
+    }
+    return out;
+}
+
+} // namespace trading
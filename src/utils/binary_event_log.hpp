@@ -0,0 +1,194 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace trading {
+
+enum class EventSchema : std::uint16_t {
+    ORDER = 1,
+    TRADE = 2,
+    MARKET_DATA = 3
+};
+
+/**
+ * Event Log File Header
+ * First 64 bytes of every segment. used_bytes covers the header and every
+ * complete record; it is only advanced after a record has been copied in, so a
+ * crash mid-append leaves the segment readable up to the previous record.
+ */
+struct EventLogFileHeader {
+    static constexpr char MAGIC[8] = {'T', 'S', 'E', 'V', 'L', 'O', 'G', '\0'};
+    static constexpr std::uint32_t VERSION = 1;
+
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_size;
+    std::uint64_t used_bytes;
+    std::int64_t created_ns;
+    std::uint8_t reserved[32];
+};
+
+static_assert(sizeof(EventLogFileHeader) == 64, "Event log header must stay 64 bytes");
+
+/**
+ * Event Record Header
+ * Precedes each record's payload; size includes the header and is a multiple of 8.
+ * Timestamps are nanoseconds since the Unix epoch.
+ */
+struct EventRecordHeader {
+    std::uint16_t schema_id;
+    std::uint16_t size;
+    std::uint32_t reserved;
+    std::int64_t timestamp_ns;
+};
+
+static_assert(sizeof(EventRecordHeader) == 16, "Event record header must stay 16 bytes");
+
+// Payloads: raw fields, ids and symbols NUL-padded (and truncated) to fixed width
+struct OrderEventFields {
+    char order_id[32];
+    char symbol[16];
+    double quantity;
+    double price;
+    double filled_quantity;
+    std::int8_t side;
+    std::int8_t type;
+    std::int8_t status;
+    std::uint8_t reserved[5];
+};
+
+struct TradeEventFields {
+    char trade_id[32];
+    char order_id[32];
+    char symbol[16];
+    double quantity;
+    double price;
+    std::int8_t side;
+    std::int8_t type;
+    std::uint8_t reserved[6];
+};
+
+struct MarketDataFields {
+    char symbol[16];
+    double bid_price;
+    double ask_price;
+    double last_price;
+    double volume;
+    std::int64_t exchange_time_ns;
+};
+
+enum class EventFieldType : std::uint8_t { TEXT, INT8, INT64, FLOAT64 };
+
+struct EventField {
+    const char* name;
+    EventFieldType type;
+    std::uint16_t offset;
+    std::uint16_t size;
+};
+
+/**
+ * Event Schema Info
+ * Field layout of one schema, shared by the writer and the offline decoder
+ */
+struct EventSchemaInfo {
+    EventSchema id;
+    const char* name;
+    std::uint16_t payload_size;
+    const EventField* fields;
+    size_t field_count;
+};
+
+/**
+ * Binary Event Log
+ * Structured log of order events, fills and market data as fixed-layout binary
+ * records appended to memory-mapped segment files (<directory>/events-<ns>.bin).
+ * An append is a bounds check and a memcpy into the mapping - no formatting and
+ * no system call - and the page cache makes records survive a process crash.
+ * flush() and segment rollover msync the mapping; close() trims the file to its
+ * used length. Decode offline with the event_log_decoder tool.
+ */
+class BinaryEventLog {
+public:
+    struct Config {
+        std::string directory = "./logs/events";
+        size_t segment_size_bytes = 64 * 1024 * 1024;
+    };
+
+    struct Statistics {
+        uint64_t records_written = 0;
+        uint64_t bytes_written = 0;
+        uint64_t segments_created = 0;
+        uint64_t records_dropped = 0;   // Log closed or a segment could not be created
+    };
+
+    // Return false to stop reading
+    using RecordVisitor = std::function<bool(const EventRecordHeader&, const std::uint8_t* payload)>;
+
+    explicit BinaryEventLog(const Config& config);
+    ~BinaryEventLog();
+
+    // Non-copyable
+    BinaryEventLog(const BinaryEventLog&) = delete;
+    BinaryEventLog& operator=(const BinaryEventLog&) = delete;
+
+    bool open();
+    void close();
+    bool is_open() const { return is_open_.load(); }
+    bool flush();
+
+    // side/type/status are the enum values of OrderSide, OrderType/TradeType and OrderStatus
+    bool log_order(std::string_view order_id, std::string_view symbol, int side, int type, int status,
+                   double quantity, double price, double filled_quantity);
+    bool log_trade(std::string_view trade_id, std::string_view order_id, std::string_view symbol, int side, int type,
+                   double quantity, double price);
+    bool log_market_data(std::string_view symbol, double bid_price, double ask_price, double last_price, double volume,
+                         std::chrono::system_clock::time_point exchange_time);
+
+    Statistics get_statistics() const;
+
+    // Offline reading
+    static const EventSchemaInfo* find_schema(std::uint16_t schema_id);
+    static const EventSchemaInfo* find_schema(std::string_view name);
+    static std::vector<std::string> list_segments(const std::string& directory);   // Oldest first
+    static bool read_segment(const std::string& path, const RecordVisitor& visitor);
+
+    // Rendering for the decoder: "<time> <schema> field=value ..." or CSV columns timestamp_ns then fields
+    static std::string format_text(const EventRecordHeader& header, const std::uint8_t* payload);
+    static std::string format_csv_header(const EventSchemaInfo& schema);
+    static std::string format_csv_row(const EventRecordHeader& header, const std::uint8_t* payload);
+
+private:
+    Config config_;
+    std::atomic<bool> is_open_;
+
+    // Active segment mapping, guarded by mutex_
+    mutable std::mutex mutex_;
+    std::uint8_t* base_;
+    size_t capacity_;
+    size_t used_;
+#ifdef _WIN32
+    void* file_handle_;
+    void* mapping_handle_;
+#else
+    int fd_;
+#endif
+
+    std::atomic<uint64_t> records_written_;
+    std::atomic<uint64_t> bytes_written_;
+    std::atomic<uint64_t> segments_created_;
+    std::atomic<uint64_t> records_dropped_;
+
+    bool append(EventSchema schema, const void* payload, size_t payload_size);
+    bool open_segment();     // Caller holds mutex_
+    void close_segment();    // Caller holds mutex_
+};
+
+} // namespace trading
@@ -9,6 +9,14 @@
 
 namespace trading {
 
+namespace {
+
+bool is_one_of(const std::string& value, std::initializer_list<const char*> options) {
+    return std::any_of(options.begin(), options.end(), [&value](const char* option) { return value == option; });
+}
+
+} // namespace
+
 // MarketDataConfig implementation
 bool MarketDataConfig::is_valid() const {
     if (symbols.empty()) return false;
@@ -47,6 +55,14 @@ bool RiskManagementConfig::is_valid() const {
     if (max_order_size <= 0) return false;
     if (max_daily_loss <= 0) return false;
     if (max_order_size > max_position_size) return false;
+    if (circuit_breaker_max_loss < 0) return false;
+    if (circuit_breaker_max_orders_per_second < 0) return false;
+    if (circuit_breaker_max_reject_rate < 0 || circuit_breaker_max_reject_rate > 1.0) return false;
+    if (circuit_breaker_min_orders < 0) return false;
+    if (circuit_breaker_max_feed_staleness_ms < 0) return false;
+    if (max_orders_per_second < 0 || max_cancels_per_second < 0) return false;
+    if (max_orders_per_second_per_symbol < 0 || max_cancels_per_second_per_symbol < 0) return false;
+    if (price_band_percent < 0 || max_order_notional < 0 || max_notional_per_second < 0) return false;
     return true;
 }
 
@@ -55,6 +71,19 @@ std::string RiskManagementConfig::get_validation_error() const {
     if (max_order_size <= 0) return "Max order size must be positive";
     if (max_daily_loss <= 0) return "Max daily loss must be positive";
     if (max_order_size > max_position_size) return "Max order size cannot exceed max position size";
+    if (circuit_breaker_max_loss < 0) return "Circuit breaker max loss cannot be negative";
+    if (circuit_breaker_max_orders_per_second < 0) return "Circuit breaker order rate cannot be negative";
+    if (circuit_breaker_max_reject_rate < 0 || circuit_breaker_max_reject_rate > 1.0) {
+        return "Circuit breaker reject rate must be between 0 and 1";
+    }
+    if (circuit_breaker_min_orders < 0) return "Circuit breaker minimum orders cannot be negative";
+    if (circuit_breaker_max_feed_staleness_ms < 0) return "Circuit breaker feed staleness cannot be negative";
+    if (max_orders_per_second < 0 || max_cancels_per_second < 0) return "Throttle rates cannot be negative";
+    if (max_orders_per_second_per_symbol < 0 || max_cancels_per_second_per_symbol < 0) {
+        return "Per-symbol throttle rates cannot be negative";
+    }
+    if (price_band_percent < 0) return "Price band percent cannot be negative";
+    if (max_order_notional < 0 || max_notional_per_second < 0) return "Notional limits cannot be negative";
     return "";
 }
 
@@ -65,7 +94,19 @@ void RiskManagementConfig::to_json(nlohmann::json& j) const {
         {"max_daily_loss", max_daily_loss},
         {"enable_risk_checks", enable_risk_checks},
         {"symbol_position_limits", symbol_position_limits},
-        {"symbol_order_limits", symbol_order_limits}
+        {"symbol_order_limits", symbol_order_limits},
+        {"circuit_breaker_max_loss", circuit_breaker_max_loss},
+        {"circuit_breaker_max_orders_per_second", circuit_breaker_max_orders_per_second},
+        {"circuit_breaker_max_reject_rate", circuit_breaker_max_reject_rate},
+        {"circuit_breaker_min_orders", circuit_breaker_min_orders},
+        {"circuit_breaker_max_feed_staleness_ms", circuit_breaker_max_feed_staleness_ms},
+        {"max_orders_per_second", max_orders_per_second},
+        {"max_cancels_per_second", max_cancels_per_second},
+        {"max_orders_per_second_per_symbol", max_orders_per_second_per_symbol},
+        {"max_cancels_per_second_per_symbol", max_cancels_per_second_per_symbol},
+        {"price_band_percent", price_band_percent},
+        {"max_order_notional", max_order_notional},
+        {"max_notional_per_second", max_notional_per_second}
     };
 }
 
@@ -81,6 +122,19 @@ void RiskManagementConfig::from_json(const nlohmann::json& j) {
     if (j.contains("symbol_order_limits")) {
         symbol_order_limits = j["symbol_order_limits"];
     }
+
+    circuit_breaker_max_loss = j.value("circuit_breaker_max_loss", 0.0);
+    circuit_breaker_max_orders_per_second = j.value("circuit_breaker_max_orders_per_second", 0);
+    circuit_breaker_max_reject_rate = j.value("circuit_breaker_max_reject_rate", 0.0);
+    circuit_breaker_min_orders = j.value("circuit_breaker_min_orders", 20);
+    circuit_breaker_max_feed_staleness_ms = j.value("circuit_breaker_max_feed_staleness_ms", 0);
+    max_orders_per_second = j.value("max_orders_per_second", 0);
+    max_cancels_per_second = j.value("max_cancels_per_second", 0);
+    max_orders_per_second_per_symbol = j.value("max_orders_per_second_per_symbol", 0);
+    max_cancels_per_second_per_symbol = j.value("max_cancels_per_second_per_symbol", 0);
+    price_band_percent = j.value("price_band_percent", 0.0);
+    max_order_notional = j.value("max_order_notional", 0.0);
+    max_notional_per_second = j.value("max_notional_per_second", 0.0);
 }
 
 // UIConfig implementation
@@ -152,6 +206,21 @@ bool PersistenceConfig::is_valid() const {
     if (backup_path.empty()) return false;
     if (backup_interval_hours < 1 || backup_interval_hours > 168) return false;
     if (max_backup_files < 1 || max_backup_files > 100) return false;
+    if (!is_one_of(export_format, {"csv", "columnar"})) return false;
+    if (export_threads < 0 || export_threads > 256) return false;
+    if (async_batch_size < 1 || async_flush_interval_ms < 1 || async_queue_capacity < 1) return false;
+    if (!is_one_of(sqlite_journal_mode, {"WAL", "DELETE", "TRUNCATE", "PERSIST", "MEMORY", "OFF"})) return false;
+    if (!is_one_of(sqlite_synchronous, {"OFF", "NORMAL", "FULL", "EXTRA"})) return false;
+    if (sqlite_mmap_size_mb < 0 || sqlite_cache_size_mb < 0) return false;
+    if (sqlite_reader_connections < 0 || sqlite_reader_connections > 64) return false;
+    if (journal_directory.empty()) return false;
+    if (journal_segment_size_mb < 1 || journal_segment_size_mb > 4096) return false;
+    if (journal_compaction_interval_ms < 1) return false;
+    if (snapshot_directory.empty()) return false;
+    if (snapshot_interval_seconds < 1 || snapshot_retain_count < 1) return false;
+    if (position_flush_interval_ms < 0) return false;
+    if (partition_directory.empty()) return false;
+    if (partition_retention_days < 0) return false;
     return true;
 }
 
@@ -162,6 +231,30 @@ std::string PersistenceConfig::get_validation_error() const {
     if (backup_interval_hours > 168) return "Backup interval too long (maximum 168 hours/1 week)";
     if (max_backup_files < 1) return "Must keep at least 1 backup file";
     if (max_backup_files > 100) return "Too many backup files (maximum 100)";
+    if (!is_one_of(export_format, {"csv", "columnar"})) return "Invalid export format. Must be: csv or columnar";
+    if (export_threads < 0 || export_threads > 256) return "Export threads must be between 0 and 256";
+    if (async_batch_size < 1) return "Async batch size must be positive";
+    if (async_flush_interval_ms < 1) return "Async flush interval must be positive";
+    if (async_queue_capacity < 1) return "Async queue capacity must be positive";
+    if (!is_one_of(sqlite_journal_mode, {"WAL", "DELETE", "TRUNCATE", "PERSIST", "MEMORY", "OFF"})) {
+        return "Invalid SQLite journal mode. Must be: WAL, DELETE, TRUNCATE, PERSIST, MEMORY, or OFF";
+    }
+    if (!is_one_of(sqlite_synchronous, {"OFF", "NORMAL", "FULL", "EXTRA"})) {
+        return "Invalid SQLite synchronous mode. Must be: OFF, NORMAL, FULL, or EXTRA";
+    }
+    if (sqlite_mmap_size_mb < 0) return "SQLite mmap size cannot be negative";
+    if (sqlite_cache_size_mb < 0) return "SQLite cache size cannot be negative";
+    if (sqlite_reader_connections < 0 || sqlite_reader_connections > 64) return "SQLite reader connections must be between 0 and 64";
+    if (journal_directory.empty()) return "Journal directory cannot be empty";
+    if (journal_segment_size_mb < 1) return "Journal segment size too small (minimum 1MB)";
+    if (journal_segment_size_mb > 4096) return "Journal segment size too large (maximum 4096MB)";
+    if (journal_compaction_interval_ms < 1) return "Journal compaction interval must be positive";
+    if (snapshot_directory.empty()) return "Snapshot directory cannot be empty";
+    if (snapshot_interval_seconds < 1) return "Snapshot interval must be positive";
+    if (snapshot_retain_count < 1) return "Must keep at least 1 snapshot";
+    if (position_flush_interval_ms < 0) return "Position flush interval cannot be negative";
+    if (partition_directory.empty()) return "Partition directory cannot be empty";
+    if (partition_retention_days < 0) return "Partition retention days cannot be negative";
     return "";
 }
 
@@ -174,7 +267,31 @@ void PersistenceConfig::to_json(nlohmann::json& j) const {
         {"max_backup_files", max_backup_files},
         {"csv_export_path", csv_export_path},
         {"auto_export_trades", auto_export_trades},
-        {"auto_export_orders", auto_export_orders}
+        {"auto_export_orders", auto_export_orders},
+        {"export_format", export_format},
+        {"export_threads", export_threads},
+        {"async_writes", async_writes},
+        {"async_batch_size", async_batch_size},
+        {"async_flush_interval_ms", async_flush_interval_ms},
+        {"async_queue_capacity", async_queue_capacity},
+        {"sqlite_journal_mode", sqlite_journal_mode},
+        {"sqlite_synchronous", sqlite_synchronous},
+        {"sqlite_mmap_size_mb", sqlite_mmap_size_mb},
+        {"sqlite_cache_size_mb", sqlite_cache_size_mb},
+        {"sqlite_reader_connections", sqlite_reader_connections},
+        {"journal_enabled", journal_enabled},
+        {"journal_directory", journal_directory},
+        {"journal_segment_size_mb", journal_segment_size_mb},
+        {"journal_sync_on_commit", journal_sync_on_commit},
+        {"journal_compaction_interval_ms", journal_compaction_interval_ms},
+        {"snapshot_directory", snapshot_directory},
+        {"snapshot_interval_seconds", snapshot_interval_seconds},
+        {"snapshot_retain_count", snapshot_retain_count},
+        {"position_flush_interval_ms", position_flush_interval_ms},
+        {"partition_by_day", partition_by_day},
+        {"partition_directory", partition_directory},
+        {"partition_retention_days", partition_retention_days},
+        {"partition_archive_path", partition_archive_path}
     };
 }
 
@@ -187,6 +304,30 @@ void PersistenceConfig::from_json(const nlohmann::json& j) {
     csv_export_path = j.value("csv_export_path", "./data/exports/");
     auto_export_trades = j.value("auto_export_trades", false);
     auto_export_orders = j.value("auto_export_orders", false);
+    export_format = j.value("export_format", "csv");
+    export_threads = j.value("export_threads", 0);
+    async_writes = j.value("async_writes", false);
+    async_batch_size = j.value("async_batch_size", 256);
+    async_flush_interval_ms = j.value("async_flush_interval_ms", 5);
+    async_queue_capacity = j.value("async_queue_capacity", 65536);
+    sqlite_journal_mode = j.value("sqlite_journal_mode", "WAL");
+    sqlite_synchronous = j.value("sqlite_synchronous", "NORMAL");
+    sqlite_mmap_size_mb = j.value("sqlite_mmap_size_mb", 256);
+    sqlite_cache_size_mb = j.value("sqlite_cache_size_mb", 64);
+    sqlite_reader_connections = j.value("sqlite_reader_connections", 2);
+    journal_enabled = j.value("journal_enabled", false);
+    journal_directory = j.value("journal_directory", "./data/journal");
+    journal_segment_size_mb = j.value("journal_segment_size_mb", 64);
+    journal_sync_on_commit = j.value("journal_sync_on_commit", true);
+    journal_compaction_interval_ms = j.value("journal_compaction_interval_ms", 1000);
+    snapshot_directory = j.value("snapshot_directory", "./data/snapshots");
+    snapshot_interval_seconds = j.value("snapshot_interval_seconds", 300);
+    snapshot_retain_count = j.value("snapshot_retain_count", 2);
+    position_flush_interval_ms = j.value("position_flush_interval_ms", 0);
+    partition_by_day = j.value("partition_by_day", false);
+    partition_directory = j.value("partition_directory", "./data/partitions");
+    partition_retention_days = j.value("partition_retention_days", 0);
+    partition_archive_path = j.value("partition_archive_path", "");
 }
 
 // LoggingConfig implementation
@@ -197,6 +338,8 @@ bool LoggingConfig::is_valid() const {
     }
     if (max_file_size_mb < 1 || max_file_size_mb > 1000) return false;
     if (max_log_files < 1 || max_log_files > 100) return false;
+    if (async_queue_capacity < 1 || async_queue_capacity > 1048576) return false;
+    if (event_log_segment_size_mb < 1 || event_log_segment_size_mb > 4096) return false;
     return true;
 }
 
@@ -209,6 +352,8 @@ std::string LoggingConfig::get_validation_error() const {
     if (max_file_size_mb > 1000) return "Log file size too large (maximum 1000MB)";
     if (max_log_files < 1) return "Must keep at least 1 log file";
     if (max_log_files > 100) return "Too many log files (maximum 100)";
+    if (async_queue_capacity < 1 || async_queue_capacity > 1048576) return "Async log queue capacity must be between 1 and 1048576";
+    if (event_log_segment_size_mb < 1 || event_log_segment_size_mb > 4096) return "Event log segment size must be between 1 and 4096MB";
     return "";
 }
 
@@ -219,7 +364,12 @@ void LoggingConfig::to_json(nlohmann::json& j) const {
         {"console_output", console_output},
         {"file_output", file_output},
         {"max_file_size_mb", max_file_size_mb},
-        {"max_log_files", max_log_files}
+        {"max_log_files", max_log_files},
+        {"async_enabled", async_enabled},
+        {"async_queue_capacity", async_queue_capacity},
+        {"binary_event_log", binary_event_log},
+        {"event_log_directory", event_log_directory},
+        {"event_log_segment_size_mb", event_log_segment_size_mb}
     };
 }
 
@@ -230,6 +380,11 @@ void LoggingConfig::from_json(const nlohmann::json& j) {
     file_output = j.value("file_output", true);
     max_file_size_mb = j.value("max_file_size_mb", 100);
     max_log_files = j.value("max_log_files", 10);
+    async_enabled = j.value("async_enabled", false);
+    async_queue_capacity = j.value("async_queue_capacity", 16384);
+    binary_event_log = j.value("binary_event_log", false);
+    event_log_directory = j.value("event_log_directory", "./logs/events");
+    event_log_segment_size_mb = j.value("event_log_segment_size_mb", 64);
 }
 
 // TradingSystemConfig implementation
@@ -238,7 +393,8 @@ bool TradingSystemConfig::is_valid() const {
            risk_management.is_valid() &&
            ui.is_valid() &&
            persistence.is_valid() &&
-           logging.is_valid();
+           logging.is_valid() &&
+           stats_interval_seconds >= 0;
 }
 
 std::string TradingSystemConfig::get_validation_error() const {
@@ -259,6 +415,9 @@ std::string TradingSystemConfig::get_validation_error() const {
     if (!logging.is_valid()) {
         error += "Logging: " + logging.get_validation_error() + "; ";
     }
+    if (stats_interval_seconds < 0) {
+        error += "Stats interval must be non-negative; ";
+    }
 
     return error;
 }
@@ -276,6 +435,9 @@ void TradingSystemConfig::to_json(nlohmann::json& j) const {
         {"application_name", application_name},
         {"version", version},
         {"debug_mode", debug_mode},
+        {"hot_reload", hot_reload},
+        {"headless", headless},
+        {"stats_interval_seconds", stats_interval_seconds},
         {"market_data", market_data_json},
         {"risk_management", risk_json},
         {"ui", ui_json},
@@ -288,6 +450,9 @@ void TradingSystemConfig::from_json(const nlohmann::json& j) {
     application_name = j.value("application_name", "C++ Trading System");
     version = j.value("version", "1.0.0");
     debug_mode = j.value("debug_mode", false);
+    hot_reload = j.value("hot_reload", true);
+    headless = j.value("headless", false);
+    stats_interval_seconds = j.value("stats_interval_seconds", 60);
 
     if (j.contains("market_data")) {
         market_data.from_json(j["market_data"]);
@@ -309,48 +474,81 @@ void TradingSystemConfig::from_json(const nlohmann::json& j) {
 // ConfigurationManager implementation
 ConfigurationManager::ConfigurationManager(const std::string& config_file_path)
     : config_file_path_(config_file_path)
-    , is_loaded_(false) {
+    , snapshot_(std::make_shared<const TradingSystemConfig>())
+    , is_loaded_(false)
+    , next_subscription_id_(1) {
 }
 
 bool ConfigurationManager::load_configuration() {
-    std::lock_guard<std::mutex> lock(config_mutex_);
+    std::unique_lock<std::mutex> lock(config_mutex_);
 
-    try {
-        if (!config_file_exists()) {
-            log_info("load_configuration", "Config file not found, creating default: " + config_file_path_);
-            current_config_ = get_default_configuration();
-            return create_default_config_file();
-        }
+    if (!config_file_exists()) {
+        log_info("load_configuration", "Config file not found, creating default: " + config_file_path_);
+        current_config_ = get_default_configuration();
+        publish(lock);
+        return create_default_config_file();
+    }
+
+    TradingSystemConfig config;
+    if (!read_config_file(config)) {
+        return false;
+    }
+
+    // Published even when invalid, so callers can inspect what failed validation
+    current_config_ = std::move(config);
+    bool valid = current_config_.is_valid();
+    if (!valid) {
+        log_error("load_configuration", "Invalid configuration: " + current_config_.get_validation_error());
+    } else {
+        is_loaded_ = true;
+        log_info("load_configuration", "Configuration loaded successfully from: " + config_file_path_);
+    }
+    publish(lock);
+    return valid;
+}
+
+bool ConfigurationManager::reload_configuration() {
+    TradingSystemConfig config;
+    if (!read_config_file(config)) {
+        return false;
+    }
+    if (!config.is_valid()) {
+        log_error("reload_configuration", "Keeping current configuration; invalid edit: " + config.get_validation_error());
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(config_mutex_);
+    if (config == current_config_) {
+        return true;
+    }
+    current_config_ = std::move(config);
+    is_loaded_ = true;
+    log_info("reload_configuration", "Configuration reloaded from: " + config_file_path_);
+    publish(lock);
+    return true;
+}
 
+bool ConfigurationManager::read_config_file(TradingSystemConfig& config) const {
+    try {
         std::ifstream file(config_file_path_);
         if (!file.is_open()) {
-            log_error("load_configuration", "Failed to open config file: " + config_file_path_);
+            log_error("read_config_file", "Failed to open config file: " + config_file_path_);
             return false;
         }
 
         nlohmann::json j;
         file >> j;
-        file.close();
-
-        current_config_ = json_to_config(j);
-
-        // Apply environment variable overrides
-        apply_environment_overrides();
+        config = json_to_config(j);
 
-        if (!current_config_.is_valid()) {
-            log_error("load_configuration", "Invalid configuration: " + current_config_.get_validation_error());
-            return false;
-        }
-
-        is_loaded_ = true;
-        log_info("load_configuration", "Configuration loaded successfully from: " + config_file_path_);
+        // Environment variables override the file on every load
+        apply_environment_overrides(config);
         return true;
 
     } catch (const nlohmann::json::exception& e) {
-        log_error("load_configuration", "JSON parsing error: " + std::string(e.what()));
+        log_error("read_config_file", "JSON parsing error: " + std::string(e.what()));
         return false;
     } catch (const std::exception& e) {
-        log_error("load_configuration", "Unexpected error: " + std::string(e.what()));
+        log_error("read_config_file", "Unexpected error: " + std::string(e.what()));
         return false;
     }
 }
@@ -360,8 +558,6 @@ bool ConfigurationManager::save_configuration() const {
 }
 
 bool ConfigurationManager::save_configuration(const std::string& file_path) const {
-    std::lock_guard<std::mutex> lock(config_mutex_);
-
     try {
         // Ensure directory exists
         std::filesystem::path config_path(file_path);
@@ -369,7 +565,7 @@ bool ConfigurationManager::save_configuration(const std::string& file_path) cons
             ensure_directory_exists(config_path.parent_path().string());
         }
 
-        nlohmann::json j = config_to_json(current_config_);
+        nlohmann::json j = config_to_json(*get_snapshot());
 
         std::ofstream file(file_path);
         if (!file.is_open()) {
@@ -389,34 +585,32 @@ bool ConfigurationManager::save_configuration(const std::string& file_path) cons
     }
 }
 
+ConfigSnapshot ConfigurationManager::get_snapshot() const {
+    return snapshot_.load(std::memory_order_acquire);
+}
+
 TradingSystemConfig ConfigurationManager::get_configuration() const {
-    std::lock_guard<std::mutex> lock(config_mutex_);
-    return current_config_;
+    return *get_snapshot();
 }
 
 MarketDataConfig ConfigurationManager::get_market_data_config() const {
-    std::lock_guard<std::mutex> lock(config_mutex_);
-    return current_config_.market_data;
+    return get_snapshot()->market_data;
 }
 
 RiskManagementConfig ConfigurationManager::get_risk_management_config() const {
-    std::lock_guard<std::mutex> lock(config_mutex_);
-    return current_config_.risk_management;
+    return get_snapshot()->risk_management;
 }
 
 UIConfig ConfigurationManager::get_ui_config() const {
-    std::lock_guard<std::mutex> lock(config_mutex_);
-    return current_config_.ui;
+    return get_snapshot()->ui;
 }
 
 PersistenceConfig ConfigurationManager::get_persistence_config() const {
-    std::lock_guard<std::mutex> lock(config_mutex_);
-    return current_config_.persistence;
+    return get_snapshot()->persistence;
 }
 
 LoggingConfig ConfigurationManager::get_logging_config() const {
-    std::lock_guard<std::mutex> lock(config_mutex_);
-    return current_config_.logging;
+    return get_snapshot()->logging;
 }
 
 bool ConfigurationManager::update_market_data_config(const MarketDataConfig& config) {
@@ -425,8 +619,9 @@ bool ConfigurationManager::update_market_data_config(const MarketDataConfig& con
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(config_mutex_);
+    std::unique_lock<std::mutex> lock(config_mutex_);
     current_config_.market_data = config;
+    publish(lock);
     return true;
 }
 
@@ -436,8 +631,9 @@ bool ConfigurationManager::update_risk_management_config(const RiskManagementCon
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(config_mutex_);
+    std::unique_lock<std::mutex> lock(config_mutex_);
     current_config_.risk_management = config;
+    publish(lock);
     return true;
 }
 
@@ -447,8 +643,9 @@ bool ConfigurationManager::update_ui_config(const UIConfig& config) {
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(config_mutex_);
+    std::unique_lock<std::mutex> lock(config_mutex_);
     current_config_.ui = config;
+    publish(lock);
     return true;
 }
 
@@ -458,8 +655,9 @@ bool ConfigurationManager::update_persistence_config(const PersistenceConfig& co
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(config_mutex_);
+    std::unique_lock<std::mutex> lock(config_mutex_);
     current_config_.persistence = config;
+    publish(lock);
     return true;
 }
 
@@ -469,19 +667,34 @@ bool ConfigurationManager::update_logging_config(const LoggingConfig& config) {
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(config_mutex_);
+    std::unique_lock<std::mutex> lock(config_mutex_);
     current_config_.logging = config;
+    publish(lock);
     return true;
 }
 
+size_t ConfigurationManager::subscribe(ConfigSection section, ChangeCallback callback) {
+    std::lock_guard<std::mutex> lock(subscribers_mutex_);
+    size_t id = next_subscription_id_++;
+    subscribers_.push_back(Subscription{id, section, std::move(callback)});
+    return id;
+}
+
+void ConfigurationManager::unsubscribe(size_t subscription_id) {
+    std::lock_guard<std::mutex> lock(subscribers_mutex_);
+    subscribers_.erase(std::remove_if(subscribers_.begin(), subscribers_.end(),
+                                      [subscription_id](const Subscription& subscription) {
+                                          return subscription.id == subscription_id;
+                                      }),
+                       subscribers_.end());
+}
+
 bool ConfigurationManager::validate_configuration() const {
-    std::lock_guard<std::mutex> lock(config_mutex_);
-    return current_config_.is_valid();
+    return get_snapshot()->is_valid();
 }
 
 std::string ConfigurationManager::get_validation_errors() const {
-    std::lock_guard<std::mutex> lock(config_mutex_);
-    return current_config_.get_validation_error();
+    return get_snapshot()->get_validation_error();
 }
 
 bool ConfigurationManager::backup_configuration(const std::string& backup_path) const {
@@ -513,9 +726,12 @@ TradingSystemConfig ConfigurationManager::get_default_configuration() {
 }
 
 bool ConfigurationManager::reset_to_defaults() {
-    std::lock_guard<std::mutex> lock(config_mutex_);
-    current_config_ = get_default_configuration();
-    is_loaded_ = true;
+    {
+        std::unique_lock<std::mutex> lock(config_mutex_);
+        current_config_ = get_default_configuration();
+        is_loaded_ = true;
+        publish(lock);
+    }
     return save_configuration();
 }
 
@@ -553,7 +769,9 @@ bool ConfigurationManager::config_file_exists() const {
 }
 
 void ConfigurationManager::load_from_environment() {
-    apply_environment_overrides();
+    std::unique_lock<std::mutex> lock(config_mutex_);
+    apply_environment_overrides(current_config_);
+    publish(lock);
 }
 
 std::optional<std::string> ConfigurationManager::get_env_variable(const std::string& var_name) const {
@@ -566,6 +784,40 @@ std::optional<std::string> ConfigurationManager::get_env_variable(const std::str
 
 // Helper methods
 
+void ConfigurationManager::publish(std::unique_lock<std::mutex>& lock) {
+    auto current = std::make_shared<const TradingSystemConfig>(current_config_);
+    auto previous = snapshot_.exchange(current, std::memory_order_acq_rel);
+
+    // Taken before releasing the config lock so concurrent publishes notify in order
+    std::lock_guard<std::mutex> subscribers_lock(subscribers_mutex_);
+    lock.unlock();
+
+    for (const auto& subscription : subscribers_) {
+        bool changed = false;
+        switch (subscription.section) {
+            case ConfigSection::MARKET_DATA: changed = previous->market_data != current->market_data; break;
+            case ConfigSection::RISK_MANAGEMENT: changed = previous->risk_management != current->risk_management; break;
+            case ConfigSection::UI: changed = previous->ui != current->ui; break;
+            case ConfigSection::PERSISTENCE: changed = previous->persistence != current->persistence; break;
+            case ConfigSection::LOGGING: changed = previous->logging != current->logging; break;
+            case ConfigSection::APPLICATION:
+                changed = previous->application_name != current->application_name ||
+                          previous->version != current->version || previous->debug_mode != current->debug_mode ||
+                          previous->hot_reload != current->hot_reload || previous->headless != current->headless ||
+                          previous->stats_interval_seconds != current->stats_interval_seconds;
+                break;
+        }
+        if (!changed) {
+            continue;
+        }
+        try {
+            subscription.callback(*previous, *current);
+        } catch (const std::exception& e) {
+            log_error("publish", "Config change subscriber failed: " + std::string(e.what()));
+        }
+    }
+}
+
 bool ConfigurationManager::validate_file_path(const std::string& path) const {
     std::filesystem::path fs_path(path);
     return fs_path.is_absolute() || fs_path.is_relative();
@@ -580,20 +832,20 @@ bool ConfigurationManager::ensure_directory_exists(const std::string& path) cons
     }
 }
 
-void ConfigurationManager::apply_environment_overrides() {
+void ConfigurationManager::apply_environment_overrides(TradingSystemConfig& config) const {
     // Market data overrides
     if (auto url = get_env_variable("TRADING_WEBSOCKET_URL")) {
-        current_config_.market_data.websocket_url = *url;
-        current_config_.market_data.simulation_mode = false;
+        config.market_data.websocket_url = *url;
+        config.market_data.simulation_mode = false;
     }
     if (auto sim_mode = get_env_variable("TRADING_SIMULATION_MODE")) {
-        current_config_.market_data.simulation_mode = (*sim_mode == "true" || *sim_mode == "1");
+        config.market_data.simulation_mode = (*sim_mode == "true" || *sim_mode == "1");
     }
 
     // Risk management overrides
     if (auto max_pos = get_env_variable("TRADING_MAX_POSITION_SIZE")) {
         try {
-            current_config_.risk_management.max_position_size = std::stod(*max_pos);
+            config.risk_management.max_position_size = std::stod(*max_pos);
         } catch (const std::exception& e) {
             log_warning("apply_environment_overrides", "Invalid TRADING_MAX_POSITION_SIZE value: " + *max_pos);
         }
@@ -601,17 +853,22 @@ void ConfigurationManager::apply_environment_overrides() {
 
     // Database path override
     if (auto db_path = get_env_variable("TRADING_DATABASE_PATH")) {
-        current_config_.persistence.database_path = *db_path;
+        config.persistence.database_path = *db_path;
     }
 
     // Log level override
     if (auto log_level = get_env_variable("TRADING_LOG_LEVEL")) {
-        current_config_.logging.log_level = *log_level;
+        config.logging.log_level = *log_level;
     }
 
     // Debug mode override
     if (auto debug = get_env_variable("TRADING_DEBUG_MODE")) {
-        current_config_.debug_mode = (*debug == "true" || *debug == "1");
+        config.debug_mode = (*debug == "true" || *debug == "1");
+    }
+
+    // Service mode override
+    if (auto headless = get_env_variable("TRADING_HEADLESS")) {
+        config.headless = (*headless == "true" || *headless == "1");
     }
 }
 
@@ -656,6 +913,10 @@ TradingSystemConfig GlobalConfig::get() {
     return instance().get_configuration();
 }
 
+ConfigSnapshot GlobalConfig::snapshot() {
+    return instance().get_snapshot();
+}
+
 void GlobalConfig::set_config_path(const std::string& path) {
     instance_ = std::make_unique<ConfigurationManager>(path);
     instance_->load_configuration();
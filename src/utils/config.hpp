@@ -2,6 +2,10 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <memory>
+#include <atomic>
+#include <functional>
 #include <optional>
 #include <nlohmann/json.hpp>
 #include <filesystem>
@@ -25,6 +29,8 @@ struct MarketDataConfig {
     // JSON serialization
     void to_json(nlohmann::json& j) const;
     void from_json(const nlohmann::json& j);
+
+    bool operator==(const MarketDataConfig&) const = default;
 };
 
 /**
@@ -40,6 +46,24 @@ struct RiskManagementConfig {
     std::map<std::string, double> symbol_position_limits;
     std::map<std::string, double> symbol_order_limits;
 
+    // Circuit breaker triggers for the kill switch (0 disables a trigger)
+    double circuit_breaker_max_loss = 0.0;
+    int circuit_breaker_max_orders_per_second = 0;
+    double circuit_breaker_max_reject_rate = 0.0;   // Fraction of orders rejected within one second
+    int circuit_breaker_min_orders = 20;            // Orders needed in the window before the reject rate applies
+    int circuit_breaker_max_feed_staleness_ms = 0;
+
+    // Order/cancel rate throttles; bursts up to one second of the rate (0 disables)
+    int max_orders_per_second = 0;
+    int max_cancels_per_second = 0;
+    int max_orders_per_second_per_symbol = 0;
+    int max_cancels_per_second_per_symbol = 0;
+
+    // Fat-finger guards against the latest quote (0 disables)
+    double price_band_percent = 0.0;        // Max limit price deviation from the reference price
+    double max_order_notional = 0.0;
+    double max_notional_per_second = 0.0;
+
     // Validation
     bool is_valid() const;
     std::string get_validation_error() const;
@@ -47,6 +71,8 @@ struct RiskManagementConfig {
     // JSON serialization
     void to_json(nlohmann::json& j) const;
     void from_json(const nlohmann::json& j);
+
+    bool operator==(const RiskManagementConfig&) const = default;
 };
 
 /**
@@ -86,6 +112,8 @@ struct UIConfig {
     // JSON serialization
     void to_json(nlohmann::json& j) const;
     void from_json(const nlohmann::json& j);
+
+    bool operator==(const UIConfig&) const = default;
 };
 
 /**
@@ -98,10 +126,46 @@ struct PersistenceConfig {
     int backup_interval_hours = 24;
     int max_backup_files = 7;
 
-    // CSV export settings
+    // End-of-day export settings, run at shutdown
     std::string csv_export_path = "./data/exports/";
     bool auto_export_trades = false;
     bool auto_export_orders = false;
+    std::string export_format = "csv";         // csv, columnar
+    int export_threads = 0;                    // 0 = hardware concurrency
+
+    // Write-behind persistence: rows are committed in batches off the engine thread
+    bool async_writes = false;
+    int async_batch_size = 256;
+    int async_flush_interval_ms = 5;
+    int async_queue_capacity = 65536;
+
+    // SQLite connection tuning
+    std::string sqlite_journal_mode = "WAL";   // WAL, DELETE, TRUNCATE, PERSIST, MEMORY, OFF
+    std::string sqlite_synchronous = "NORMAL"; // OFF, NORMAL, FULL, EXTRA
+    int sqlite_mmap_size_mb = 256;
+    int sqlite_cache_size_mb = 64;
+    int sqlite_reader_connections = 2;         // Read-only query connections (WAL only); 0 = queries share the writer
+
+    // Event journal: durable append-only log, folded into SQLite by a background compactor
+    bool journal_enabled = false;
+    std::string journal_directory = "./data/journal";
+    int journal_segment_size_mb = 64;
+    bool journal_sync_on_commit = true;
+    int journal_compaction_interval_ms = 1000;
+
+    // Engine snapshots (with the journal enabled): restart = latest snapshot + journal replay
+    std::string snapshot_directory = "./data/snapshots";
+    int snapshot_interval_seconds = 300;
+    int snapshot_retain_count = 2;
+
+    // Coalesced position writes: latest state per symbol every interval (0 = write every change)
+    int position_flush_interval_ms = 0;
+
+    // Day partitions: one database file per UTC trading day instead of database_path
+    bool partition_by_day = false;
+    std::string partition_directory = "./data/partitions";
+    int partition_retention_days = 0;          // 0 = keep every partition
+    std::string partition_archive_path;        // Expired partitions move here; empty = delete them
 
     // Validation
     bool is_valid() const;
@@ -110,6 +174,8 @@ struct PersistenceConfig {
     // JSON serialization
     void to_json(nlohmann::json& j) const;
     void from_json(const nlohmann::json& j);
+
+    bool operator==(const PersistenceConfig&) const = default;
 };
 
 /**
@@ -123,6 +189,15 @@ struct LoggingConfig {
     int max_file_size_mb = 100;
     int max_log_files = 10;
 
+    // Hot-path (order/trade) logging through a background thread
+    bool async_enabled = false;
+    int async_queue_capacity = 16384;      // Records; a full ring drops rather than blocks
+
+    // Binary structured event log (orders, fills, ticks) for offline decoding
+    bool binary_event_log = false;
+    std::string event_log_directory = "./logs/events";
+    int event_log_segment_size_mb = 64;
+
     // Validation
     bool is_valid() const;
     std::string get_validation_error() const;
@@ -130,6 +205,8 @@ struct LoggingConfig {
     // JSON serialization
     void to_json(nlohmann::json& j) const;
     void from_json(const nlohmann::json& j);
+
+    bool operator==(const LoggingConfig&) const = default;
 };
 
 /**
@@ -146,6 +223,9 @@ struct TradingSystemConfig {
     std::string application_name = "C++ Trading System";
     std::string version = "1.0.0";
     bool debug_mode = false;
+    bool hot_reload = true;     // Watch the config file and apply valid edits without a restart
+    bool headless = false;      // Service mode: engine, feed, risk and persistence without the UI stack
+    int stats_interval_seconds = 60;   // Status line period in headless mode; 0 disables
 
     // Validation
     bool is_valid() const;
@@ -154,11 +234,31 @@ struct TradingSystemConfig {
     // JSON serialization
     void to_json(nlohmann::json& j) const;
     void from_json(const nlohmann::json& j);
+
+    bool operator==(const TradingSystemConfig&) const = default;
 };
 
+/**
+ * Configuration Section
+ * Unit of change notification; a reload notifies each section whose values differ
+ */
+enum class ConfigSection {
+    MARKET_DATA,
+    RISK_MANAGEMENT,
+    UI,
+    PERSISTENCE,
+    LOGGING,
+    APPLICATION
+};
+
+// Immutable published configuration; readers keep it alive for as long as they use it
+using ConfigSnapshot = std::shared_ptr<const TradingSystemConfig>;
+
 /**
  * Configuration Manager
- * Thread-safe configuration loading, saving, and management
+ * Thread-safe configuration loading, saving, and management. Every change is
+ * published as a new immutable snapshot swapped in atomically, so readers take
+ * a reference-counted pointer instead of copying the config under a lock.
  */
 class ConfigurationManager {
 public:
@@ -170,7 +270,11 @@ public:
     bool save_configuration() const;
     bool save_configuration(const std::string& file_path) const;
 
+    // Re-read the file and publish it if valid; an invalid file leaves the current config in place
+    bool reload_configuration();
+
     // Configuration access (thread-safe)
+    ConfigSnapshot get_snapshot() const;
     TradingSystemConfig get_configuration() const;
     MarketDataConfig get_market_data_config() const;
     RiskManagementConfig get_risk_management_config() const;
@@ -185,6 +289,12 @@ public:
     bool update_persistence_config(const PersistenceConfig& config);
     bool update_logging_config(const LoggingConfig& config);
 
+    // Change notification: callback(previous, current) runs after each published change that touches
+    // the section, on the publishing thread. Callbacks must not subscribe or change the configuration.
+    using ChangeCallback = std::function<void(const TradingSystemConfig& previous, const TradingSystemConfig& current)>;
+    size_t subscribe(ConfigSection section, ChangeCallback callback);
+    void unsubscribe(size_t subscription_id);
+
     // Utility methods
     bool validate_configuration() const;
     std::string get_validation_errors() const;
@@ -209,13 +319,25 @@ public:
 private:
     std::string config_file_path_;
     mutable std::mutex config_mutex_;
-    TradingSystemConfig current_config_;
+    TradingSystemConfig current_config_;       // Writers' working copy, guarded by config_mutex_
+    std::atomic<ConfigSnapshot> snapshot_;
     bool is_loaded_;
 
+    struct Subscription {
+        size_t id;
+        ConfigSection section;
+        ChangeCallback callback;
+    };
+    std::mutex subscribers_mutex_;              // Also serialises notifications so they arrive in publish order
+    std::vector<Subscription> subscribers_;
+    size_t next_subscription_id_;
+
     // Helper methods
     bool validate_file_path(const std::string& path) const;
     bool ensure_directory_exists(const std::string& path) const;
-    void apply_environment_overrides();
+    void apply_environment_overrides(TradingSystemConfig& config) const;
+    bool read_config_file(TradingSystemConfig& config) const;
+    void publish(std::unique_lock<std::mutex>& lock);   // Releases lock before notifying
 
     // JSON helpers
     nlohmann::json config_to_json(const TradingSystemConfig& config) const;
@@ -232,6 +354,7 @@ class GlobalConfig {
 public:
     static ConfigurationManager& instance();
     static TradingSystemConfig get();
+    static ConfigSnapshot snapshot();
     static void set_config_path(const std::string& path);
 
 private:
@@ -240,12 +363,14 @@ private:
     static void initialize();
 };
 
-// Convenience macros for configuration access
-#define TRADING_CONFIG() GlobalConfig::get()
-#define MARKET_DATA_CONFIG() GlobalConfig::get().market_data
-#define RISK_CONFIG() GlobalConfig::get().risk_management
-#define UI_CONFIG() GlobalConfig::get().ui
-#define PERSISTENCE_CONFIG() GlobalConfig::get().persistence
-#define LOGGING_CONFIG() GlobalConfig::get().logging
+// Convenience macros for configuration access. Each returns a copy of its section of the current
+// snapshot, so it is safe to bind to a reference; hold GlobalConfig::snapshot() to read several
+// sections from one consistent version without copying.
+#define TRADING_CONFIG() (GlobalConfig::get())
+#define MARKET_DATA_CONFIG() (MarketDataConfig(GlobalConfig::snapshot()->market_data))
+#define RISK_CONFIG() (RiskManagementConfig(GlobalConfig::snapshot()->risk_management))
+#define UI_CONFIG() (UIConfig(GlobalConfig::snapshot()->ui))
+#define PERSISTENCE_CONFIG() (PersistenceConfig(GlobalConfig::snapshot()->persistence))
+#define LOGGING_CONFIG() (LoggingConfig(GlobalConfig::snapshot()->logging))
 
 } // namespace trading
\ No newline at end of file
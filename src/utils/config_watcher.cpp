@@ -0,0 +1,163 @@
+#include "config_watcher.hpp"
+#include "logging.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace trading {
+
+namespace {
+
+// Bounds how long stop() waits for the watch thread
+constexpr std::chrono::milliseconds WAKE_INTERVAL{100};
+
+} // namespace
+
+ConfigWatcher::ConfigWatcher(std::shared_ptr<ConfigurationManager> manager)
+    : ConfigWatcher(std::move(manager), Config{}) {
+}
+
+ConfigWatcher::ConfigWatcher(std::shared_ptr<ConfigurationManager> manager, const Config& config)
+    : manager_(std::move(manager))
+    , config_(config)
+    , running_(false)
+    , inotify_fd_(-1)
+    , reloads_applied_(0)
+    , reloads_rejected_(0) {
+}
+
+ConfigWatcher::~ConfigWatcher() {
+    stop();
+}
+
+bool ConfigWatcher::start() {
+    if (running_.load() || !manager_) {
+        return running_.load();
+    }
+
+#ifdef __linux__
+    std::filesystem::path path(manager_->get_config_file_path());
+    std::string directory = path.has_parent_path() ? path.parent_path().string() : ".";
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd_ >= 0 && inotify_add_watch(inotify_fd_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        ::close(inotify_fd_);
+        inotify_fd_ = -1;
+    }
+    if (inotify_fd_ < 0) {
+        Logger::warn("ConfigWatcher: inotify unavailable for " + directory + ", polling instead");
+    }
+#endif
+
+    running_.store(true);
+    watch_thread_ = std::thread([this]() {
+        if (inotify_fd_ >= 0) {
+            watch_inotify();
+        } else {
+            watch_polling();
+        }
+    });
+    Logger::info("ConfigWatcher: Watching " + manager_->get_config_file_path());
+    return true;
+}
+
+void ConfigWatcher::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    if (watch_thread_.joinable()) {
+        watch_thread_.join();
+    }
+#ifdef __linux__
+    if (inotify_fd_ >= 0) {
+        ::close(inotify_fd_);
+        inotify_fd_ = -1;
+    }
+#endif
+}
+
+ConfigWatcher::Statistics ConfigWatcher::get_statistics() const {
+    Statistics stats;
+    stats.reloads_applied = reloads_applied_.load();
+    stats.reloads_rejected = reloads_rejected_.load();
+    return stats;
+}
+
+void ConfigWatcher::watch_inotify() {
+#ifdef __linux__
+    const std::string file_name = std::filesystem::path(manager_->get_config_file_path()).filename().string();
+    alignas(inotify_event) char buffer[4096];
+
+    // True if any queued event names the config file
+    auto drain_events = [&]() {
+        bool matched = false;
+        ssize_t length;
+        while ((length = ::read(inotify_fd_, buffer, sizeof(buffer))) > 0) {
+            for (char* p = buffer; p < buffer + length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(p);
+                if (event->len > 0 && file_name == event->name) {
+                    matched = true;
+                }
+                p += sizeof(inotify_event) + event->len;
+            }
+        }
+        return matched;
+    };
+
+    pollfd descriptor{inotify_fd_, POLLIN, 0};
+    while (running_.load()) {
+        if (::poll(&descriptor, 1, static_cast<int>(WAKE_INTERVAL.count())) <= 0 || !drain_events()) {
+            continue;
+        }
+
+        // Coalesce the burst of events one save produces
+        auto settle_until = std::chrono::steady_clock::now() + config_.settle_delay;
+        while (running_.load() && std::chrono::steady_clock::now() < settle_until) {
+            std::this_thread::sleep_for(std::min(WAKE_INTERVAL, config_.settle_delay));
+            drain_events();
+        }
+        if (running_.load()) {
+            reload();
+        }
+    }
+#endif
+}
+
+void ConfigWatcher::watch_polling() {
+    const std::filesystem::path path(manager_->get_config_file_path());
+    std::error_code ec;
+    auto last_write = std::filesystem::last_write_time(path, ec);
+
+    auto next_check = std::chrono::steady_clock::now() + config_.poll_interval;
+    while (running_.load()) {
+        std::this_thread::sleep_for(WAKE_INTERVAL);
+        if (std::chrono::steady_clock::now() < next_check) {
+            continue;
+        }
+        next_check = std::chrono::steady_clock::now() + config_.poll_interval;
+
+        auto write_time = std::filesystem::last_write_time(path, ec);
+        if (ec || write_time == last_write) {
+            continue;
+        }
+        last_write = write_time;
+        std::this_thread::sleep_for(config_.settle_delay);
+        reload();
+    }
+}
+
+void ConfigWatcher::reload() {
+    if (manager_->reload_configuration()) {
+        reloads_applied_.fetch_add(1);
+    } else {
+        reloads_rejected_.fetch_add(1);
+    }
+}
+
+} // namespace trading
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "config.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace trading {
+
+/**
+ * Config Watcher
+ * Reloads the configuration file when it changes on disk. On Linux it waits on
+ * inotify events for the file's directory (editors often save by renaming a
+ * temporary file over the original); elsewhere it polls the modification time.
+ * Each change is left to settle briefly, then handed to
+ * ConfigurationManager::reload_configuration(), which validates it and notifies
+ * the affected sections' subscribers.
+ */
+class ConfigWatcher {
+public:
+    struct Config {
+        std::chrono::milliseconds settle_delay{200};     // Wait for an editor to finish writing
+        std::chrono::milliseconds poll_interval{1000};   // Modification-time polling without inotify
+    };
+
+    struct Statistics {
+        uint64_t reloads_applied = 0;
+        uint64_t reloads_rejected = 0;    // Unreadable or invalid edits; the previous config stays live
+    };
+
+    explicit ConfigWatcher(std::shared_ptr<ConfigurationManager> manager);
+    ConfigWatcher(std::shared_ptr<ConfigurationManager> manager, const Config& config);
+    ~ConfigWatcher();
+
+    // Non-copyable
+    ConfigWatcher(const ConfigWatcher&) = delete;
+    ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+    bool start();
+    void stop();
+    bool is_running() const { return running_.load(); }
+
+    Statistics get_statistics() const;
+
+private:
+    std::shared_ptr<ConfigurationManager> manager_;
+    Config config_;
+    std::thread watch_thread_;
+    std::atomic<bool> running_;
+    int inotify_fd_;
+
+    std::atomic<uint64_t> reloads_applied_;
+    std::atomic<uint64_t> reloads_rejected_;
+
+    void watch_inotify();
+    void watch_polling();
+    void reload();
+};
+
+} // namespace trading
@@ -130,6 +130,18 @@ void Logger::critical(const std::string& message) {
     if (file_logger_) file_logger_->critical(message);
 }
 
+bool Logger::should_log(Level level) {
+    auto spdlog_level = to_spdlog_level(level);
+    return (console_logger_ && console_logger_->should_log(spdlog_level)) ||
+           (file_logger_ && file_logger_->should_log(spdlog_level));
+}
+
+void Logger::log(Level level, std::chrono::system_clock::time_point time, const std::string& message) {
+    auto spdlog_level = to_spdlog_level(level);
+    if (console_logger_) console_logger_->log(time, spdlog::source_loc{}, spdlog_level, message);
+    if (file_logger_) file_logger_->log(time, spdlog::source_loc{}, spdlog_level, message);
+}
+
 void Logger::log_order(const std::string& order_id, const std::string& action, const std::string& details) {
     if (order_logger_) {
         order_logger_->info("ORDER_ID={} ACTION={} DETAILS={}", order_id, action, details);
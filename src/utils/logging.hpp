@@ -4,6 +4,7 @@
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/fmt/fmt.h>
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -44,6 +45,11 @@ public:
     static void error(const std::string& message);
     static void critical(const std::string& message);
 
+    // Whether a message at level would reach any sink
+    static bool should_log(Level level);
+    // Log a message formatted elsewhere, stamped with the time it was produced
+    static void log(Level level, std::chrono::system_clock::time_point time, const std::string& message);
+
     // Specialized logging for trading activities
     static void log_order(const std::string& order_id, const std::string& action, const std::string& details);
     static void log_trade(const std::string& trade_id, const std::string& order_id, const std::string& details);
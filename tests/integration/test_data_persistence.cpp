@@ -1,11 +1,14 @@
 #include <gtest/gtest.h>
+#include <atomic>
 #include <memory>
 #include <thread>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <vector>
 
 #include "infrastructure/persistence/sqlite_service.hpp"
+#include "infrastructure/persistence/partition_manager.hpp"
 #include "core/models/order.hpp"
 #include "core/models/trade.hpp"
 #include "core/models/position.hpp"
@@ -419,3 +422,308 @@ TEST_F(DataPersistenceTest, TransactionIntegrity) {
     EXPECT_TRUE(found_matching_trade);
 }
 
+
+TEST_F(DataPersistenceTest, StreamingScanPagesAndResumes) {
+    auto base_time = std::chrono::system_clock::now() - std::chrono::hours(1);
+    for (int i = 0; i < 25; ++i) {
+        // Pairs of trades share a timestamp so the id breaks ties
+        Trade trade("SCAN_" + std::to_string(100 + i), "ORDER_SCAN", i % 5 == 0 ? "MSFT" : "AAPL",
+                    OrderSide::BUY, 10.0, 100.0 + i, TradeType::FULL_FILL, base_time + std::chrono::seconds(i / 2));
+        ASSERT_TRUE(persistence_->save_trade(trade));
+    }
+
+    HistoryQuery query;
+    query.page_size = 4;
+    query.max_rows = 10;
+    query.columns = {"price"};
+
+    std::vector<TradeRow> first_pass;
+    auto first = persistence_->scan_trades(query, [&](const TradeRow& row) {
+        first_pass.push_back(row);
+        return true;
+    });
+    ASSERT_TRUE(first.ok);
+    EXPECT_EQ(first.rows, 10u);
+    EXPECT_FALSE(first.complete);
+    EXPECT_EQ(first_pass.front().trade_id, "SCAN_100");
+    EXPECT_DOUBLE_EQ(first_pass.back().price, 109.0);
+    EXPECT_TRUE(first_pass.front().instrument_symbol.empty());   // Not projected
+
+    // Resume from the serialised token and read the rest
+    auto token = ResumeToken::parse(first.next.to_string());
+    ASSERT_TRUE(token.has_value());
+    query.resume_after = *token;
+    query.max_rows = 0;
+    std::vector<std::string> rest;
+    auto second = persistence_->scan_trades(query, [&](const TradeRow& row) {
+        rest.push_back(row.trade_id);
+        return true;
+    });
+    ASSERT_TRUE(second.ok);
+    EXPECT_TRUE(second.complete);
+    ASSERT_EQ(rest.size(), 15u);
+    EXPECT_EQ(rest.front(), "SCAN_110");
+    EXPECT_EQ(rest.back(), "SCAN_124");
+}
+
+TEST_F(DataPersistenceTest, StreamingScanFiltersAndStopsEarly) {
+    auto base_time = std::chrono::system_clock::now() - std::chrono::hours(1);
+    for (int i = 0; i < 10; ++i) {
+        Trade trade("FILTER_" + std::to_string(i), "ORDER_SCAN", i % 2 == 0 ? "MSFT" : "AAPL",
+                    OrderSide::SELL, 1.0, 50.0, TradeType::FULL_FILL, base_time + std::chrono::seconds(i));
+        ASSERT_TRUE(persistence_->save_trade(trade));
+    }
+
+    HistoryQuery query;
+    query.instrument_symbol = "MSFT";
+    query.from = base_time + std::chrono::seconds(2);
+    size_t visited = 0;
+    auto result = persistence_->scan_trades(query, [&](const TradeRow& row) {
+        EXPECT_EQ(row.instrument_symbol, "MSFT");
+        return ++visited < 2;
+    });
+    EXPECT_TRUE(result.ok);
+    EXPECT_EQ(result.rows, 2u);
+    EXPECT_FALSE(result.complete);
+    EXPECT_EQ(result.next.id, "FILTER_4");
+
+    query.columns = {"no_such_column"};
+    EXPECT_FALSE(persistence_->scan_trades(query, [](const TradeRow&) { return true; }).ok);
+}
+
+TEST_F(DataPersistenceTest, DayPartitionsRollOverAndAttachHistory) {
+    auto partition_directory = std::filesystem::temp_directory_path() / "test_partitions";
+    std::filesystem::remove_all(partition_directory);
+
+    const std::int64_t first_day = DayPartitionManager::day_of(std::chrono::system_clock::now()) - 10;
+    auto now = std::make_shared<std::chrono::system_clock::time_point>(
+        std::chrono::sys_days(std::chrono::days(first_day)) + std::chrono::hours(9));
+
+    DayPartitionManager::Config partition_config;
+    partition_config.directory = partition_directory.string();
+    {
+        DayPartitionManager partitions(persistence_, partition_config, [now] { return *now; });
+        ASSERT_TRUE(partitions.open());
+        EXPECT_EQ(partitions.hot_day(), first_day);
+        EXPECT_EQ(persistence_->get_database_path(), partitions.partition_path(first_day));
+
+        Trade first("PART_1", "ORDER_P1", "AAPL", OrderSide::BUY, 10.0, 150.0, TradeType::FULL_FILL, *now);
+        ASSERT_TRUE(persistence_->save_trade(first));
+        ASSERT_TRUE(persistence_->update_position(*test_position_));
+
+        // Next session: a new hot file with positions carried across
+        *now += std::chrono::hours(24);
+        ASSERT_TRUE(partitions.roll_if_needed());
+        EXPECT_EQ(partitions.hot_day(), first_day + 1);
+        EXPECT_EQ(persistence_->get_trade_count(), 0u);
+        ASSERT_EQ(persistence_->load_all_positions().size(), 1u);
+
+        Trade second("PART_2", "ORDER_P2", "AAPL", OrderSide::SELL, 5.0, 151.0, TradeType::FULL_FILL, *now);
+        ASSERT_TRUE(persistence_->save_trade(second));
+
+        // A range spanning both days reads yesterday's file through a read-only attach
+        HistoryQuery query;
+        query.from = std::chrono::sys_days(std::chrono::days(first_day));
+        std::vector<std::string> ids;
+        auto result = partitions.scan_trades(query, [&ids](const TradeRow& row) {
+            ids.push_back(row.trade_id);
+            return true;
+        });
+        ASSERT_TRUE(result.ok);
+        EXPECT_TRUE(result.complete);
+        EXPECT_EQ(ids, (std::vector<std::string>{"PART_1", "PART_2"}));
+
+        auto history = partitions.load_trades_by_date(*now - std::chrono::hours(24));
+        ASSERT_EQ(history.size(), 1u);
+        EXPECT_EQ(history[0]->get_trade_id(), "PART_1");
+
+        auto stats = partitions.get_statistics();
+        EXPECT_EQ(stats.rollovers, 1u);
+        EXPECT_EQ(stats.partitions_attached, 1u);
+    }
+
+    persistence_->close();
+    std::filesystem::remove_all(partition_directory);
+}
+
+TEST_F(DataPersistenceTest, DayPartitionScanDeliversCarriedOrdersOnceWithNewestState) {
+    auto partition_directory = std::filesystem::temp_directory_path() / "test_partitions_orders";
+    std::filesystem::remove_all(partition_directory);
+
+    const std::int64_t first_day = DayPartitionManager::day_of(std::chrono::system_clock::now()) - 10;
+    auto now = std::make_shared<std::chrono::system_clock::time_point>(
+        std::chrono::sys_days(std::chrono::days(first_day)) + std::chrono::hours(9));
+
+    DayPartitionManager::Config partition_config;
+    partition_config.directory = partition_directory.string();
+    {
+        DayPartitionManager partitions(persistence_, partition_config, [now] { return *now; });
+        ASSERT_TRUE(partitions.open());
+
+        // Two orders created on the first day; the earlier one is filled in the next session
+        Order carried("ORDER_C1", "AAPL", OrderSide::BUY, OrderType::LIMIT, 10.0, 150.0, *now);
+        carried.accept();
+        Order closed("ORDER_C2", "AAPL", OrderSide::SELL, OrderType::LIMIT, 5.0, 151.0, *now + std::chrono::hours(1));
+        closed.accept();
+        closed.fill(5.0, 151.0);
+        ASSERT_TRUE(persistence_->save_order(carried));
+        ASSERT_TRUE(persistence_->save_order(closed));
+
+        *now += std::chrono::hours(24);
+        ASSERT_TRUE(partitions.roll_if_needed());
+        carried.fill(10.0, 150.0);
+        ASSERT_TRUE(persistence_->save_order(carried));
+        Order fresh("ORDER_C3", "AAPL", OrderSide::BUY, OrderType::LIMIT, 1.0, 149.0, *now);
+        fresh.accept();
+        ASSERT_TRUE(persistence_->save_order(fresh));
+
+        HistoryQuery query;
+        query.from = std::chrono::sys_days(std::chrono::days(first_day));
+        std::vector<std::string> ids;
+        std::vector<int> statuses;
+        auto result = partitions.scan_orders(query, [&](const OrderRow& row) {
+            ids.push_back(row.order_id);
+            statuses.push_back(row.status);
+            return true;
+        });
+        ASSERT_TRUE(result.ok);
+        EXPECT_TRUE(result.complete);
+        EXPECT_EQ(ids, (std::vector<std::string>{"ORDER_C1", "ORDER_C2", "ORDER_C3"}));
+        EXPECT_EQ(statuses.front(), static_cast<int>(OrderStatus::FILLED));
+
+        // Paging one row at a time resumes across partitions without repeats or gaps
+        std::vector<std::string> paged;
+        query.max_rows = 1;
+        for (int page = 0; page < 5 && !result.next.empty(); ++page) {
+            query.resume_after = page == 0 ? ResumeToken{} : result.next;
+            result = partitions.scan_orders(query, [&paged](const OrderRow& row) {
+                paged.push_back(row.order_id);
+                return true;
+            });
+            ASSERT_TRUE(result.ok);
+            if (result.complete) {
+                break;
+            }
+        }
+        EXPECT_EQ(paged, ids);
+
+        // A single earlier day still reports the order's latest state
+        auto history = partitions.load_orders_by_date(*now - std::chrono::hours(24));
+        ASSERT_EQ(history.size(), 2u);
+        EXPECT_EQ(history[1]->get_order_id(), "ORDER_C1");
+        EXPECT_EQ(history[1]->get_status(), OrderStatus::FILLED);
+    }
+
+    persistence_->close();
+    std::filesystem::remove_all(partition_directory);
+}
+
+TEST_F(DataPersistenceTest, DayPartitionRetentionArchives) {
+    auto partition_directory = std::filesystem::temp_directory_path() / "test_partitions_retention";
+    auto archive_directory = std::filesystem::temp_directory_path() / "test_partitions_archive";
+    std::filesystem::remove_all(partition_directory);
+    std::filesystem::remove_all(archive_directory);
+
+    const std::int64_t first_day = DayPartitionManager::day_of(std::chrono::system_clock::now()) - 10;
+    auto now = std::make_shared<std::chrono::system_clock::time_point>(
+        std::chrono::sys_days(std::chrono::days(first_day)) + std::chrono::hours(12));
+
+    DayPartitionManager::Config partition_config;
+    partition_config.directory = partition_directory.string();
+    partition_config.retention_days = 2;
+    partition_config.archive_directory = archive_directory.string();
+    {
+        DayPartitionManager partitions(persistence_, partition_config, [now] { return *now; });
+        ASSERT_TRUE(partitions.open());
+        for (int day = 1; day <= 3; ++day) {
+            *now += std::chrono::hours(24);
+            ASSERT_TRUE(partitions.roll_if_needed());
+        }
+
+        EXPECT_EQ(partitions.list_partitions(), (std::vector<std::int64_t>{first_day + 2, first_day + 3}));
+        EXPECT_TRUE(std::filesystem::exists(archive_directory / DayPartitionManager::partition_file_name(first_day)));
+        EXPECT_TRUE(std::filesystem::exists(archive_directory / DayPartitionManager::partition_file_name(first_day + 1)));
+        EXPECT_EQ(partitions.get_statistics().partitions_archived, 2u);
+    }
+
+    persistence_->close();
+    std::filesystem::remove_all(partition_directory);
+    std::filesystem::remove_all(archive_directory);
+}
+
+TEST_F(DataPersistenceTest, ReaderConnectionsAndCachedCounts) {
+    auto base_time = std::chrono::system_clock::now() - std::chrono::minutes(10);
+    for (int i = 0; i < 3; ++i) {
+        Trade trade("READ_" + std::to_string(i), "ORDER_READ", "AAPL", OrderSide::BUY, 10.0, 100.0 + i,
+                    TradeType::FULL_FILL, base_time + std::chrono::seconds(i));
+        ASSERT_TRUE(persistence_->save_trade(trade));
+    }
+
+    // Re-saving an existing trade updates it without counting it again
+    Trade updated("READ_1", "ORDER_READ", "AAPL", OrderSide::BUY, 20.0, 101.0, TradeType::FULL_FILL,
+                  base_time + std::chrono::seconds(1));
+    ASSERT_TRUE(persistence_->save_trade(updated));
+    EXPECT_EQ(persistence_->get_trade_count(), 3u);
+
+    PersistenceBatch batch;
+    batch.trades.push_back(SQLiteService::trade_to_row(updated));
+    batch.trades.push_back(SQLiteService::trade_to_row(
+        Trade("READ_3", "ORDER_READ", "MSFT", OrderSide::SELL, 5.0, 300.0, TradeType::FULL_FILL, base_time)));
+    batch.positions.push_back(SQLiteService::position_to_row(*test_position_));
+    ASSERT_TRUE(persistence_->save_batch(batch));
+    EXPECT_EQ(persistence_->get_trade_count(), 4u);
+    EXPECT_EQ(persistence_->get_position_count(), 1u);
+
+    // Queries are served newest first from the reader connections and see committed writes
+    auto trades = persistence_->load_trades_by_symbol("AAPL");
+    ASSERT_EQ(trades.size(), 3u);
+    EXPECT_EQ(trades[0]->get_trade_id(), "READ_2");
+    EXPECT_EQ(trades[2]->get_trade_id(), "READ_0");
+    EXPECT_DOUBLE_EQ(trades[1]->get_quantity(), 20.0);
+
+    auto position = persistence_->load_position_by_symbol("AAPL");
+    ASSERT_NE(position, nullptr);
+    EXPECT_DOUBLE_EQ(position->get_quantity(), 100.0);
+
+    // Counts are recomputed when the file is reopened
+    persistence_->close();
+    persistence_ = std::make_shared<SQLiteService>(test_db_path_.string());
+    ASSERT_TRUE(persistence_->initialize());
+    EXPECT_EQ(persistence_->get_trade_count(), 4u);
+    EXPECT_EQ(persistence_->load_trades_by_date(base_time).size(), 4u);
+}
+
+TEST_F(DataPersistenceTest, ReaderQueriesSurviveConcurrentReopen) {
+    auto base_time = std::chrono::system_clock::now() - std::chrono::minutes(10);
+    for (int i = 0; i < 3; ++i) {
+        Trade trade("REOPEN_" + std::to_string(i), "ORDER_REOPEN", "AAPL", OrderSide::BUY, 10.0, 100.0 + i,
+                    TradeType::FULL_FILL, base_time + std::chrono::seconds(i));
+        ASSERT_TRUE(persistence_->save_trade(trade));
+    }
+
+    // More query threads than reader connections, so some wait in the pool while it is closed
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> queries{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&]() {
+            while (!stop.load()) {
+                auto trades = persistence_->load_trades_by_symbol("AAPL");
+                EXPECT_TRUE(trades.empty() || trades.size() == 3u);
+                queries.fetch_add(1);
+            }
+        });
+    }
+
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_TRUE(persistence_->reopen(test_db_path_.string(), false));
+        std::this_thread::yield();
+    }
+    stop.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_GT(queries.load(), 0u);
+    EXPECT_EQ(persistence_->load_trades_by_symbol("AAPL").size(), 3u);
+}
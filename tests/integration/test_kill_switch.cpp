@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+
+#include "core/risk/risk_manager.hpp"
+#include "core/risk/kill_switch.hpp"
+#include "core/engine/trading_engine.hpp"
+#include "core/models/market_tick.hpp"
+#include "utils/config.hpp"
+
+using namespace trading;
+
+class KillSwitchTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        config_.max_position_size = 10000.0;
+        config_.max_order_size = 1000.0;
+        config_.max_daily_loss = 50000.0;
+    }
+
+    void TearDown() override {
+        if (trading_engine_) {
+            trading_engine_->shutdown();
+        }
+    }
+
+    void start_engine() {
+        risk_manager_ = std::make_shared<RiskManager>(config_);
+        trading_engine_ = std::make_shared<TradingEngine>(risk_manager_);
+        ASSERT_TRUE(trading_engine_->initialize());
+    }
+
+    static OrderRequest create_order_request(OrderType type, double quantity, double price = 0.0) {
+        OrderRequest request;
+        request.instrument_symbol = "AAPL";
+        request.side = OrderSide::BUY;
+        request.type = type;
+        request.quantity = quantity;
+        request.price = price;
+        request.timestamp = std::chrono::system_clock::now();
+        return request;
+    }
+
+    RiskManagementConfig config_;
+    std::shared_ptr<RiskManager> risk_manager_;
+    std::shared_ptr<TradingEngine> trading_engine_;
+};
+
+TEST_F(KillSwitchTest, EngageAdvancesEpochAndNotifiesOnce) {
+    KillSwitch kill_switch;
+    std::atomic<int> trips(0);
+    size_t callback_id = kill_switch.add_trip_callback([&](const std::string&) { trips.fetch_add(1); });
+
+    uint64_t epoch = kill_switch.get_epoch();
+    EXPECT_TRUE(kill_switch.engage("Manual halt"));
+    EXPECT_FALSE(kill_switch.engage("Second halt"));
+
+    EXPECT_TRUE(kill_switch.is_engaged());
+    EXPECT_EQ(kill_switch.get_epoch(), epoch + 1);
+    EXPECT_EQ(kill_switch.get_reason(), "Manual halt");
+    EXPECT_EQ(trips.load(), 1);
+
+    // The state word changes on every trip, even once the switch has been reset again
+    uint64_t tripped = kill_switch.get_state();
+    EXPECT_TRUE(KillSwitch::is_engaged(tripped));
+    EXPECT_EQ(KillSwitch::epoch_of(tripped), epoch + 1);
+
+    kill_switch.reset();
+    kill_switch.remove_trip_callback(callback_id);
+    EXPECT_FALSE(kill_switch.is_engaged());
+    EXPECT_FALSE(KillSwitch::is_engaged(kill_switch.get_state()));
+    EXPECT_EQ(kill_switch.get_epoch(), epoch + 1);
+    EXPECT_TRUE(kill_switch.engage("After removal"));
+    EXPECT_EQ(trips.load(), 1);
+}
+
+TEST_F(KillSwitchTest, EngagedSwitchRejectsNewOrders) {
+    start_engine();
+    risk_manager_->set_trading_enabled(false);
+
+    std::string order_id = trading_engine_->submit_order(create_order_request(OrderType::MARKET, 100.0));
+    auto order = trading_engine_->get_order(order_id);
+
+    ASSERT_NE(order, nullptr);
+    EXPECT_EQ(order->get_status(), OrderStatus::REJECTED);
+    EXPECT_FALSE(risk_manager_->validate_order(create_order_request(OrderType::MARKET, 100.0)));
+    EXPECT_NE(risk_manager_->get_rejection_reason(create_order_request(OrderType::MARKET, 100.0)).find("Kill switch"),
+              std::string::npos);
+
+    risk_manager_->set_trading_enabled(true);
+    EXPECT_TRUE(risk_manager_->validate_order(create_order_request(OrderType::MARKET, 100.0)));
+}
+
+TEST_F(KillSwitchTest, TripCancelsWorkingOrders) {
+    start_engine();
+
+    std::mutex mutex;
+    std::condition_variable canceled_cv;
+    bool canceled = false;
+    trading_engine_->set_order_update_callback([&](const ExecutionReport& report) {
+        if (report.new_status == OrderStatus::CANCELED) {
+            std::lock_guard<std::mutex> lock(mutex);
+            canceled = true;
+            canceled_cv.notify_all();
+        }
+    });
+
+    // Far below the simulated market, so the limit order stays working
+    std::string order_id = trading_engine_->submit_order(create_order_request(OrderType::LIMIT, 100.0, 1.0));
+    ASSERT_EQ(trading_engine_->get_working_orders().size(), 1u);
+
+    // The mass cancel runs on the processing thread; wait for its report rather than a fixed time
+    risk_manager_->get_kill_switch().engage("Test halt");
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(canceled_cv.wait_for(lock, std::chrono::seconds(5), [&] { return canceled; }));
+    }
+
+    auto order = trading_engine_->get_order(order_id);
+    ASSERT_NE(order, nullptr);
+    EXPECT_EQ(order->get_status(), OrderStatus::CANCELED);
+    EXPECT_TRUE(trading_engine_->get_working_orders().empty());
+    EXPECT_TRUE(risk_manager_->get_all_working_orders().empty());
+    trading_engine_->set_order_update_callback(nullptr);
+}
+
+TEST_F(KillSwitchTest, OrderRateBreachTripsSwitch) {
+    config_.circuit_breaker_max_orders_per_second = 5;
+    start_engine();
+
+    for (int i = 0; i < 10; ++i) {
+        trading_engine_->submit_order(create_order_request(OrderType::LIMIT, 10.0, 1.0));
+    }
+
+    EXPECT_TRUE(risk_manager_->get_kill_switch().is_engaged());
+    EXPECT_NE(risk_manager_->get_kill_switch().get_reason().find("Order rate"), std::string::npos);
+}
+
+TEST_F(KillSwitchTest, RejectRateBreachTripsSwitch) {
+    config_.circuit_breaker_max_reject_rate = 0.5;
+    config_.circuit_breaker_min_orders = 4;
+    start_engine();
+
+    for (int i = 0; i < 4; ++i) {
+        trading_engine_->submit_order(create_order_request(OrderType::MARKET, 5000.0)); // Exceeds order size
+    }
+
+    EXPECT_TRUE(risk_manager_->get_kill_switch().is_engaged());
+    EXPECT_NE(risk_manager_->get_kill_switch().get_reason().find("Reject rate"), std::string::npos);
+}
+
+TEST_F(KillSwitchTest, LossBreachTripsSwitch) {
+    config_.circuit_breaker_max_loss = 1000.0;
+    start_engine();
+
+    risk_manager_->update_daily_pnl(-500.0, 0.0);
+    EXPECT_FALSE(risk_manager_->get_kill_switch().is_engaged());
+
+    risk_manager_->update_daily_pnl(-800.0, -300.0);
+    EXPECT_TRUE(risk_manager_->get_kill_switch().is_engaged());
+}
+
+TEST_F(KillSwitchTest, StaleFeedTripsSwitch) {
+    config_.circuit_breaker_max_feed_staleness_ms = 50;
+    start_engine();
+
+    std::promise<std::string> tripped;
+    auto trip_reason = tripped.get_future();
+    KillSwitch& kill_switch = risk_manager_->get_kill_switch();
+    size_t callback_id = kill_switch.add_trip_callback([&tripped](const std::string& reason) {
+        tripped.set_value(reason);
+    });
+
+    risk_manager_->on_market_data(MarketTick("AAPL", 99.9, 100.1, 100.0, 1000.0));
+    EXPECT_FALSE(kill_switch.is_engaged());
+
+    // The engine's processing loop checks staleness at least every 100ms; wait for the trip itself
+    ASSERT_EQ(trip_reason.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_NE(trip_reason.get().find("stale"), std::string::npos);
+    EXPECT_TRUE(kill_switch.is_engaged());
+    EXPECT_FALSE(risk_manager_->is_trading_enabled());
+    kill_switch.remove_trip_callback(callback_id);
+}
@@ -0,0 +1,459 @@
+/**
+ * Persistence Benchmarks
+ * Throughput and per-operation latency of SQLiteService writes under each
+ * durability mode (journal_mode / synchronous), single-row vs batched and
+ * synchronous vs write-behind (AsyncPersistenceWriter); then load-query latency
+ * and end-of-day export throughput on databases of each requested size.
+ *
+ * Usage: persistence_benchmarks [row_counts] [database_path] [--json results.json]
+ *   e.g. persistence_benchmarks 1000000,10000000 /tmp/persistence_bench.db --json bench.json
+ * row_counts is a comma-separated list of trade row counts (orders are half that).
+ * Not registered with CTest - run manually and compare against a baseline.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "infrastructure/persistence/sqlite_service.hpp"
+#include "infrastructure/persistence/async_persistence_writer.hpp"
+#include "infrastructure/persistence/eod_exporter.hpp"
+#include "core/models/trade.hpp"
+#include "core/models/order.hpp"
+#include "core/models/position.hpp"
+
+using namespace trading;
+using namespace std::chrono;
+
+namespace {
+
+constexpr size_t SYMBOL_COUNT = 1000;
+constexpr size_t TRADING_DAYS = 30;
+constexpr size_t WRITE_OPS = 5000;         // Per operation and durability mode
+constexpr size_t WRITE_BATCH_ROWS = 256;   // Matches AsyncPersistenceWriter's default batch
+constexpr size_t FILL_BATCH_ROWS = 10000;
+constexpr size_t QUERY_REPEATS = 5;
+constexpr size_t MIN_ROWS = 10000;
+
+struct DurabilityMode {
+    const char* journal_mode;
+    const char* synchronous;
+};
+
+// From fastest to most durable; MEMORY/OFF is the no-durability ceiling
+const DurabilityMode DURABILITY_MODES[] = {
+    {"MEMORY", "OFF"},
+    {"WAL", "NORMAL"},
+    {"WAL", "FULL"},
+    {"DELETE", "NORMAL"},
+    {"DELETE", "FULL"},
+};
+
+struct LatencyStats {
+    double p50_us = 0.0;
+    double p99_us = 0.0;
+    double p999_us = 0.0;
+    double max_us = 0.0;
+};
+
+struct Result {
+    std::string section;
+    std::string mode;
+    std::string operation;
+    size_t rows = 0;
+    double seconds = 0.0;
+    LatencyStats latency;
+};
+
+LatencyStats summarize(std::vector<int64_t>& samples) {
+    LatencyStats stats;
+    if (samples.empty()) {
+        return stats;
+    }
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](double fraction) {
+        auto index = static_cast<size_t>(fraction * static_cast<double>(samples.size() - 1));
+        return static_cast<double>(samples[index]) / 1000.0;
+    };
+    stats.p50_us = percentile(0.50);
+    stats.p99_us = percentile(0.99);
+    stats.p999_us = percentile(0.999);
+    stats.max_us = static_cast<double>(samples.back()) / 1000.0;
+    return stats;
+}
+
+std::string symbol_name(size_t index) {
+    return "SYM" + std::to_string(index % SYMBOL_COUNT);
+}
+
+// Spread rows evenly over the benchmark's trading days, ending today
+std::int64_t execution_time_for(size_t index, size_t total_rows, std::int64_t now_seconds) {
+    const std::int64_t span = static_cast<std::int64_t>(TRADING_DAYS) * 86400;
+    auto offset = static_cast<std::int64_t>(static_cast<double>(index) / static_cast<double>(total_rows) *
+                                            static_cast<double>(span));
+    return now_seconds - span + offset;
+}
+
+TradeRow make_trade_row(size_t index, size_t total_rows, std::int64_t now_seconds) {
+    TradeRow row;
+    row.trade_id = "BT" + std::to_string(index);
+    row.order_id = "BO" + std::to_string(index / 2);
+    row.instrument_symbol = symbol_name(index);
+    row.side = static_cast<int>(index % 2);
+    row.quantity = 100.0;
+    row.price = 100.0 + static_cast<double>(index % 500) * 0.01;
+    row.execution_time = execution_time_for(index, total_rows, now_seconds);
+    row.type = 0;
+    return row;
+}
+
+OrderRow make_order_row(size_t index, size_t total_rows, std::int64_t now_seconds) {
+    OrderRow row;
+    row.order_id = "BO" + std::to_string(index);
+    row.instrument_symbol = symbol_name(index);
+    row.side = static_cast<int>(index % 2);
+    row.type = 1;
+    row.quantity = 200.0;
+    row.price = 100.0;
+    row.status = 2;
+    row.filled_quantity = 200.0;
+    row.total_fill_value = 20000.0;
+    row.created_time = execution_time_for(index, total_rows, now_seconds);
+    row.last_modified = row.created_time;
+    row.rejection_reason = "";
+    return row;
+}
+
+PositionRow make_position_row(size_t index, std::int64_t now_seconds) {
+    PositionRow row;
+    row.instrument_symbol = symbol_name(index);
+    row.quantity = 100.0 + static_cast<double>(index);
+    row.average_price = 100.0;
+    row.realized_pnl = 0.0;
+    row.unrealized_pnl = static_cast<double>(index % 100);
+    row.last_updated = now_seconds;
+    return row;
+}
+
+double seconds_since(steady_clock::time_point start) {
+    return duration_cast<duration<double>>(steady_clock::now() - start).count();
+}
+
+void remove_database(const std::string& path) {
+    std::error_code ignored;
+    for (const char* suffix : {"", "-wal", "-shm", "-journal"}) {
+        std::filesystem::remove(path + suffix, ignored);
+    }
+}
+
+class Report {
+public:
+    void section(const char* title) {
+        std::printf("\n%s\n%-16s %-32s %12s %10s %14s %10s %10s %10s %10s\n", title, "mode", "operation", "rows",
+                    "seconds", "rows/s", "p50 us", "p99 us", "p999 us", "max us");
+    }
+
+    void add(Result result) {
+        double rate = result.seconds > 0.0 ? static_cast<double>(result.rows) / result.seconds : 0.0;
+        std::printf("%-16s %-32s %12zu %10.3f %14.0f %10.1f %10.1f %10.1f %10.1f\n", result.mode.c_str(),
+                    result.operation.c_str(), result.rows, result.seconds, rate, result.latency.p50_us,
+                    result.latency.p99_us, result.latency.p999_us, result.latency.max_us);
+        results_.push_back(std::move(result));
+    }
+
+    bool write_json(const std::string& path) const {
+        nlohmann::json results = nlohmann::json::array();
+        for (const auto& result : results_) {
+            results.push_back({
+                {"section", result.section},
+                {"mode", result.mode},
+                {"operation", result.operation},
+                {"rows", result.rows},
+                {"seconds", result.seconds},
+                {"rows_per_second", result.seconds > 0.0 ? static_cast<double>(result.rows) / result.seconds : 0.0},
+                {"p50_us", result.latency.p50_us},
+                {"p99_us", result.latency.p99_us},
+                {"p999_us", result.latency.p999_us},
+                {"max_us", result.latency.max_us},
+            });
+        }
+        std::ofstream file(path);
+        file << nlohmann::json{{"benchmark", "persistence"}, {"results", results}}.dump(2) << "\n";
+        return static_cast<bool>(file);
+    }
+
+private:
+    std::vector<Result> results_;
+};
+
+// Time each call of op(i) for i in [0, count)
+template<typename Op>
+Result time_ops(const char* section, const std::string& mode, const char* operation, size_t count, Op&& op) {
+    std::vector<int64_t> samples;
+    samples.reserve(count);
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        auto op_start = steady_clock::now();
+        op(i);
+        samples.push_back(duration_cast<nanoseconds>(steady_clock::now() - op_start).count());
+    }
+    Result result{section, mode, operation, count, seconds_since(start), {}};
+    result.latency = summarize(samples);
+    return result;
+}
+
+/**
+ * Write benchmarks for one durability mode on a fresh database: single-row saves
+ * (one implicit transaction each), WRITE_BATCH_ROWS-row transactions, and the
+ * write-behind path where latency is the enqueue and throughput runs to durable.
+ */
+void run_write_benchmarks(Report& report, const DurabilityMode& mode, const std::string& database_path) {
+    const std::string label = std::string(mode.journal_mode) + "/" + mode.synchronous;
+    const std::string path = database_path + ".write-" + mode.journal_mode + "-" + mode.synchronous;
+    remove_database(path);
+
+    SQLiteProfile profile;
+    profile.journal_mode = mode.journal_mode;
+    profile.synchronous = mode.synchronous;
+    auto service = std::make_shared<SQLiteService>(path, profile);
+    if (!service->initialize()) {
+        std::fprintf(stderr, "Failed to open %s\n", path.c_str());
+        return;
+    }
+
+    std::vector<std::shared_ptr<Order>> orders;
+    std::vector<std::shared_ptr<Trade>> trades;
+    std::vector<std::shared_ptr<Position>> positions;
+    orders.reserve(WRITE_OPS);
+    trades.reserve(WRITE_OPS);
+    positions.reserve(SYMBOL_COUNT);
+    for (size_t i = 0; i < WRITE_OPS; ++i) {
+        orders.push_back(std::make_shared<Order>("WO" + std::to_string(i), symbol_name(i), OrderSide::BUY,
+                                                 OrderType::LIMIT, 100.0, 100.0));
+        trades.push_back(std::make_shared<Trade>("WT" + std::to_string(i), "WO" + std::to_string(i), symbol_name(i),
+                                                 OrderSide::BUY, 100.0, 100.0));
+    }
+    for (size_t i = 0; i < SYMBOL_COUNT; ++i) {
+        positions.push_back(std::make_shared<Position>(symbol_name(i)));
+        positions.back()->add_trade(100.0, 100.0);
+    }
+
+    report.add(time_ops("write", label, "save_order (single)", WRITE_OPS,
+                        [&](size_t i) { service->save_order(*orders[i]); }));
+    report.add(time_ops("write", label, "save_trade (single)", WRITE_OPS,
+                        [&](size_t i) { service->save_trade(*trades[i]); }));
+    report.add(time_ops("write", label, "update_position (single)", WRITE_OPS,
+                        [&](size_t i) { service->update_position(*positions[i % SYMBOL_COUNT]); }));
+
+    // Batches of orders, trades and positions in equal thirds; latency is per batch
+    const auto now_seconds = duration_cast<seconds>(system_clock::now().time_since_epoch()).count();
+    const size_t batch_count = WRITE_OPS * 3 / WRITE_BATCH_ROWS;
+    std::vector<PersistenceBatch> batches(batch_count);
+    for (size_t b = 0; b < batch_count; ++b) {
+        for (size_t r = 0; r < WRITE_BATCH_ROWS / 3; ++r) {
+            size_t i = b * (WRITE_BATCH_ROWS / 3) + r;
+            batches[b].orders.push_back(make_order_row(WRITE_OPS + i, WRITE_OPS * 2, now_seconds));
+            batches[b].trades.push_back(make_trade_row(WRITE_OPS + i, WRITE_OPS * 2, now_seconds));
+            batches[b].positions.push_back(make_position_row(i, now_seconds));
+        }
+    }
+    auto batched = time_ops("write", label, "save_batch (per batch)", batch_count,
+                            [&](size_t b) { service->save_batch(batches[b]); });
+    batched.rows = batch_count * (WRITE_BATCH_ROWS / 3) * 3;
+    report.add(batched);
+
+    // Write-behind: the caller pays only the enqueue; rows/s is measured until durable
+    AsyncPersistenceWriter writer(service, AsyncPersistenceWriter::Config{});
+    writer.start();
+    std::vector<std::shared_ptr<Order>> async_orders;
+    std::vector<std::shared_ptr<Trade>> async_trades;
+    async_orders.reserve(WRITE_OPS);
+    async_trades.reserve(WRITE_OPS);
+    for (size_t i = 0; i < WRITE_OPS; ++i) {
+        async_orders.push_back(std::make_shared<Order>("AO" + std::to_string(i), symbol_name(i), OrderSide::SELL,
+                                                       OrderType::LIMIT, 100.0, 100.0));
+        async_trades.push_back(std::make_shared<Trade>("AT" + std::to_string(i), "AO" + std::to_string(i),
+                                                       symbol_name(i), OrderSide::SELL, 100.0, 100.0));
+    }
+    auto start = steady_clock::now();
+    auto enqueued = time_ops("write", label, "async enqueue (mixed)", WRITE_OPS * 3, [&](size_t i) {
+        size_t index = i / 3;
+        switch (i % 3) {
+            case 0: writer.enqueue_order(*async_orders[index]); break;
+            case 1: writer.enqueue_trade(*async_trades[index]); break;
+            default: writer.enqueue_position(*positions[index % SYMBOL_COUNT]); break;
+        }
+    });
+    writer.flush(std::chrono::milliseconds(60000));
+    enqueued.seconds = seconds_since(start);
+    report.add(enqueued);
+    writer.stop();
+
+    service->close();
+    remove_database(path);
+}
+
+/**
+ * Fill a fresh database with trade_rows trades and half as many orders, then
+ * time the load queries and an end-of-day export of the same rows.
+ */
+void run_load_benchmarks(Report& report, size_t trade_rows, const std::string& database_path) {
+    const size_t order_rows = trade_rows / 2;
+    const std::string label = std::to_string(trade_rows);
+    remove_database(database_path);
+
+    auto service = std::make_shared<SQLiteService>(database_path);
+    if (!service->initialize()) {
+        std::fprintf(stderr, "Failed to open %s\n", database_path.c_str());
+        return;
+    }
+
+    const auto now_seconds = duration_cast<seconds>(system_clock::now().time_since_epoch()).count();
+    report.section(("Load: " + label + " trades, " + std::to_string(order_rows) + " orders, " +
+                    std::to_string(SYMBOL_COUNT) + " symbols (default profile)").c_str());
+
+    PersistenceBatch batch;
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < trade_rows; ++i) {
+        batch.trades.push_back(make_trade_row(i, trade_rows, now_seconds));
+        if (batch.size() == FILL_BATCH_ROWS) {
+            service->save_batch(batch);
+            batch.clear();
+        }
+    }
+    service->save_batch(batch);
+    batch.clear();
+    report.add(Result{"load", label, "fill trades", trade_rows, seconds_since(start), {}});
+
+    start = steady_clock::now();
+    for (size_t i = 0; i < order_rows; ++i) {
+        batch.orders.push_back(make_order_row(i, order_rows, now_seconds));
+        if (batch.size() == FILL_BATCH_ROWS) {
+            service->save_batch(batch);
+            batch.clear();
+        }
+    }
+    for (size_t i = 0; i < SYMBOL_COUNT; ++i) {
+        batch.positions.push_back(make_position_row(i, now_seconds));
+    }
+    service->save_batch(batch);
+    batch.clear();
+    report.add(Result{"load", label, "fill orders", order_rows, seconds_since(start), {}});
+
+    // Each query is repeated; rows is the result size and seconds the mean of one run
+    auto query = [&](const char* operation, auto&& run) {
+        size_t rows = 0;
+        auto result = time_ops("query", label, operation, QUERY_REPEATS, [&](size_t) { rows = run(); });
+        result.rows = rows;
+        result.seconds /= static_cast<double>(QUERY_REPEATS);
+        report.add(result);
+    };
+    const auto three_days_ago = system_clock::now() - hours(24 * 3);
+    query("load_trades_by_symbol", [&] { return service->load_trades_by_symbol(symbol_name(42)).size(); });
+    query("load_orders_by_symbol", [&] { return service->load_orders_by_symbol(symbol_name(42)).size(); });
+    query("load_trades_by_date", [&] { return service->load_trades_by_date(three_days_ago).size(); });
+    query("load_orders_by_date", [&] { return service->load_orders_by_date(three_days_ago).size(); });
+    query("load_all_positions", [&] { return service->load_all_positions().size(); });
+    query("load_position_by_symbol", [&] { return service->load_position_by_symbol(symbol_name(42)) ? size_t{1} : 0; });
+    query("get_trade_count", [&] { return service->get_trade_count(); });
+
+    // Streaming scan over all trades, bounded to one page in memory
+    HistoryQuery scan_query;
+    scan_query.columns = {"price", "quantity"};
+    double scanned_notional = 0.0;
+    auto scan = time_ops("query", label, "scan_trades (price, quantity)", 1, [&](size_t) {
+        service->scan_trades(scan_query, [&scanned_notional](const TradeRow& row) {
+            scanned_notional += row.price * row.quantity;
+            return true;
+        });
+    });
+    scan.rows = trade_rows;
+    report.add(scan);
+
+    service->close();
+
+    // End-of-day export formatting of every row, one file per symbol and table
+    const std::string export_directory = database_path + ".exports";
+    for (ExportFormat format : {ExportFormat::CSV, ExportFormat::COLUMNAR}) {
+        std::vector<TradeRow> trades;
+        std::vector<OrderRow> orders;
+        trades.reserve(trade_rows);
+        orders.reserve(order_rows);
+        for (size_t i = 0; i < trade_rows; ++i) {
+            trades.push_back(make_trade_row(i, trade_rows, now_seconds));
+        }
+        for (size_t i = 0; i < order_rows; ++i) {
+            orders.push_back(make_order_row(i, order_rows, now_seconds));
+        }
+
+        EodExporter::Config export_config;
+        export_config.format = format;
+        EodExporter exporter(nullptr, export_config);
+        start = steady_clock::now();
+        auto exported = exporter.export_rows(export_directory, std::move(trades), std::move(orders));
+        report.add(Result{"export", label, format == ExportFormat::CSV ? "eod export csv" : "eod export columnar",
+                          exported.trade_rows + exported.order_rows, seconds_since(start), {}});
+        std::error_code ignored;
+        std::filesystem::remove_all(export_directory, ignored);
+    }
+
+    remove_database(database_path);
+}
+
+std::vector<size_t> parse_row_counts(const std::string& list) {
+    std::vector<size_t> counts;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        counts.push_back(std::max<size_t>(std::strtoull(item.c_str(), nullptr, 10), MIN_ROWS));
+    }
+    return counts;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> positional;
+    std::string json_path;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            json_path = argv[++i];
+        } else {
+            positional.push_back(arg);
+        }
+    }
+    const auto row_counts = parse_row_counts(positional.size() > 0 ? positional[0] : "1000000");
+    const std::string database_path = positional.size() > 1 ? positional[1] : "./data/persistence_bench.db";
+
+    std::printf("Persistence benchmarks -> %s\n", database_path.c_str());
+
+    Report report;
+    report.section(("Writes: " + std::to_string(WRITE_OPS) + " ops per case, batches of " +
+                    std::to_string(WRITE_BATCH_ROWS) + " rows").c_str());
+    for (const auto& mode : DURABILITY_MODES) {
+        run_write_benchmarks(report, mode, database_path);
+    }
+
+    for (size_t trade_rows : row_counts) {
+        run_load_benchmarks(report, trade_rows, database_path);
+    }
+
+    if (!json_path.empty()) {
+        if (!report.write_json(json_path)) {
+            std::fprintf(stderr, "Failed to write %s\n", json_path.c_str());
+            return 1;
+        }
+        std::printf("\nResults written to %s\n", json_path.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,208 @@
+/**
+ * Risk Manager Benchmarks
+ * Latency of validate_order / get_rejection_reason as the number of configured
+ * limits and tracked symbols grows, and under 1-32 concurrent submitting threads.
+ *
+ * Usage: risk_benchmarks [max_ops_per_case] [max_threads]
+ * Not registered with CTest - run manually and compare against a baseline.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <latch>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/risk/risk_manager.hpp"
+#include "core/models/order.hpp"
+#include "core/models/position.hpp"
+#include "utils/config.hpp"
+
+using namespace trading;
+using namespace std::chrono;
+
+namespace {
+
+constexpr int64_t TARGET_CASE_NS = 200000000; // Aim for ~200ms of measurement per case
+constexpr size_t MIN_OPS_PER_CASE = 1000;
+
+struct LatencyStats {
+    double ns_per_op = 0.0;
+    int64_t p50 = 0;
+    int64_t p99 = 0;
+    int64_t p999 = 0;
+};
+
+LatencyStats summarize(std::vector<int64_t>& samples, int64_t wall_ns, size_t total_ops) {
+    LatencyStats stats;
+    if (samples.empty() || total_ops == 0) {
+        return stats;
+    }
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](double fraction) {
+        auto index = static_cast<size_t>(fraction * static_cast<double>(samples.size() - 1));
+        return samples[index];
+    };
+    stats.ns_per_op = static_cast<double>(wall_ns) / static_cast<double>(total_ops);
+    stats.p50 = percentile(0.50);
+    stats.p99 = percentile(0.99);
+    stats.p999 = percentile(0.999);
+    return stats;
+}
+
+void print_header() {
+    std::printf("%-22s %8s %8s %10s %10s %10s %10s %10s\n",
+                "operation", "symbols", "threads", "ops", "ns/op", "p50", "p99", "p999");
+}
+
+void print_row(const char* operation, size_t symbols, size_t threads, size_t ops, const LatencyStats& stats) {
+    std::printf("%-22s %8zu %8zu %10zu %10.1f %10lld %10lld %10lld\n",
+                operation, symbols, threads, ops, stats.ns_per_op,
+                static_cast<long long>(stats.p50), static_cast<long long>(stats.p99),
+                static_cast<long long>(stats.p999));
+}
+
+std::string symbol_name(size_t index) {
+    return "SYM" + std::to_string(index);
+}
+
+/**
+ * Risk manager populated with one position, one working order and per-symbol
+ * position/order limits for each of symbol_count symbols.
+ */
+std::shared_ptr<RiskManager> make_risk_manager(size_t symbol_count) {
+    RiskManagementConfig config;
+    config.max_position_size = 1000000.0;
+    config.max_order_size = 10000.0;
+    config.max_daily_loss = 1000000.0;
+    for (size_t i = 0; i < symbol_count; ++i) {
+        config.symbol_position_limits[symbol_name(i)] = 500000.0;
+        config.symbol_order_limits[symbol_name(i)] = 5000.0;
+    }
+
+    auto risk_manager = std::make_shared<RiskManager>(config);
+    for (size_t i = 0; i < symbol_count; ++i) {
+        auto position = std::make_shared<Position>(symbol_name(i));
+        position->add_trade(100.0, 50.0);
+        risk_manager->update_position(position);
+
+        auto order = std::make_shared<Order>("BENCH-" + std::to_string(i), symbol_name(i),
+                                             OrderSide::BUY, OrderType::LIMIT, 10.0, 49.0);
+        order->accept();
+        risk_manager->add_working_order(order);
+    }
+    return risk_manager;
+}
+
+std::vector<OrderRequest> make_requests(size_t symbol_count) {
+    // A fixed mix of passing and rejected orders spread across the symbols
+    std::vector<OrderRequest> requests;
+    const size_t count = 4096;
+    requests.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        OrderRequest request;
+        request.instrument_symbol = symbol_name((i * 7919) % symbol_count);
+        request.side = (i % 2 == 0) ? OrderSide::BUY : OrderSide::SELL;
+        request.type = (i % 3 == 0) ? OrderType::MARKET : OrderType::LIMIT;
+        request.quantity = (i % 10 == 0) ? 20000.0 : 100.0; // Every tenth order breaches the order size limit
+        request.price = request.type == OrderType::LIMIT ? 50.0 : 0.0;
+        request.timestamp = system_clock::now();
+        requests.push_back(request);
+    }
+    return requests;
+}
+
+template<typename Op>
+size_t calibrate_ops(size_t max_ops, Op&& op) {
+    const size_t warmup = 100;
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < warmup; ++i) {
+        op(i);
+    }
+    auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+    auto per_op = std::max<int64_t>(1, elapsed / static_cast<int64_t>(warmup));
+    return std::clamp(static_cast<size_t>(TARGET_CASE_NS / per_op), MIN_OPS_PER_CASE, max_ops);
+}
+
+template<typename Op>
+void run_case(const char* name, size_t symbol_count, size_t thread_count, size_t max_ops, Op&& op) {
+    size_t ops_per_thread = calibrate_ops(max_ops, op) / thread_count;
+    ops_per_thread = std::max<size_t>(ops_per_thread, 100);
+
+    std::vector<std::vector<int64_t>> thread_samples(thread_count);
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+
+    // Every thread is spawned and ready before any of them starts timing
+    std::latch start_line(static_cast<std::ptrdiff_t>(thread_count + 1));
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            auto& samples = thread_samples[t];
+            samples.reserve(ops_per_thread);
+            start_line.arrive_and_wait();
+            for (size_t i = 0; i < ops_per_thread; ++i) {
+                auto start = steady_clock::now();
+                op(t * ops_per_thread + i);
+                samples.push_back(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+            }
+        });
+    }
+    start_line.arrive_and_wait();
+    auto wall_start = steady_clock::now();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto wall_ns = duration_cast<nanoseconds>(steady_clock::now() - wall_start).count();
+
+    std::vector<int64_t> samples;
+    samples.reserve(ops_per_thread * thread_count);
+    for (const auto& per_thread : thread_samples) {
+        samples.insert(samples.end(), per_thread.begin(), per_thread.end());
+    }
+
+    // ns/op is wall time per operation across all threads, i.e. inverse throughput
+    size_t total_ops = ops_per_thread * thread_count;
+    print_row(name, symbol_count, thread_count, total_ops, summarize(samples, wall_ns, total_ops));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t max_ops = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 32;
+    max_ops = std::max(max_ops, MIN_OPS_PER_CASE);
+    max_threads = std::max<size_t>(max_threads, 1);
+
+    // The logger is left uninitialized so rejections cost message formatting but no sink I/O
+
+    const std::vector<size_t> symbol_counts = {1, 10, 1000, 10000};
+    const std::vector<size_t> thread_counts = {1, 2, 4, 8, 16, 32};
+
+    std::printf("Risk manager benchmarks (latencies in ns)\n\n");
+    print_header();
+
+    for (size_t symbol_count : symbol_counts) {
+        auto risk_manager = make_risk_manager(symbol_count);
+        const auto requests = make_requests(symbol_count);
+        auto request_at = [&requests](size_t i) -> const OrderRequest& { return requests[i % requests.size()]; };
+
+        run_case("validate_order", symbol_count, 1, max_ops,
+                 [&](size_t i) { static_cast<void>(risk_manager->validate_order(request_at(i))); });
+        run_case("get_rejection_reason", symbol_count, 1, max_ops,
+                 [&](size_t i) { static_cast<void>(risk_manager->get_rejection_reason(request_at(i))); });
+
+        for (size_t thread_count : thread_counts) {
+            if (thread_count < 2 || thread_count > max_threads) {
+                continue;
+            }
+            run_case("validate_order", symbol_count, thread_count, max_ops,
+                     [&](size_t i) { static_cast<void>(risk_manager->validate_order(request_at(i))); });
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <chrono>
+#include <vector>
+#include <iostream>
+
+#include "core/risk/risk_manager.hpp"
+#include "core/risk/static_risk_validator.hpp"
+#include "core/models/position.hpp"
+#include "utils/config.hpp"
+
+using namespace trading;
+using namespace std::chrono;
+
+class RiskValidatorChainTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        RiskManagementConfig config;
+        config.max_position_size = 1000.0;
+        config.max_order_size = 500.0;
+        config.max_daily_loss = 5000.0;
+        config.enable_risk_checks = true;
+        risk_manager_ = std::make_shared<RiskManager>(config);
+
+        auto position = std::make_shared<Position>("AAPL");
+        position->add_trade(800.0, 150.0);
+        risk_manager_->update_position(position);
+
+        dynamic_validator_.add_validator(std::make_unique<OrderSizeValidator>());
+        dynamic_validator_.add_validator(std::make_unique<PositionLimitValidator>());
+        dynamic_validator_.add_validator(std::make_unique<DailyLossValidator>());
+    }
+
+    static OrderRequest make_order(const std::string& symbol, OrderSide side, double quantity) {
+        OrderRequest request;
+        request.instrument_symbol = symbol;
+        request.side = side;
+        request.type = OrderType::MARKET;
+        request.quantity = quantity;
+        request.price = 0.0;
+        request.timestamp = system_clock::now();
+        return request;
+    }
+
+    template<typename Fn>
+    static double measure_ns_per_op(int iterations, Fn&& fn) {
+        auto start = high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            fn();
+        }
+        auto elapsed = duration_cast<nanoseconds>(high_resolution_clock::now() - start);
+        return static_cast<double>(elapsed.count()) / static_cast<double>(iterations);
+    }
+
+    std::shared_ptr<RiskManager> risk_manager_;
+    CompositeRiskValidator dynamic_validator_;
+};
+
+TEST_F(RiskValidatorChainTest, StaticChainMatchesDynamicChain) {
+    std::vector<OrderRequest> requests = {
+        make_order("AAPL", OrderSide::SELL, 100.0),  // Passes
+        make_order("AAPL", OrderSide::BUY, 600.0),   // Order size
+        make_order("AAPL", OrderSide::BUY, 300.0),   // Position limit
+        make_order("MSFT", OrderSide::BUY, 400.0)    // Passes
+    };
+
+    for (const auto& request : requests) {
+        bool dynamic_passed = dynamic_validator_.validate(request, *risk_manager_);
+        RiskCheckResult static_result = DefaultStaticRiskValidator::validate(request, *risk_manager_);
+
+        EXPECT_EQ(dynamic_passed, static_result == RiskCheckResult::PASSED);
+        if (!dynamic_passed) {
+            EXPECT_EQ(dynamic_validator_.get_rejection_reason(), risk_check_result_to_string(static_result));
+        }
+    }
+
+    EXPECT_EQ(DefaultStaticRiskValidator::validate(make_order("AAPL", OrderSide::BUY, 600.0), *risk_manager_),
+              RiskCheckResult::ORDER_SIZE_EXCEEDED);
+    EXPECT_EQ(DefaultStaticRiskValidator::validate(make_order("AAPL", OrderSide::BUY, 300.0), *risk_manager_),
+              RiskCheckResult::POSITION_LIMIT_EXCEEDED);
+    EXPECT_EQ(DefaultStaticRiskValidator::check_count(), 3u);
+}
+
+TEST_F(RiskValidatorChainTest, StaticVersusDynamicThroughput) {
+    const int iterations = 200000;
+    const auto passing = make_order("AAPL", OrderSide::SELL, 100.0);
+    const auto rejected = make_order("AAPL", OrderSide::BUY, 300.0);
+
+    // Warm up caches and branch predictors for both paths
+    for (int i = 0; i < 1000; ++i) {
+        dynamic_validator_.validate(passing, *risk_manager_);
+        DefaultStaticRiskValidator::validate(passing, *risk_manager_);
+    }
+
+    size_t sink = 0;
+    double dynamic_pass_ns = measure_ns_per_op(iterations, [&] {
+        sink += dynamic_validator_.validate(passing, *risk_manager_) ? 1u : 0u;
+    });
+    double static_pass_ns = measure_ns_per_op(iterations, [&] {
+        sink += DefaultStaticRiskValidator::validate(passing, *risk_manager_) == RiskCheckResult::PASSED ? 1u : 0u;
+    });
+    double dynamic_reject_ns = measure_ns_per_op(iterations, [&] {
+        sink += dynamic_validator_.validate(rejected, *risk_manager_) ? 1u : 0u;
+    });
+    double static_reject_ns = measure_ns_per_op(iterations, [&] {
+        sink += DefaultStaticRiskValidator::validate(rejected, *risk_manager_) == RiskCheckResult::PASSED ? 1u : 0u;
+    });
+
+    std::cout << "\n=== Risk Validator Chain Results (ns/op) ===" << std::endl;
+    std::cout << "Passing order:  dynamic " << dynamic_pass_ns << ", static " << static_pass_ns << std::endl;
+    std::cout << "Rejected order: dynamic " << dynamic_reject_ns << ", static " << static_reject_ns << std::endl;
+
+    EXPECT_EQ(sink, static_cast<size_t>(iterations) * 2);
+    // The static chain never builds a rejection string, so it must win on the reject path
+    EXPECT_LT(static_reject_ns, dynamic_reject_ns) << "Static chain slower than dynamic chain on rejections";
+}
@@ -0,0 +1,387 @@
+/**
+ * UI Render Benchmarks
+ * Per-frame CPU time and heap allocations of the UI thread: UIManager runs
+ * headless (ImGui with no window or GPU) while a scripted load of quotes, order
+ * updates, fills and position changes is published into its UIDataModel, as the
+ * market data and engine threads would. Each frame covers the data model pickup,
+ * row formatting and every panel's render() through ImGui::Render(); allocations
+ * count both operator new and ImGui's own allocator.
+ *
+ * Usage: ui_render_benchmarks [symbols] [trades_per_sec] [seconds] [--preload trades]
+ *                             [--json results.json] [--max-frame-us N] [--max-allocs N]
+ *   e.g. ui_render_benchmarks 500 1000 30 --preload 100000 --max-frame-us 4000
+ * Time is simulated at 60 frames per second (no sleeping); each symbol quotes every
+ * 100 ms. The run exits non-zero when the p99 frame CPU time or the mean
+ * allocations per frame exceed the given limits, so CI can flag regressions.
+ * Not registered with CTest - run manually or from a CI job.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <imgui.h>
+#include <nlohmann/json.hpp>
+
+#include "ui/managers/ui_manager.hpp"
+#include "ui/models/ui_data_model.hpp"
+#include "core/models/market_tick.hpp"
+#include "core/models/position.hpp"
+#include "core/models/trade.hpp"
+
+using namespace trading;
+using namespace trading::ui;
+
+// Allocation counting for the thread being measured
+namespace {
+thread_local bool count_allocations = false;
+thread_local uint64_t allocation_count = 0;
+thread_local uint64_t allocated_bytes = 0;
+} // namespace
+
+void* operator new(std::size_t size) {
+    if (count_allocations) {
+        ++allocation_count;
+        allocated_bytes += size;
+    }
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+// ImGui allocates through IM_ALLOC (malloc by default), not operator new
+namespace {
+void* imgui_alloc(size_t size, void*) {
+    if (count_allocations) {
+        ++allocation_count;
+        allocated_bytes += size;
+    }
+    return std::malloc(size);
+}
+
+void imgui_free(void* memory, void*) {
+    std::free(memory);
+}
+} // namespace
+
+namespace {
+
+constexpr int FRAMES_PER_SECOND = 60;
+constexpr int QUOTE_INTERVAL_FRAMES = 6;   // 100 ms per symbol
+
+struct Options {
+    size_t symbols = 500;
+    double trades_per_second = 1000.0;
+    int seconds = 30;
+    size_t preload_trades = 0;
+    std::string json_path;
+    double max_frame_us = 0.0;     // 0 = no limit
+    double max_allocs = 0.0;       // 0 = no limit
+};
+
+struct Result {
+    std::string scenario;
+    size_t frames = 0;
+    size_t trade_rows = 0;
+    double cpu_p50_us = 0.0;
+    double cpu_p99_us = 0.0;
+    double cpu_max_us = 0.0;
+    double wall_mean_us = 0.0;
+    double allocs_mean = 0.0;
+    uint64_t allocs_max = 0;
+    double bytes_mean = 0.0;
+    int vertices = 0;
+};
+
+int64_t thread_cpu_ns() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+double percentile(std::vector<double> samples, double fraction) {
+    if (samples.empty()) {
+        return 0.0;
+    }
+    std::sort(samples.begin(), samples.end());
+    size_t index = std::min(samples.size() - 1, static_cast<size_t>(fraction * static_cast<double>(samples.size())));
+    return samples[index];
+}
+
+std::string symbol_name(size_t index) {
+    return "SYM" + std::to_string(index);
+}
+
+/**
+ * Publishes what the market data feed and the engine would for a replayed load
+ */
+class LoadScript {
+public:
+    LoadScript(UIDataModel& model, size_t symbols)
+        : model_(model), symbols_(symbols) {
+        for (size_t i = 0; i < symbols_; ++i) {
+            positions_.push_back(std::make_unique<Position>(symbol_name(i)));
+        }
+    }
+
+    void publish_quotes(int frame) {
+        for (size_t i = static_cast<size_t>(frame % QUOTE_INTERVAL_FRAMES); i < symbols_; i += QUOTE_INTERVAL_FRAMES) {
+            double mid = 100.0 + static_cast<double>(i % 400) + static_cast<double>(frame % 50) * 0.01;
+            model_.publish_quote(MarketTick(symbol_name(i), mid - 0.01, mid + 0.01, mid, 100.0));
+        }
+    }
+
+    void publish_fill() {
+        const size_t n = fills_++;
+        const std::string symbol = symbol_name(n % symbols_);
+        const std::string order_id = "ORD_" + std::to_string(n);
+        const OrderSide side = n % 2 ? OrderSide::SELL : OrderSide::BUY;
+        const double price = 100.0 + static_cast<double>(n % 400);
+
+        ExecutionReport report;
+        report.order_id = order_id;
+        report.symbol = symbol;
+        report.side = side;
+        report.type = OrderType::LIMIT;
+        report.quantity = 100.0;
+        report.price = price;
+        report.old_status = OrderStatus::NEW;
+        report.new_status = OrderStatus::ACCEPTED;
+        report.filled_quantity = 0.0;
+        report.remaining_quantity = 100.0;
+        report.execution_price = 0.0;
+        report.created_time = std::chrono::system_clock::now();
+        report.timestamp = report.created_time;
+        model_.publish_order(report);
+
+        model_.publish_trade(Trade("TRD_" + std::to_string(n), order_id, symbol, side, 100.0, price));
+
+        report.old_status = OrderStatus::ACCEPTED;
+        report.new_status = OrderStatus::FILLED;
+        report.filled_quantity = 100.0;
+        report.remaining_quantity = 0.0;
+        report.execution_price = price;
+        model_.publish_order(report);
+
+        auto& position = *positions_[n % symbols_];
+        position.add_trade(side == OrderSide::BUY ? 100.0 : -100.0, price);
+        model_.publish_position(position);
+    }
+
+private:
+    UIDataModel& model_;
+    size_t symbols_;
+    size_t fills_ = 0;
+    std::vector<std::unique_ptr<Position>> positions_;
+};
+
+Result run_scenario(const std::string& name, const Options& options, size_t preload_trades) {
+    auto model = std::make_shared<UIDataModel>();
+    LoadScript script(*model, options.symbols);
+
+    UIManager::UIManagerConfig config;
+    config.headless = true;
+    config.max_displayed_trades = static_cast<int>(std::max<size_t>(preload_trades, 1000));
+    UIManager manager(config);
+    if (!manager.initialize()) {
+        std::fprintf(stderr, "Failed to initialise the headless UI\n");
+        std::exit(1);
+    }
+    manager.set_data_model(model);
+
+    // Preloaded fills reach the panels before measurement starts
+    for (size_t i = 0; i < preload_trades; ++i) {
+        script.publish_fill();
+    }
+    for (int frame = 0; frame < QUOTE_INTERVAL_FRAMES; ++frame) {
+        script.publish_quotes(frame);
+    }
+    manager.render_frame();
+    manager.render_frame();   // Windows settle their size on the first frames
+
+    const int frames = options.seconds * FRAMES_PER_SECOND;
+    const double fills_per_frame = options.trades_per_second / FRAMES_PER_SECOND;
+    double fill_budget = 0.0;
+
+    std::vector<double> cpu_us;
+    std::vector<double> wall_us;
+    std::vector<uint64_t> allocs;
+    uint64_t total_bytes = 0;
+    cpu_us.reserve(static_cast<size_t>(frames));
+    wall_us.reserve(static_cast<size_t>(frames));
+    allocs.reserve(static_cast<size_t>(frames));
+
+    for (int frame = 0; frame < frames; ++frame) {
+        // Producer side, not measured
+        script.publish_quotes(frame);
+        for (fill_budget += fills_per_frame; fill_budget >= 1.0; fill_budget -= 1.0) {
+            script.publish_fill();
+        }
+
+        allocation_count = 0;
+        allocated_bytes = 0;
+        auto wall_start = std::chrono::steady_clock::now();
+        int64_t cpu_start = thread_cpu_ns();
+        count_allocations = true;
+
+        manager.render_frame();
+
+        count_allocations = false;
+        int64_t cpu_end = thread_cpu_ns();
+        auto wall_end = std::chrono::steady_clock::now();
+
+        cpu_us.push_back(static_cast<double>(cpu_end - cpu_start) / 1000.0);
+        wall_us.push_back(static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(wall_end - wall_start).count()) / 1000.0);
+        allocs.push_back(allocation_count);
+        total_bytes += allocated_bytes;
+    }
+
+    Result result;
+    result.scenario = name;
+    result.frames = static_cast<size_t>(frames);
+    result.trade_rows = preload_trades + static_cast<size_t>(options.trades_per_second * options.seconds);
+    result.cpu_p50_us = percentile(cpu_us, 0.50);
+    result.cpu_p99_us = percentile(cpu_us, 0.99);
+    result.cpu_max_us = cpu_us.empty() ? 0.0 : *std::max_element(cpu_us.begin(), cpu_us.end());
+    double wall_total = 0.0;
+    for (double sample : wall_us) {
+        wall_total += sample;
+    }
+    uint64_t alloc_total = 0;
+    for (uint64_t count : allocs) {
+        alloc_total += count;
+        result.allocs_max = std::max(result.allocs_max, count);
+    }
+    if (frames > 0) {
+        result.wall_mean_us = wall_total / frames;
+        result.allocs_mean = static_cast<double>(alloc_total) / frames;
+        result.bytes_mean = static_cast<double>(total_bytes) / frames;
+    }
+    result.vertices = manager.get_headless_frame_stats().vertices;
+
+    manager.shutdown();
+    return result;
+}
+
+void print_results(const std::vector<Result>& results) {
+    std::printf("\n%-20s %8s %10s %12s %12s %12s %12s %12s %10s %12s %10s\n", "scenario", "frames", "trades",
+                "cpu p50 us", "cpu p99 us", "cpu max us", "wall avg us", "allocs avg", "allocs max", "bytes avg",
+                "vertices");
+    for (const auto& result : results) {
+        std::printf("%-20s %8zu %10zu %12.1f %12.1f %12.1f %12.1f %12.1f %10llu %12.0f %10d\n",
+                    result.scenario.c_str(), result.frames, result.trade_rows, result.cpu_p50_us, result.cpu_p99_us,
+                    result.cpu_max_us, result.wall_mean_us, result.allocs_mean,
+                    static_cast<unsigned long long>(result.allocs_max), result.bytes_mean, result.vertices);
+    }
+}
+
+bool write_json(const std::string& path, const Options& options, const std::vector<Result>& results) {
+    nlohmann::json rows = nlohmann::json::array();
+    for (const auto& result : results) {
+        rows.push_back({{"scenario", result.scenario},
+                        {"frames", result.frames},
+                        {"trade_rows", result.trade_rows},
+                        {"cpu_p50_us", result.cpu_p50_us},
+                        {"cpu_p99_us", result.cpu_p99_us},
+                        {"cpu_max_us", result.cpu_max_us},
+                        {"wall_mean_us", result.wall_mean_us},
+                        {"allocs_mean", result.allocs_mean},
+                        {"allocs_max", result.allocs_max},
+                        {"bytes_mean", result.bytes_mean},
+                        {"vertices", result.vertices}});
+    }
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+    file << nlohmann::json{{"benchmark", "ui_render"},
+                           {"symbols", options.symbols},
+                           {"trades_per_second", options.trades_per_second},
+                           {"results", rows}}.dump(2) << "\n";
+    return static_cast<bool>(file);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            options.json_path = argv[++i];
+        } else if (arg == "--preload" && i + 1 < argc) {
+            options.preload_trades = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--max-frame-us" && i + 1 < argc) {
+            options.max_frame_us = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--max-allocs" && i + 1 < argc) {
+            options.max_allocs = std::strtod(argv[++i], nullptr);
+        } else {
+            positional.push_back(arg);
+        }
+    }
+    if (positional.size() > 0) {
+        options.symbols = std::max<size_t>(1, std::strtoull(positional[0].c_str(), nullptr, 10));
+    }
+    if (positional.size() > 1) {
+        options.trades_per_second = std::max(0.0, std::strtod(positional[1].c_str(), nullptr));
+    }
+    if (positional.size() > 2) {
+        options.seconds = std::max(1, std::atoi(positional[2].c_str()));
+    }
+
+    // Before any ImGui context exists, so every ImGui allocation goes through the counter
+    ImGui::SetAllocatorFunctions(imgui_alloc, imgui_free);
+
+    std::printf("UI render benchmarks: %zu symbols, %.0f trades/s, %d s at %d fps\n", options.symbols,
+                options.trades_per_second, options.seconds, FRAMES_PER_SECOND);
+
+    std::vector<Result> results;
+    results.push_back(run_scenario("steady", options, 0));
+    if (options.preload_trades > 0) {
+        results.push_back(run_scenario("preloaded " + std::to_string(options.preload_trades), options,
+                                       options.preload_trades));
+    }
+    print_results(results);
+
+    if (!options.json_path.empty()) {
+        if (!write_json(options.json_path, options, results)) {
+            std::fprintf(stderr, "Failed to write %s\n", options.json_path.c_str());
+            return 1;
+        }
+        std::printf("\nResults written to %s\n", options.json_path.c_str());
+    }
+
+    int rc = 0;
+    for (const auto& result : results) {
+        if (options.max_frame_us > 0.0 && result.cpu_p99_us > options.max_frame_us) {
+            std::fprintf(stderr, "%s: p99 frame CPU %.1f us exceeds %.1f us\n", result.scenario.c_str(),
+                         result.cpu_p99_us, options.max_frame_us);
+            rc = 2;
+        }
+        if (options.max_allocs > 0.0 && result.allocs_mean > options.max_allocs) {
+            std::fprintf(stderr, "%s: %.1f allocations per frame exceeds %.1f\n", result.scenario.c_str(),
+                         result.allocs_mean, options.max_allocs);
+            rc = 2;
+        }
+    }
+    return rc;
+}
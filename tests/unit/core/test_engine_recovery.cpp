@@ -0,0 +1,281 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "core/engine/trading_engine.hpp"
+#include "core/risk/risk_manager.hpp"
+#include "infrastructure/persistence/event_journal.hpp"
+#include "infrastructure/persistence/snapshot_store.hpp"
+
+using namespace trading;
+
+class EngineRecoveryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        base_ = std::filesystem::temp_directory_path() /
+                ("engine_recovery_test_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        journal_config_.directory = (base_ / "journal").string();
+        journal_config_.retain_for_snapshots = true;
+        snapshot_config_.directory = (base_ / "snapshots").string();
+
+        risk_config_.max_position_size = 10000.0;
+        risk_config_.max_order_size = 1000.0;
+        risk_config_.max_daily_loss = 50000.0;
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(base_, ec);
+    }
+
+    std::shared_ptr<TradingEngine> start_engine(std::shared_ptr<EventJournal> journal,
+                                                std::shared_ptr<SnapshotStore> store) {
+        auto engine = std::make_shared<TradingEngine>(std::make_shared<RiskManager>(risk_config_));
+        engine->set_event_journal(std::move(journal));
+        if (store) {
+            engine->set_snapshot_store(std::move(store), std::chrono::seconds(3600));
+        }
+        EXPECT_TRUE(engine->initialize());
+        return engine;
+    }
+
+    std::shared_ptr<EventJournal> open_journal() {
+        auto journal = std::make_shared<EventJournal>(journal_config_);
+        EXPECT_TRUE(journal->open());
+        return journal;
+    }
+
+    // Buy limits below the simulated 95-105 price range stay working until filled by hand
+    static OrderRequest limit_order(const std::string& symbol, OrderSide side, double quantity, double price) {
+        OrderRequest request;
+        request.instrument_symbol = symbol;
+        request.side = side;
+        request.type = OrderType::LIMIT;
+        request.quantity = quantity;
+        request.price = price;
+        request.timestamp = std::chrono::system_clock::now();
+        return request;
+    }
+
+    std::filesystem::path base_;
+    EventJournal::Config journal_config_;
+    SnapshotStore::Config snapshot_config_;
+    RiskManagementConfig risk_config_;
+};
+
+TEST_F(EngineRecoveryTest, JournalReplayRestoresOrdersTradesPositionsAndSequences) {
+    std::string partially_filled_id;
+    std::string filled_id;
+    {
+        auto journal = open_journal();
+        auto engine = start_engine(journal, nullptr);
+        partially_filled_id = engine->submit_order(limit_order("AAPL", OrderSide::BUY, 100.0, 50.0));
+        filled_id = engine->submit_order(limit_order("MSFT", OrderSide::BUY, 50.0, 60.0));
+        ASSERT_TRUE(engine->execute_order(partially_filled_id, 40.0, 50.0));
+        ASSERT_TRUE(engine->execute_order(filled_id, 50.0, 60.0));
+        engine->shutdown();
+        journal->close();
+    }
+
+    auto journal = open_journal();
+    auto engine = start_engine(journal, nullptr);
+
+    auto partially_filled = engine->get_order(partially_filled_id);
+    ASSERT_NE(partially_filled, nullptr);
+    EXPECT_EQ(partially_filled->get_status(), OrderStatus::PARTIALLY_FILLED);
+    EXPECT_DOUBLE_EQ(partially_filled->get_filled_quantity(), 40.0);
+    EXPECT_DOUBLE_EQ(partially_filled->get_average_fill_price(), 50.0);
+    EXPECT_EQ(engine->get_order(filled_id)->get_status(), OrderStatus::FILLED);
+
+    EXPECT_EQ(engine->get_trade_count(), 2u);
+    EXPECT_EQ(engine->get_trades_by_order(filled_id).size(), 1u);
+    ASSERT_NE(engine->get_position("AAPL"), nullptr);
+    EXPECT_DOUBLE_EQ(engine->get_position("AAPL")->get_quantity(), 40.0);
+    EXPECT_DOUBLE_EQ(engine->get_position("MSFT")->get_quantity(), 50.0);
+
+    auto working = engine->get_working_orders();
+    ASSERT_EQ(working.size(), 1u);
+    EXPECT_EQ(working[0]->get_order_id(), partially_filled_id);
+
+    // Id sequence continues instead of restarting at zero
+    std::string next_id = engine->submit_order(limit_order("AAPL", OrderSide::BUY, 10.0, 50.0));
+    EXPECT_EQ(next_id.rfind("ORD00000002_", 0), 0u);
+}
+
+TEST_F(EngineRecoveryTest, SnapshotPlusJournalTailRestoresLatestState) {
+    const auto crash_snapshots = base_ / "crash_snapshots";
+    std::string canceled_id;
+    std::string late_fill_id;
+    {
+        auto journal = open_journal();
+        auto engine = start_engine(journal, std::make_shared<SnapshotStore>(snapshot_config_));
+        canceled_id = engine->submit_order(limit_order("AAPL", OrderSide::BUY, 100.0, 50.0));
+        late_fill_id = engine->submit_order(limit_order("MSFT", OrderSide::BUY, 20.0, 60.0));
+        ASSERT_TRUE(engine->execute_order(late_fill_id, 5.0, 60.0));
+        ASSERT_TRUE(engine->write_snapshot());
+
+        // Keep the mid-session snapshot; the clean-shutdown one would leave nothing to replay
+        std::filesystem::copy(snapshot_config_.directory, crash_snapshots);
+
+        ASSERT_TRUE(engine->cancel_order(canceled_id));
+        ASSERT_TRUE(engine->execute_order(late_fill_id, 15.0, 61.0));
+        engine->shutdown();
+        journal->close();
+    }
+
+    SnapshotStore::Config crash_config;
+    crash_config.directory = crash_snapshots.string();
+    auto journal = open_journal();
+    auto engine = start_engine(journal, std::make_shared<SnapshotStore>(crash_config));
+
+    EXPECT_EQ(engine->get_order(canceled_id)->get_status(), OrderStatus::CANCELED);
+    EXPECT_EQ(engine->get_order(late_fill_id)->get_status(), OrderStatus::FILLED);
+    EXPECT_EQ(engine->get_trade_count(), 2u);   // Snapshot trade is not duplicated by replay
+    EXPECT_DOUBLE_EQ(engine->get_position("MSFT")->get_quantity(), 20.0);
+    EXPECT_TRUE(engine->get_working_orders().empty());
+}
+
+TEST_F(EngineRecoveryTest, SnapshotStoreFallsBackWhenNewestIsCorrupt) {
+    SnapshotStore store(snapshot_config_);
+
+    EngineSnapshot older;
+    older.journal_sequence = 5;
+    older.order_sequence = 3;
+    older.orders.push_back(std::make_shared<Order>("ORD1", "AAPL", OrderSide::BUY, OrderType::LIMIT, 10.0, 100.0));
+    older.trades.push_back(std::make_shared<Trade>("TRD1", "ORD1", "AAPL", OrderSide::BUY, 10.0, 100.0));
+    ASSERT_TRUE(store.write(older));
+
+    EngineSnapshot newer = older;
+    newer.journal_sequence = 9;
+    ASSERT_TRUE(store.write(newer));
+
+    auto paths = store.list_snapshots();
+    ASSERT_EQ(paths.size(), 2u);
+    std::FILE* file = std::fopen(paths.front().c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    std::fseek(file, -10, SEEK_END);
+    std::fputc(0x7F, file);
+    std::fclose(file);
+
+    EngineSnapshot loaded;
+    ASSERT_TRUE(store.load_latest(loaded));
+    EXPECT_EQ(loaded.journal_sequence, 5u);
+    EXPECT_EQ(loaded.order_sequence, 3u);
+    ASSERT_EQ(loaded.orders.size(), 1u);
+    EXPECT_EQ(loaded.orders[0]->get_order_id(), "ORD1");
+    EXPECT_EQ(loaded.orders[0]->get_created_time(), older.orders[0]->get_created_time());
+    ASSERT_EQ(loaded.trades.size(), 1u);
+    EXPECT_EQ(loaded.trades[0]->get_execution_time(), older.trades[0]->get_execution_time());
+}
+
+TEST_F(EngineRecoveryTest, CoalescedPositionsReplayFillsSinceLastFlush) {
+    const auto crash_journal = base_ / "crash_journal";
+    {
+        auto journal = open_journal();
+        auto engine = std::make_shared<TradingEngine>(std::make_shared<RiskManager>(risk_config_));
+        engine->set_event_journal(journal);
+        engine->set_position_flush_interval(std::chrono::hours(1));
+        ASSERT_TRUE(engine->initialize());
+
+        std::string order_id = engine->submit_order(limit_order("AAPL", OrderSide::BUY, 100.0, 50.0));
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_TRUE(engine->execute_order(order_id, 10.0, 50.0));
+        }
+        EXPECT_EQ(engine->flush_dirty_positions(), 1u);   // Three fills, one position write
+        EXPECT_EQ(engine->flush_dirty_positions(), 0u);
+        ASSERT_TRUE(engine->execute_order(order_id, 20.0, 51.0));
+        ASSERT_TRUE(journal->flush());
+
+        size_t position_records = 0;
+        journal->for_each_record(1, std::numeric_limits<size_t>::max(), [&](const JournalRecord& record) {
+            position_records += record.type == JournalRecordType::POSITION ? 1 : 0;
+        });
+        EXPECT_EQ(position_records, 1u);
+
+        // Crash before the next flush: the last fill has no position record yet
+        std::filesystem::copy(journal_config_.directory, crash_journal);
+        engine->shutdown();
+        journal->close();
+    }
+
+    journal_config_.directory = crash_journal.string();
+    auto engine = start_engine(open_journal(), nullptr);
+    ASSERT_NE(engine->get_position("AAPL"), nullptr);
+    EXPECT_DOUBLE_EQ(engine->get_position("AAPL")->get_quantity(), 50.0);
+    EXPECT_NEAR(engine->get_position("AAPL")->get_average_price(), 50.4, 1e-9);
+    EXPECT_EQ(engine->get_trade_count(), 4u);
+}
+
+TEST_F(EngineRecoveryTest, FillIsPublishedOnceItsJournalRecordIsDurable) {
+    auto journal = open_journal();
+    auto risk_manager = std::make_shared<RiskManager>(risk_config_);
+    auto engine = std::make_shared<TradingEngine>(risk_manager);
+    engine->set_event_journal(journal);
+    uint64_t durable_at_publish = 0;
+    engine->set_trade_callback([&](const Trade&) { durable_at_publish = journal->get_durable_sequence(); });
+    ASSERT_TRUE(engine->initialize());
+
+    std::string order_id = engine->submit_order(limit_order("AAPL", OrderSide::BUY, 100.0, 50.0));
+    ASSERT_TRUE(engine->execute_order(order_id, 10.0, 50.0));
+    ASSERT_TRUE(journal->flush());
+
+    uint64_t trade_sequence = 0;
+    journal->for_each_record(1, std::numeric_limits<size_t>::max(), [&](const JournalRecord& record) {
+        if (record.type == JournalRecordType::TRADE) {
+            trade_sequence = record.sequence;
+        }
+    });
+    ASSERT_NE(trade_sequence, 0u);
+    EXPECT_GE(durable_at_publish, trade_sequence);
+    EXPECT_FALSE(risk_manager->get_kill_switch().is_engaged());
+    engine->shutdown();
+}
+
+TEST_F(EngineRecoveryTest, SnapshotTakenDuringFillsDoesNotDoubleCountPositions) {
+    const auto crash_journal = base_ / "crash_journal";
+    const auto crash_snapshots = base_ / "crash_snapshots";
+    constexpr int fills = 1000;
+    journal_config_.sync_on_commit = false;   // Fast fills, so snapshots land between them
+    {
+        auto journal = open_journal();
+        auto engine = std::make_shared<TradingEngine>(std::make_shared<RiskManager>(risk_config_));
+        engine->set_event_journal(journal);
+        engine->set_snapshot_store(std::make_shared<SnapshotStore>(snapshot_config_), std::chrono::seconds(3600));
+        engine->set_position_flush_interval(std::chrono::hours(1));   // No position record follows the fills
+        ASSERT_TRUE(engine->initialize());
+
+        std::string order_id = engine->submit_order(limit_order("AAPL", OrderSide::BUY, fills, 50.0));
+        std::atomic<bool> filling{true};
+        std::thread filler([&]() {
+            for (int i = 0; i < fills; ++i) {
+                engine->execute_order(order_id, 1.0, 50.0);
+            }
+            filling = false;
+        });
+        // Snapshots race the fills; each must match its journal sequence exactly
+        while (filling.load()) {
+            engine->write_snapshot();
+        }
+        filler.join();
+        ASSERT_TRUE(journal->flush());
+
+        std::filesystem::copy(journal_config_.directory, crash_journal);
+        std::filesystem::copy(snapshot_config_.directory, crash_snapshots);
+        engine->shutdown();
+        journal->close();
+    }
+
+    journal_config_.directory = crash_journal.string();
+    SnapshotStore::Config crash_config;
+    crash_config.directory = crash_snapshots.string();
+    auto engine = start_engine(open_journal(), std::make_shared<SnapshotStore>(crash_config));
+    ASSERT_NE(engine->get_position("AAPL"), nullptr);
+    EXPECT_DOUBLE_EQ(engine->get_position("AAPL")->get_quantity(), static_cast<double>(fills));
+    EXPECT_EQ(engine->get_trade_count(), static_cast<size_t>(fills));
+}
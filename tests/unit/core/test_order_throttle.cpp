@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/risk/order_throttle.hpp"
+#include "core/risk/risk_manager.hpp"
+#include "core/risk/symbol_slot_table.hpp"
+
+using namespace trading;
+
+namespace {
+constexpr int64_t NS_PER_SECOND = 1000000000;
+
+// Every symbol hashes alike, so each lookup has to tell them apart by name
+struct CollidingHash {
+    size_t operator()(std::string_view) const { return 7; }
+};
+}
+
+TEST(TokenBucketTest, AllowsBurstThenRefillsAtRate) {
+    TokenBucket bucket;
+    TokenRate rate = TokenRate::per_second(10.0, 5.0);
+    const int64_t start = NS_PER_SECOND;
+
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(bucket.try_acquire(start, rate));
+    }
+    EXPECT_FALSE(bucket.try_acquire(start, rate));
+
+    // One token earned every 100ms
+    EXPECT_FALSE(bucket.try_acquire(start + NS_PER_SECOND / 20, rate));
+    EXPECT_TRUE(bucket.try_acquire(start + NS_PER_SECOND / 10, rate));
+    EXPECT_FALSE(bucket.try_acquire(start + NS_PER_SECOND / 10, rate));
+}
+
+TEST(TokenBucketTest, ReleaseRefundsToken) {
+    TokenBucket bucket;
+    TokenRate rate = TokenRate::per_second(1.0, 1.0);
+
+    EXPECT_TRUE(bucket.try_acquire(NS_PER_SECOND, rate));
+    EXPECT_FALSE(bucket.try_acquire(NS_PER_SECOND, rate));
+    bucket.release(rate);
+    EXPECT_TRUE(bucket.try_acquire(NS_PER_SECOND, rate));
+}
+
+TEST(TokenBucketTest, UnlimitedRateAlwaysAllows) {
+    TokenBucket bucket;
+    TokenRate rate;
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(bucket.try_acquire(0, rate));
+    }
+}
+
+TEST(TokenBucketTest, ConcurrentAcquiresNeverExceedCapacity) {
+    TokenBucket bucket;
+    TokenRate rate = TokenRate::per_second(1.0, 1000.0);
+    std::atomic<int> granted(0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 500; ++i) {
+                if (bucket.try_acquire(NS_PER_SECOND, rate)) {
+                    granted.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(granted.load(), 1000);
+}
+
+TEST(OrderThrottleTest, PerSymbolLimitIsIndependentPerSymbol) {
+    RiskManagementConfig config;
+    config.max_orders_per_second_per_symbol = 3;
+
+    OrderThrottle throttle;
+    throttle.configure(config);
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(throttle.try_acquire_order("AAPL"), ThrottleResult::ALLOWED);
+    }
+    EXPECT_EQ(throttle.try_acquire_order("AAPL"), ThrottleResult::SYMBOL_ORDER_RATE);
+    EXPECT_EQ(throttle.try_acquire_order("MSFT"), ThrottleResult::ALLOWED);
+
+    // Cancels have their own budget
+    EXPECT_EQ(throttle.try_acquire_cancel("AAPL"), ThrottleResult::ALLOWED);
+    EXPECT_EQ(throttle.get_throttled_count(), 1u);
+}
+
+TEST(OrderThrottleTest, GlobalLimitAppliesAcrossSymbols) {
+    RiskManagementConfig config;
+    config.max_orders_per_second = 4;
+    config.max_orders_per_second_per_symbol = 3;
+    config.max_cancels_per_second = 1;
+
+    OrderThrottle throttle;
+    throttle.configure(config);
+
+    EXPECT_EQ(throttle.try_acquire_order("AAPL"), ThrottleResult::ALLOWED);
+    EXPECT_EQ(throttle.try_acquire_order("MSFT"), ThrottleResult::ALLOWED);
+    EXPECT_EQ(throttle.try_acquire_order("GOOGL"), ThrottleResult::ALLOWED);
+    EXPECT_EQ(throttle.try_acquire_order("TSLA"), ThrottleResult::ALLOWED);
+    EXPECT_EQ(throttle.try_acquire_order("AMZN"), ThrottleResult::GLOBAL_ORDER_RATE);
+
+    // The global rejection refunded AMZN's symbol token
+    config.max_orders_per_second = 0;
+    throttle.configure(config);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(throttle.try_acquire_order("AMZN"), ThrottleResult::ALLOWED);
+    }
+
+    EXPECT_EQ(throttle.try_acquire_cancel("AAPL"), ThrottleResult::ALLOWED);
+    EXPECT_EQ(throttle.try_acquire_cancel("MSFT"), ThrottleResult::GLOBAL_CANCEL_RATE);
+}
+
+TEST(OrderThrottleTest, RiskManagerReportsThrottleReason) {
+    RiskManagementConfig config;
+    config.max_cancels_per_second_per_symbol = 1;
+    RiskManager risk_manager(config);
+
+    std::string reason;
+    EXPECT_TRUE(risk_manager.acquire_order_throttle("AAPL", reason));
+    EXPECT_TRUE(risk_manager.acquire_cancel_throttle("AAPL", reason));
+    EXPECT_TRUE(reason.empty());
+
+    EXPECT_FALSE(risk_manager.acquire_cancel_throttle("AAPL", reason));
+    EXPECT_EQ(reason, std::string("Throttled: ") + throttle_result_to_string(ThrottleResult::SYMBOL_CANCEL_RATE));
+    EXPECT_EQ(risk_manager.get_throttled_count(), 1u);
+}
+
+TEST(OrderThrottleTest, ReleaseRefundsOrderAndNotionalTokens) {
+    RiskManagementConfig config;
+    config.max_orders_per_second = 2;
+    config.max_orders_per_second_per_symbol = 1;
+    config.max_notional_per_second = 1000.0;
+
+    OrderThrottle throttle;
+    throttle.configure(config);
+
+    EXPECT_EQ(throttle.try_acquire_order("AAPL"), ThrottleResult::ALLOWED);
+    EXPECT_EQ(throttle.try_acquire_notional(1000.0), ThrottleResult::ALLOWED);
+    EXPECT_EQ(throttle.try_acquire_order("AAPL"), ThrottleResult::SYMBOL_ORDER_RATE);
+    EXPECT_EQ(throttle.try_acquire_notional(1000.0), ThrottleResult::NOTIONAL_RATE);
+
+    throttle.release_order("AAPL");
+    throttle.release_notional(1000.0);
+    EXPECT_EQ(throttle.try_acquire_order("AAPL"), ThrottleResult::ALLOWED);
+    EXPECT_EQ(throttle.try_acquire_notional(1000.0), ThrottleResult::ALLOWED);
+}
+
+TEST(SymbolSlotTableTest, CollidingSymbolsGetSeparateSlots) {
+    SymbolSlotTable<int, 8, CollidingHash> table;
+    int* aapl = table.find_or_insert("AAPL");
+    int* msft = table.find_or_insert("MSFT");
+    ASSERT_NE(aapl, nullptr);
+    ASSERT_NE(msft, nullptr);
+    EXPECT_NE(aapl, msft);
+    *aapl = 1;
+    *msft = 2;
+
+    EXPECT_EQ(table.find_or_insert("AAPL"), aapl);
+    ASSERT_NE(table.find("MSFT"), nullptr);
+    EXPECT_EQ(*table.find("MSFT"), 2);
+    EXPECT_EQ(table.find("GOOGL"), nullptr);
+    EXPECT_EQ(table.size(), 2u);
+}
+
+TEST(SymbolSlotTableTest, ConcurrentInsertsOfOneSymbolShareASlot) {
+    SymbolSlotTable<std::atomic<int>, 64, CollidingHash> table;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&table, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                table.find_or_insert(i % 2 ? "AAPL" : "SYM" + std::to_string(t))->fetch_add(1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(table.size(), 5u);
+    EXPECT_EQ(table.find("AAPL")->load(), 2000);
+    EXPECT_EQ(table.find("SYM0")->load(), 500);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "core/risk/quote_board.hpp"
+#include "core/risk/risk_manager.hpp"
+#include "core/models/market_tick.hpp"
+
+using namespace trading;
+
+class PriceBandTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        config_.max_position_size = 10000.0;
+        config_.max_order_size = 1000.0;
+        config_.max_daily_loss = 50000.0;
+        config_.price_band_percent = 5.0;
+        config_.max_order_notional = 50000.0;
+    }
+
+    static OrderRequest create_order_request(OrderType type, double quantity, double price = 0.0) {
+        OrderRequest request;
+        request.instrument_symbol = "AAPL";
+        request.side = OrderSide::BUY;
+        request.type = type;
+        request.quantity = quantity;
+        request.price = price;
+        request.timestamp = std::chrono::system_clock::now();
+        return request;
+    }
+
+    RiskManagementConfig config_;
+};
+
+TEST(QuoteBoardTest, StoresLatestQuotePerSymbol) {
+    QuoteBoard board;
+    Quote quote;
+    EXPECT_FALSE(board.get_quote("AAPL", quote));
+
+    board.update(MarketTick("AAPL", 99.0, 101.0, 100.5, 100.0));
+    board.update(MarketTick("MSFT", 0.0, 0.0, 250.0, 100.0));
+    board.update(MarketTick("AAPL", 109.0, 111.0, 110.5, 100.0));
+
+    ASSERT_TRUE(board.get_quote("AAPL", quote));
+    EXPECT_DOUBLE_EQ(quote.bid_price, 109.0);
+    EXPECT_DOUBLE_EQ(quote.get_reference_price(), 110.0);
+
+    ASSERT_TRUE(board.get_quote("MSFT", quote));
+    EXPECT_DOUBLE_EQ(quote.get_reference_price(), 250.0); // One-sided book falls back to last
+    EXPECT_EQ(board.get_symbol_count(), 2u);
+}
+
+TEST(QuoteBoardTest, ConcurrentReadersNeverSeeTornQuotes) {
+    QuoteBoard board;
+    board.update(MarketTick("AAPL", 1.0, 1.0, 1.0, 1.0));
+    std::atomic<bool> done(false);
+    std::atomic<int> torn(0);
+
+    std::thread writer([&]() {
+        for (int i = 1; i <= 100000; ++i) {
+            double price = static_cast<double>(i);
+            board.update(MarketTick("AAPL", price, price, price, 1.0));
+        }
+        done.store(true);
+    });
+
+    std::thread reader([&]() {
+        Quote quote;
+        while (!done.load()) {
+            if (board.get_quote("AAPL", quote) &&
+                (quote.bid_price != quote.ask_price || quote.ask_price != quote.last_price)) {
+                torn.fetch_add(1);
+            }
+        }
+    });
+
+    writer.join();
+    reader.join();
+    EXPECT_EQ(torn.load(), 0);
+}
+
+TEST_F(PriceBandTest, NoQuoteSkipsBand) {
+    RiskManager risk_manager(config_);
+    EXPECT_TRUE(risk_manager.validate_order(create_order_request(OrderType::LIMIT, 10.0, 1.0)));
+}
+
+TEST_F(PriceBandTest, LimitPriceOutsideBandIsRejected) {
+    RiskManager risk_manager(config_);
+    risk_manager.on_market_data(MarketTick("AAPL", 99.9, 100.1, 100.0, 1000.0));
+
+    EXPECT_TRUE(risk_manager.validate_order(create_order_request(OrderType::LIMIT, 10.0, 104.0)));
+    EXPECT_TRUE(risk_manager.validate_order(create_order_request(OrderType::LIMIT, 10.0, 96.0)));
+
+    std::string reason;
+    EXPECT_FALSE(risk_manager.validate_order(create_order_request(OrderType::LIMIT, 10.0, 1000.0), reason));
+    EXPECT_NE(reason.find("deviates"), std::string::npos);
+    EXPECT_FALSE(risk_manager.validate_order(create_order_request(OrderType::LIMIT, 10.0, 10.0)));
+
+    // Market orders have no price to collar
+    EXPECT_TRUE(risk_manager.validate_order(create_order_request(OrderType::MARKET, 10.0)));
+}
+
+TEST_F(PriceBandTest, OrderNotionalCapUsesQuoteForMarketOrders) {
+    RiskManager risk_manager(config_);
+    risk_manager.on_market_data(MarketTick("AAPL", 99.9, 100.1, 100.0, 1000.0));
+
+    EXPECT_TRUE(risk_manager.validate_order(create_order_request(OrderType::MARKET, 400.0)));
+
+    std::string reason;
+    EXPECT_FALSE(risk_manager.validate_order(create_order_request(OrderType::MARKET, 600.0), reason));
+    EXPECT_NE(reason.find("notional"), std::string::npos);
+    EXPECT_FALSE(risk_manager.validate_order(create_order_request(OrderType::LIMIT, 600.0, 100.0)));
+}
+
+TEST_F(PriceBandTest, NotionalPerSecondBudget) {
+    config_.max_notional_per_second = 100000.0;
+    RiskManager risk_manager(config_);
+    risk_manager.on_market_data(MarketTick("AAPL", 99.9, 100.1, 100.0, 1000.0));
+
+    std::string reason;
+    EXPECT_TRUE(risk_manager.acquire_notional_throttle(create_order_request(OrderType::LIMIT, 400.0, 100.0), reason));
+    EXPECT_TRUE(risk_manager.acquire_notional_throttle(create_order_request(OrderType::MARKET, 400.0), reason));
+    EXPECT_FALSE(risk_manager.acquire_notional_throttle(create_order_request(OrderType::LIMIT, 400.0, 100.0), reason));
+    EXPECT_EQ(reason, std::string("Throttled: ") + throttle_result_to_string(ThrottleResult::NOTIONAL_RATE));
+}
+
+TEST_F(PriceBandTest, NotionalReleaseRefundsTheAmountAcquired) {
+    config_.max_notional_per_second = 100000.0;
+    RiskManager risk_manager(config_);
+    risk_manager.on_market_data(MarketTick("AAPL", 99.9, 100.1, 100.0, 1000.0));
+
+    std::string reason;
+    double acquired = 0.0;
+    EXPECT_TRUE(risk_manager.acquire_notional_throttle(create_order_request(OrderType::LIMIT, 400.0, 100.0), reason));
+    EXPECT_TRUE(risk_manager.acquire_notional_throttle(create_order_request(OrderType::MARKET, 400.0), reason, &acquired));
+    EXPECT_DOUBLE_EQ(acquired, 400.0 * 100.0);
+
+    // The price halves before the market order is handed back; the refund is still what it was charged
+    risk_manager.on_market_data(MarketTick("AAPL", 49.9, 50.1, 50.0, 1000.0));
+    risk_manager.release_notional_throttle(acquired);
+    EXPECT_TRUE(risk_manager.acquire_notional_throttle(create_order_request(OrderType::LIMIT, 1150.0, 50.0), reason));
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/risk/scenario_engine.hpp"
+#include "core/risk/risk_manager.hpp"
+#include "core/models/order.hpp"
+#include "core/models/position.hpp"
+
+using namespace trading;
+
+class ScenarioEngineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        RiskManagementConfig config;
+        config.max_position_size = 1000.0;
+        config.max_order_size = 500.0;
+        config.max_daily_loss = 5000.0;
+        risk_manager_ = std::make_shared<RiskManager>(config);
+
+        add_position("AAPL", 500.0, 100.0);
+        add_position("MSFT", -200.0, 50.0);
+        add_position("XOM", 100.0, 80.0);
+
+        engine_ = std::make_unique<ScenarioEngine>(risk_manager_, 4);
+        engine_->set_sector("AAPL", "TECH");
+        engine_->set_sector("MSFT", "TECH");
+        engine_->set_sector("XOM", "ENERGY");
+    }
+
+    void add_position(const std::string& symbol, double quantity, double price) {
+        auto position = std::make_shared<Position>(symbol);
+        position->add_trade(quantity, price);
+        risk_manager_->update_position(position);
+    }
+
+    std::shared_ptr<RiskManager> risk_manager_;
+    std::unique_ptr<ScenarioEngine> engine_;
+};
+
+TEST_F(ScenarioEngineTest, MarketShockAppliesToAllPositions) {
+    StressScenario scenario;
+    scenario.name = "Crash";
+    scenario.market_shock = -0.10;
+    engine_->add_scenario(scenario);
+
+    auto report = engine_->run();
+
+    ASSERT_EQ(report.results.size(), 1u);
+    // 500*100*-0.1 + -200*50*-0.1 + 100*80*-0.1
+    EXPECT_DOUBLE_EQ(report.results[0].position_pnl, -5000.0 + 1000.0 - 800.0);
+    EXPECT_EQ(report.results[0].worst_symbol, "AAPL");
+    EXPECT_EQ(report.worst_scenario, "Crash");
+    EXPECT_EQ(report.symbol_count, 3u);
+}
+
+TEST_F(ScenarioEngineTest, SymbolShocksOverrideSectorShocks) {
+    StressScenario scenario;
+    scenario.name = "Tech selloff";
+    scenario.sector_shocks["TECH"] = -0.20;
+    scenario.symbol_shocks["MSFT"] = 0.0;
+    engine_->add_scenario(scenario);
+
+    auto report = engine_->run();
+
+    ASSERT_EQ(report.results.size(), 1u);
+    EXPECT_DOUBLE_EQ(report.results[0].position_pnl, 500.0 * 100.0 * -0.20);
+}
+
+TEST_F(ScenarioEngineTest, ReportsDailyLossBreaches) {
+    engine_->add_market_shock_grid(-0.20, 0.20, 41);
+    EXPECT_EQ(engine_->get_scenario_count(), 41u);
+
+    auto report = engine_->run();
+
+    EXPECT_EQ(report.scenario_count, 41u);
+    EXPECT_EQ(report.results.size(), 41u);
+    EXPECT_LT(report.worst_pnl, 0.0);
+    EXPECT_GT(report.best_pnl, 0.0);
+    EXPECT_GT(report.daily_loss_breaches, 0u);
+    EXPECT_LT(report.daily_loss_breaches, 41u);
+}
+
+TEST_F(ScenarioEngineTest, WorkingOrdersAddAdverseFillsAndLimitBreaches) {
+    auto order = std::make_shared<Order>("ORD1", "AAPL", OrderSide::BUY, OrderType::LIMIT, 600.0, 100.0);
+    order->accept();
+    risk_manager_->add_working_order(order);
+
+    StressScenario scenario;
+    scenario.name = "AAPL down";
+    scenario.symbol_shocks["AAPL"] = -0.10;
+    engine_->add_scenario(scenario);
+
+    auto report = engine_->run();
+
+    ASSERT_EQ(report.results.size(), 1u);
+    EXPECT_EQ(report.working_order_count, 1u);
+    EXPECT_DOUBLE_EQ(report.results[0].working_order_pnl, 600.0 * (90.0 - 100.0));
+    ASSERT_EQ(report.position_limit_breaches.size(), 1u);
+    EXPECT_EQ(report.position_limit_breaches[0], "AAPL");
+}
+
+TEST_F(ScenarioEngineTest, HistoricalReplayCreatesScenarioPerDay) {
+    std::vector<std::unordered_map<std::string, double>> history = {
+        {{"AAPL", -0.05}, {"XOM", 0.02}},
+        {{"AAPL", 0.03}, {"MSFT", 0.04}},
+        {{"AAPL", -0.01}}
+    };
+    engine_->add_historical_replay("2008", history);
+
+    auto report = engine_->run();
+
+    ASSERT_EQ(report.results.size(), 3u);
+    EXPECT_EQ(report.worst_scenario, "2008 day 1");
+}
+
+TEST_F(ScenarioEngineTest, ThousandsOfScenariosRunInParallel) {
+    for (int i = 0; i < 100; ++i) {
+        add_position("SYM" + std::to_string(i), 100.0 + i, 10.0 + i);
+    }
+    engine_->add_market_shock_grid(-0.25, 0.25, 5001);
+
+    auto report = engine_->run();
+
+    EXPECT_EQ(report.results.size(), 5001u);
+    EXPECT_GT(report.threads_used, 1u);
+    EXPECT_LT(report.elapsed.count(), 1000000) << "Scenario run took longer than one second";
+}
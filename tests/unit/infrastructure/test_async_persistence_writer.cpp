@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/messaging/lock_free_queue.hpp"
+#include "infrastructure/persistence/async_persistence_writer.hpp"
+#include "core/models/order.hpp"
+#include "core/models/trade.hpp"
+#include "core/models/position.hpp"
+
+using namespace trading;
+using namespace std::chrono_literals;
+
+TEST(LockFreeQueueTest, PushPopPreservesOrderAndReportsPosition) {
+    LockFreeQueue<int> queue(3);
+    EXPECT_EQ(queue.capacity(), 4u); // Rounded up to a power of two
+
+    uint64_t position = 0;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(int(i), position));
+        EXPECT_EQ(position, static_cast<uint64_t>(i));
+    }
+    EXPECT_FALSE(queue.try_push(4));
+    EXPECT_EQ(queue.size(), 4u);
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.try_pop(value));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(LockFreeQueueTest, ConcurrentProducersAndConsumersLoseNothing) {
+    LockFreeQueue<int> queue(1024);
+    const int producers = 4;
+    const int per_producer = 50000;
+    std::atomic<long long> consumed_sum(0);
+    std::atomic<int> consumed_count(0);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p]() {
+            for (int i = 0; i < per_producer; ++i) {
+                while (!queue.try_push(p * per_producer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        threads.emplace_back([&]() {
+            int value = 0;
+            while (consumed_count.load() < producers * per_producer) {
+                if (queue.try_pop(value)) {
+                    consumed_sum.fetch_add(value);
+                    consumed_count.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const long long n = producers * per_producer;
+    EXPECT_EQ(consumed_count.load(), n);
+    EXPECT_EQ(consumed_sum.load(), n * (n - 1) / 2);
+}
+
+class AsyncPersistenceWriterTest : public ::testing::Test {
+protected:
+    AsyncPersistenceWriter::BatchSink recording_sink() {
+        return [this](const PersistenceBatch& batch) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (fail_commits_) {
+                return false;
+            }
+            batch_sizes_.push_back(batch.size());
+            for (const auto& row : batch.orders) {
+                order_ids_.push_back(row.order_id);
+            }
+            trade_count_ += batch.trades.size();
+            position_count_ += batch.positions.size();
+            return true;
+        };
+    }
+
+    static Order make_order(int index) {
+        return Order("ORD" + std::to_string(index), "AAPL", OrderSide::BUY, OrderType::LIMIT, 100.0, 150.0);
+    }
+
+    std::mutex mutex_;
+    bool fail_commits_ = false;
+    std::vector<size_t> batch_sizes_;
+    std::vector<std::string> order_ids_;
+    size_t trade_count_ = 0;
+    size_t position_count_ = 0;
+};
+
+TEST_F(AsyncPersistenceWriterTest, BatchesRowsAndAdvancesWatermark) {
+    AsyncPersistenceWriter::Config config;
+    config.batch_size = 64;
+    config.flush_interval = 50ms;
+    AsyncPersistenceWriter writer(recording_sink(), config);
+    ASSERT_TRUE(writer.start());
+
+    uint64_t last_sequence = 0;
+    for (int i = 0; i < 1000; ++i) {
+        last_sequence = writer.enqueue_order(make_order(i));
+    }
+    last_sequence = writer.enqueue_trade(Trade("T1", "ORD1", "AAPL", OrderSide::BUY, 100.0, 150.0));
+    last_sequence = writer.enqueue_position(Position("AAPL"));
+    EXPECT_EQ(last_sequence, 1002u);
+
+    ASSERT_TRUE(writer.wait_for_durable(last_sequence, 2000ms));
+    EXPECT_EQ(writer.get_durable_sequence(), 1002u);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT_EQ(order_ids_.size(), 1000u);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(order_ids_[static_cast<size_t>(i)], "ORD" + std::to_string(i));
+    }
+    EXPECT_EQ(trade_count_, 1u);
+    EXPECT_EQ(position_count_, 1u);
+    for (size_t size : batch_sizes_) {
+        EXPECT_LE(size, 64u);
+    }
+    EXPECT_LT(batch_sizes_.size(), 1002u); // Rows were grouped
+}
+
+TEST_F(AsyncPersistenceWriterTest, FlushesPartialBatchOnInterval) {
+    AsyncPersistenceWriter::Config config;
+    config.batch_size = 1000;
+    config.flush_interval = 5ms;
+    AsyncPersistenceWriter writer(recording_sink(), config);
+    writer.start();
+
+    uint64_t sequence = writer.enqueue_order(make_order(1));
+    std::this_thread::sleep_for(200ms);
+    EXPECT_GE(writer.get_durable_sequence(), sequence);
+}
+
+TEST_F(AsyncPersistenceWriterTest, StopDrainsQueue) {
+    AsyncPersistenceWriter::Config config;
+    config.batch_size = 16;
+    config.flush_interval = 1000ms;
+    AsyncPersistenceWriter writer(recording_sink(), config);
+    writer.start();
+
+    for (int i = 0; i < 100; ++i) {
+        writer.enqueue_order(make_order(i));
+    }
+    writer.stop();
+
+    EXPECT_EQ(writer.get_durable_sequence(), 100u);
+    EXPECT_EQ(writer.get_statistics().records_written, 100u);
+    EXPECT_EQ(writer.enqueue_order(make_order(101)), 0u); // Not accepted once stopped
+}
+
+TEST_F(AsyncPersistenceWriterTest, FailedBatchStallsWatermark) {
+    fail_commits_ = true;
+    AsyncPersistenceWriter::Config config;
+    config.batch_size = 8;
+    config.flush_interval = 1ms;
+    config.max_commit_attempts = 2;
+    AsyncPersistenceWriter writer(recording_sink(), config);
+    writer.start();
+
+    uint64_t sequence = writer.enqueue_order(make_order(1));
+    EXPECT_FALSE(writer.wait_for_durable(sequence, 100ms));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fail_commits_ = false;
+    }
+    uint64_t later = writer.enqueue_order(make_order(2));
+    EXPECT_FALSE(writer.wait_for_durable(later, 100ms));
+    EXPECT_EQ(writer.get_durable_sequence(), 0u);
+    EXPECT_EQ(writer.get_statistics().records_failed, 1u);
+    EXPECT_TRUE(writer.is_durability_stalled());
+    EXPECT_TRUE(writer.get_statistics().durability_stalled);
+}
+
+TEST_F(AsyncPersistenceWriterTest, FullQueueRejectsAfterBoundedWait) {
+    std::atomic<bool> release{false};
+    AsyncPersistenceWriter::Config config;
+    config.batch_size = 1;
+    config.queue_capacity = 4;
+    config.flush_interval = 1ms;
+    config.enqueue_timeout = 20ms;
+    AsyncPersistenceWriter writer([&release](const PersistenceBatch&) {
+        while (!release.load()) {
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    }, config);
+    writer.start();
+
+    // The writer blocks in its first commit, so the queue fills and the next row is turned away
+    uint64_t accepted = 0;
+    auto started = std::chrono::steady_clock::now();
+    for (int i = 0; i < 10 && writer.enqueue_order(make_order(i)) != 0; ++i) {
+        ++accepted;
+    }
+    auto waited = std::chrono::steady_clock::now() - started;
+    EXPECT_LT(accepted, 10u);
+    EXPECT_LT(waited, 1000ms);
+    EXPECT_EQ(writer.get_statistics().records_rejected, 1u);
+
+    release.store(true);
+    ASSERT_TRUE(writer.flush(2000ms));
+    EXPECT_EQ(writer.get_durable_sequence(), accepted);
+    EXPECT_NE(writer.enqueue_order(make_order(100)), 0u);
+    EXPECT_FALSE(writer.is_durability_stalled());
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "infrastructure/persistence/backup_scheduler.hpp"
+
+using namespace trading;
+using namespace std::chrono_literals;
+
+class BackupSchedulerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory_ = std::filesystem::temp_directory_path() /
+                     ("backup_scheduler_test_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        config_.directory = directory_.string();
+        config_.max_files = 2;
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(directory_, ec);
+    }
+
+    BackupScheduler::BackupFn writing_backup() {
+        return [this](const std::string& filepath) {
+            std::filesystem::create_directories(directory_);
+            std::ofstream(filepath) << "backup " << backups_taken_.fetch_add(1);
+            return true;
+        };
+    }
+
+    std::filesystem::path directory_;
+    BackupScheduler::Config config_;
+    std::atomic<int> backups_taken_{0};
+};
+
+TEST_F(BackupSchedulerTest, RotationKeepsNewestFiles) {
+    BackupScheduler scheduler(writing_backup(), config_);
+
+    std::string first = scheduler.run_once();
+    std::this_thread::sleep_for(5ms);
+    std::string second = scheduler.run_once();
+    std::this_thread::sleep_for(5ms);
+    std::string third = scheduler.run_once();
+
+    auto backups = scheduler.list_backups();
+    ASSERT_EQ(backups.size(), 2u);
+    EXPECT_EQ(backups[0], third);
+    EXPECT_EQ(backups[1], second);
+    EXPECT_FALSE(std::filesystem::exists(first));
+    EXPECT_EQ(scheduler.get_statistics().backups_completed, 3u);
+    EXPECT_EQ(scheduler.get_statistics().last_backup_path, third);
+}
+
+TEST_F(BackupSchedulerTest, FailedBackupIsCountedAndNotRotated) {
+    BackupScheduler scheduler([](const std::string&) { return false; }, config_);
+
+    EXPECT_TRUE(scheduler.run_once().empty());
+    EXPECT_EQ(scheduler.get_statistics().backups_failed, 1u);
+    EXPECT_TRUE(scheduler.list_backups().empty());
+}
+
+TEST_F(BackupSchedulerTest, FirstBackupRunsImmediatelyWhenNoneExist) {
+    config_.interval = 3600s;
+    BackupScheduler scheduler(writing_backup(), config_);
+    ASSERT_TRUE(scheduler.start());
+
+    for (int i = 0; i < 200 && backups_taken_.load() == 0; ++i) {
+        std::this_thread::sleep_for(10ms);
+    }
+    scheduler.stop();
+    EXPECT_EQ(backups_taken_.load(), 1);
+}
+
+TEST_F(BackupSchedulerTest, RecentBackupDefersTheFirstRun) {
+    config_.interval = 3600s;
+    {
+        BackupScheduler scheduler(writing_backup(), config_);
+        ASSERT_FALSE(scheduler.run_once().empty());
+    }
+
+    BackupScheduler scheduler(writing_backup(), config_);
+    ASSERT_TRUE(scheduler.start());
+    std::this_thread::sleep_for(100ms);
+    scheduler.stop();
+    EXPECT_EQ(backups_taken_.load(), 1);
+}
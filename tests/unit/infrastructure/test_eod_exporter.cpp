@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "infrastructure/persistence/eod_exporter.hpp"
+
+using namespace trading;
+
+class EodExporterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory_ = std::filesystem::temp_directory_path() /
+                     ("eod_exporter_test_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        config_.directory = directory_.string();
+        config_.thread_count = 4;
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(directory_, ec);
+    }
+
+    static TradeRow trade(const std::string& id, const std::string& symbol, double price, std::int64_t time) {
+        return TradeRow{id, "ORD_" + id, symbol, 0, 10.0, price, time, 0};
+    }
+
+    static std::string read_file(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    std::filesystem::path directory_;
+    EodExporter::Config config_;
+};
+
+TEST_F(EodExporterTest, CsvPartitionsBySymbol) {
+    EodExporter exporter(nullptr, config_);
+
+    std::vector<TradeRow> trades = {
+        trade("T1", "AAPL", 150.25, 1000),
+        trade("T2", "MSFT", 300.5, 1001),
+        trade("T3", "AAPL", 151.0, 1002),
+    };
+    OrderRow order{"O1", "BRK/B", 1, 1, 5.0, 400.0, 5, 0.0, 0.0, 990, 995, "Price band, \"wide\""};
+
+    auto report = exporter.export_rows(directory_.string(), trades, {order});
+    ASSERT_TRUE(report.success);
+    EXPECT_EQ(report.trade_rows, 3u);
+    EXPECT_EQ(report.order_rows, 1u);
+    EXPECT_EQ(report.files_written, 3u);
+
+    EXPECT_EQ(read_file(directory_ / "trades_AAPL.csv"),
+              "trade_id,order_id,instrument_symbol,side,quantity,price,execution_time,type\n"
+              "T1,ORD_T1,AAPL,BUY,10,150.25,1000,FULL_FILL\n"
+              "T3,ORD_T3,AAPL,BUY,10,151,1002,FULL_FILL\n");
+    EXPECT_TRUE(std::filesystem::exists(directory_ / "trades_MSFT.csv"));
+
+    std::string orders = read_file(directory_ / "orders_BRK_B.csv");
+    EXPECT_NE(orders.find("O1,BRK/B,SELL,LIMIT,5,400,REJECTED,0,0,990,995,\"Price band, \"\"wide\"\"\"\n"),
+              std::string::npos);
+}
+
+TEST_F(EodExporterTest, SymbolsSharingAFileNameGetSeparateFiles) {
+    EodExporter exporter(nullptr, config_);
+
+    auto report = exporter.export_rows(directory_.string(),
+                                       {trade("T1", "A/B", 10.0, 1000), trade("T2", "A_B", 20.0, 1001)}, {});
+    ASSERT_TRUE(report.success);
+    EXPECT_EQ(report.files_written, 2u);
+
+    std::string first = read_file(directory_ / "trades_A_B.csv");
+    std::string second = read_file(directory_ / "trades_A_B~2.csv");
+    EXPECT_NE(first.find("T1,ORD_T1,A/B,"), std::string::npos);
+    EXPECT_NE(second.find("T2,ORD_T2,A_B,"), std::string::npos);
+}
+
+TEST_F(EodExporterTest, ColumnarLayout) {
+    config_.format = ExportFormat::COLUMNAR;
+    EodExporter exporter(nullptr, config_);
+
+    auto report = exporter.export_rows(directory_.string(), {trade("T1", "AAPL", 150.25, 1000), trade("T22", "AAPL", 99.5, 1001)}, {});
+    ASSERT_TRUE(report.success);
+
+    std::string data = read_file(directory_ / "trades_AAPL.col");
+    ASSERT_GT(data.size(), 24u);
+    EXPECT_EQ(std::memcmp(data.data(), "TSCOLS\0\0", 8), 0);
+    std::uint32_t column_count = 0;
+    std::uint64_t row_count = 0;
+    std::memcpy(&column_count, data.data() + 12, sizeof(column_count));
+    std::memcpy(&row_count, data.data() + 16, sizeof(row_count));
+    EXPECT_EQ(column_count, 8u);
+    EXPECT_EQ(row_count, 2u);
+
+    // First column: trade_id strings as offsets then bytes
+    size_t pos = 24;
+    std::uint16_t name_length = 0;
+    std::memcpy(&name_length, data.data() + pos, sizeof(name_length));
+    pos += sizeof(name_length);
+    EXPECT_EQ(data.substr(pos, name_length), "trade_id");
+    pos += name_length;
+    EXPECT_EQ(static_cast<int>(data[pos]), 3);
+    pos += 1;
+    std::uint32_t offsets[3];
+    std::memcpy(offsets, data.data() + pos, sizeof(offsets));
+    pos += sizeof(offsets);
+    EXPECT_EQ(offsets[2], 5u);
+    EXPECT_EQ(data.substr(pos + offsets[1], offsets[2] - offsets[1]), "T22");
+}
+
+TEST_F(EodExporterTest, EmptyDayWritesNothing) {
+    EodExporter exporter(nullptr, config_);
+    auto report = exporter.export_rows(directory_.string(), {}, {});
+    EXPECT_TRUE(report.success);
+    EXPECT_EQ(report.files_written, 0u);
+
+    EXPECT_FALSE(exporter.export_day(std::chrono::system_clock::now()).success);   // No database to read from
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "infrastructure/persistence/event_journal.hpp"
+#include "infrastructure/persistence/journal_compactor.hpp"
+#include "core/models/order.hpp"
+#include "core/models/trade.hpp"
+#include "core/models/position.hpp"
+
+using namespace trading;
+using namespace std::chrono_literals;
+
+class EventJournalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory_ = std::filesystem::temp_directory_path() /
+                     ("event_journal_test_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        config_.directory = directory_.string();
+        config_.segment_size_bytes = 1024 * JournalRecord::SIZE;
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(directory_, ec);
+    }
+
+    static Order make_order(int index) {
+        return Order("ORD" + std::to_string(index), "AAPL", OrderSide::BUY, OrderType::LIMIT, 100.0, 150.0);
+    }
+
+    std::filesystem::path first_segment() const {
+        for (const auto& entry : std::filesystem::directory_iterator(directory_)) {
+            if (entry.path().extension() == ".log") {
+                return entry.path();
+            }
+        }
+        return {};
+    }
+
+    std::filesystem::path directory_;
+    EventJournal::Config config_;
+};
+
+TEST_F(EventJournalTest, AppendedRecordsAreDurableAndReadBack) {
+    EventJournal journal(config_);
+    ASSERT_TRUE(journal.open());
+
+    Order order = make_order(1);
+    ASSERT_TRUE(order.accept());
+    ASSERT_TRUE(order.partial_fill(40.0, 149.5));
+    EXPECT_EQ(journal.append_order(order), 1u);
+    EXPECT_EQ(journal.append_trade(Trade("T1", "ORD1", "AAPL", OrderSide::BUY, 40.0, 149.5)), 2u);
+    Position position("AAPL");
+    EXPECT_EQ(journal.append_position(position), 3u);
+    ASSERT_TRUE(journal.flush(2000ms));
+    EXPECT_EQ(journal.get_durable_sequence(), 3u);
+
+    PersistenceBatch batch;
+    EXPECT_EQ(journal.read_batch(1, 100, batch), 3u);
+    ASSERT_EQ(batch.orders.size(), 1u);
+    EXPECT_EQ(batch.orders[0].order_id, "ORD1");
+    EXPECT_EQ(batch.orders[0].instrument_symbol, "AAPL");
+    EXPECT_DOUBLE_EQ(batch.orders[0].filled_quantity, 40.0);
+    EXPECT_EQ(batch.orders[0].status, static_cast<int>(order.get_status()));
+    ASSERT_EQ(batch.trades.size(), 1u);
+    EXPECT_EQ(batch.trades[0].trade_id, "T1");
+    EXPECT_DOUBLE_EQ(batch.trades[0].price, 149.5);
+    ASSERT_EQ(batch.positions.size(), 1u);
+    EXPECT_EQ(batch.positions[0].instrument_symbol, "AAPL");
+}
+
+TEST_F(EventJournalTest, RejectsIdsThatDoNotFitTheRecord) {
+    EventJournal journal(config_);
+    ASSERT_TRUE(journal.open());
+
+    Order order(std::string(JournalRecord::ID_SIZE, 'X'), "AAPL", OrderSide::BUY, OrderType::LIMIT, 100.0, 150.0);
+    EXPECT_EQ(journal.append_order(order), 0u);
+    EXPECT_EQ(journal.get_appended_sequence(), 0u);
+}
+
+TEST_F(EventJournalTest, ReopenContinuesAfterLastRecord) {
+    {
+        EventJournal journal(config_);
+        ASSERT_TRUE(journal.open());
+        for (int i = 0; i < 10; ++i) {
+            journal.append_order(make_order(i));
+        }
+        journal.close();
+    }
+
+    EventJournal journal(config_);
+    ASSERT_TRUE(journal.open());
+    EXPECT_EQ(journal.get_durable_sequence(), 10u);
+    EXPECT_EQ(journal.append_order(make_order(10)), 11u);
+    ASSERT_TRUE(journal.flush(2000ms));
+
+    PersistenceBatch batch;
+    EXPECT_EQ(journal.read_batch(1, 100, batch), 11u);
+    EXPECT_EQ(batch.orders.back().order_id, "ORD10");
+}
+
+TEST_F(EventJournalTest, TornTailIsDiscardedOnRecovery) {
+    {
+        EventJournal journal(config_);
+        ASSERT_TRUE(journal.open());
+        for (int i = 0; i < 5; ++i) {
+            journal.append_order(make_order(i));
+        }
+        journal.close();
+    }
+
+    // Flip a payload byte in the fifth record
+    std::FILE* file = std::fopen(first_segment().string().c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    std::fseek(file, static_cast<long>(4 * JournalRecord::SIZE + 100), SEEK_SET);
+    std::fputc(0x5A, file);
+    std::fclose(file);
+
+    EventJournal journal(config_);
+    ASSERT_TRUE(journal.open());
+    EXPECT_EQ(journal.get_durable_sequence(), 4u);
+    EXPECT_EQ(journal.append_order(make_order(99)), 5u);
+    ASSERT_TRUE(journal.flush(2000ms));
+
+    PersistenceBatch batch;
+    EXPECT_EQ(journal.read_batch(1, 100, batch), 5u);
+    EXPECT_EQ(batch.orders.back().order_id, "ORD99");
+}
+
+TEST_F(EventJournalTest, CompactorFoldsRecordsAndRemovesSegments) {
+    config_.segment_size_bytes = 4 * JournalRecord::SIZE;
+    auto journal = std::make_shared<EventJournal>(config_);
+    ASSERT_TRUE(journal->open());
+
+    Order order = make_order(1);
+    for (int i = 0; i < 9; ++i) {
+        journal->append_order(order);   // Same order rewritten as it changes
+    }
+    journal->append_trade(Trade("T1", "ORD1", "AAPL", OrderSide::BUY, 100.0, 150.0));
+    ASSERT_TRUE(journal->flush(2000ms));
+    EXPECT_EQ(journal->get_segment_count(), 3u);
+
+    size_t orders_written = 0;
+    size_t trades_written = 0;
+    JournalCompactor compactor(journal, [&](const PersistenceBatch& batch) {
+        orders_written += batch.orders.size();
+        trades_written += batch.trades.size();
+        return true;
+    }, JournalCompactor::Config{});
+
+    EXPECT_EQ(compactor.compact_once(), 10u);
+    EXPECT_EQ(orders_written, 1u);       // Folded to the latest row
+    EXPECT_EQ(trades_written, 1u);
+    EXPECT_EQ(journal->get_compacted_sequence(), 10u);
+    EXPECT_EQ(journal->get_segment_count(), 1u);  // Only the active segment remains
+    EXPECT_EQ(compactor.compact_once(), 0u);
+}
+
+TEST_F(EventJournalTest, FailedCompactionKeepsCheckpoint) {
+    auto journal = std::make_shared<EventJournal>(config_);
+    ASSERT_TRUE(journal->open());
+    journal->append_order(make_order(1));
+    ASSERT_TRUE(journal->flush(2000ms));
+
+    bool accept = false;
+    JournalCompactor compactor(journal, [&](const PersistenceBatch&) { return accept; }, JournalCompactor::Config{});
+    EXPECT_EQ(compactor.compact_once(), 0u);
+    EXPECT_EQ(journal->get_compacted_sequence(), 0u);
+
+    accept = true;
+    EXPECT_EQ(compactor.compact_once(), 1u);
+    EXPECT_EQ(journal->get_compacted_sequence(), 1u);
+
+    // The checkpoint survives a restart
+    journal->close();
+    EventJournal reopened(config_);
+    ASSERT_TRUE(reopened.open());
+    EXPECT_EQ(reopened.get_compacted_sequence(), 1u);
+}
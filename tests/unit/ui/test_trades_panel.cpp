@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "ui/components/trades_panel.hpp"
+
+using namespace trading::ui;
+
+namespace {
+
+TradeRow make_trade(const std::string& trade_id, const std::string& symbol, const std::string& side,
+                    std::chrono::system_clock::time_point time) {
+    TradeRow row{};
+    row.trade_id = trade_id;
+    row.order_id = "ORD_" + trade_id;
+    row.symbol = symbol;
+    row.side = side;
+    row.quantity = 10.0;
+    row.price = 100.0;
+    row.notional_value = 1000.0;
+    row.execution_time = time;
+    return row;
+}
+
+} // namespace
+
+class TradesPanelTest : public ::testing::Test {
+protected:
+    std::chrono::system_clock::time_point at(int seconds) const {
+        return start_ + std::chrono::seconds(seconds);
+    }
+
+    std::chrono::system_clock::time_point start_ = std::chrono::system_clock::now();
+    TradesPanel panel_;
+};
+
+TEST_F(TradesPanelTest, AppendKeepsNewestFirst) {
+    panel_.append_data({make_trade("T1", "AAPL", "BUY", at(1)), make_trade("T2", "MSFT", "SELL", at(2))});
+    panel_.append_data({make_trade("T3", "AAPL", "SELL", at(3))});
+
+    ASSERT_EQ(panel_.get_filtered_count(), 3u);
+    EXPECT_EQ(panel_.get_displayed_trade(0).trade_id, "T3");
+    EXPECT_EQ(panel_.get_displayed_trade(2).trade_id, "T1");
+}
+
+TEST_F(TradesPanelTest, LateTradeIsPlacedByExecutionTime) {
+    panel_.append_data({make_trade("T1", "AAPL", "BUY", at(1)), make_trade("T3", "AAPL", "BUY", at(3))});
+    panel_.append_data({make_trade("T2", "AAPL", "BUY", at(2))});
+
+    ASSERT_EQ(panel_.get_filtered_count(), 3u);
+    EXPECT_EQ(panel_.get_displayed_trade(0).trade_id, "T3");
+    EXPECT_EQ(panel_.get_displayed_trade(1).trade_id, "T2");
+    EXPECT_EQ(panel_.get_displayed_trade(2).trade_id, "T1");
+}
+
+TEST_F(TradesPanelTest, AppendMatchesFullUpdate) {
+    std::vector<TradeRow> all;
+    for (int i = 0; i < 20; ++i) {
+        all.push_back(make_trade("T" + std::to_string(i), i % 2 ? "AAPL" : "MSFT", i % 3 ? "BUY" : "SELL",
+                                 at(i % 7 == 0 ? i - 3 : i)));
+    }
+
+    TradesPanel incremental;
+    for (const auto& trade : all) {
+        incremental.append_data({trade});
+    }
+    panel_.update_data(all);
+
+    ASSERT_EQ(incremental.get_trade_count(), panel_.get_trade_count());
+    ASSERT_EQ(incremental.get_filtered_count(), panel_.get_filtered_count());
+    for (size_t i = 0; i < panel_.get_filtered_count(); ++i) {
+        EXPECT_EQ(incremental.get_displayed_trade(i).execution_time, panel_.get_displayed_trade(i).execution_time);
+    }
+}
+
+TEST_F(TradesPanelTest, ClearDropsAllRows) {
+    panel_.append_data({make_trade("T1", "AAPL", "BUY", at(1))});
+    panel_.clear_data();
+    EXPECT_EQ(panel_.get_trade_count(), 0u);
+    EXPECT_EQ(panel_.get_filtered_count(), 0u);
+}
@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ui/models/ui_data_model.hpp"
+#include "core/models/market_tick.hpp"
+#include "core/models/position.hpp"
+#include "core/models/trade.hpp"
+
+using namespace trading;
+using namespace trading::ui;
+
+namespace {
+
+ExecutionReport make_report(const std::string& order_id, OrderStatus status, double filled) {
+    ExecutionReport report;
+    report.order_id = order_id;
+    report.symbol = "AAPL";
+    report.side = OrderSide::BUY;
+    report.type = OrderType::LIMIT;
+    report.quantity = 100.0;
+    report.price = 150.0;
+    report.old_status = OrderStatus::NEW;
+    report.new_status = status;
+    report.filled_quantity = filled;
+    report.remaining_quantity = 100.0 - filled;
+    report.execution_price = 150.0;
+    report.created_time = std::chrono::system_clock::now();
+    report.timestamp = report.created_time;
+    return report;
+}
+
+} // namespace
+
+TEST(TripleBufferTest, ConsumerSeesOnlyTheLatestPublication) {
+    TripleBuffer<int> buffer;
+    EXPECT_FALSE(buffer.update_front());
+
+    buffer.write([](int& back) { back = 1; });
+    buffer.write([](int& back) { back = 2; });
+    ASSERT_TRUE(buffer.update_front());
+    EXPECT_EQ(buffer.front(), 2);
+
+    // Nothing new since the last pickup
+    EXPECT_FALSE(buffer.update_front());
+    EXPECT_EQ(buffer.front(), 2);
+}
+
+TEST(TripleBufferTest, ConcurrentProducerNeverTearsASnapshot) {
+    struct Pair { uint64_t a = 0; uint64_t b = 0; };
+    TripleBuffer<Pair> buffer;
+    std::atomic<bool> done{false};
+    std::thread producer([&]() {
+        for (uint64_t i = 1; i <= 200000; ++i) {
+            buffer.write([i](Pair& back) { back.a = i; back.b = i; });
+        }
+        done = true;
+    });
+
+    uint64_t last = 0;
+    for (;;) {
+        bool finished = done.load();
+        buffer.update_front();
+        const Pair& front = buffer.front();
+        ASSERT_EQ(front.a, front.b);
+        ASSERT_GE(front.a, last);
+        last = front.a;
+        if (finished) {
+            break;
+        }
+    }
+    producer.join();
+    EXPECT_EQ(buffer.front().a, 200000u);
+}
+
+TEST(UIDataModelTest, SyncPicksUpLatestQuotePerSymbol) {
+    UIDataModel model;
+    model.publish_quote(MarketTick("AAPL", 150.0, 150.1, 150.05, 100.0));
+    model.publish_quote(MarketTick("MSFT", 300.0, 300.2, 300.1, 50.0));
+    model.publish_quote(MarketTick("AAPL", 151.0, 151.1, 151.05, 200.0));
+
+    auto changes = model.sync();
+    EXPECT_TRUE(changes.quotes);
+    EXPECT_FALSE(changes.trades);
+    ASSERT_EQ(model.quotes().size(), 2u);
+    EXPECT_DOUBLE_EQ(model.quotes()[0].bid_price, 151.0);
+    EXPECT_EQ(model.quotes_published(), 3u);
+
+    auto row = UIDataModel::to_row(model.quotes()[1]);
+    EXPECT_EQ(row.symbol, "MSFT");
+    EXPECT_NEAR(row.spread, 0.2, 1e-9);
+
+    EXPECT_FALSE(model.sync().any());
+}
+
+TEST(UIDataModelTest, OrderUpdatesArriveAsSequencedDeltas) {
+    UIDataModel model;
+    model.publish_order(make_report("ORD_1", OrderStatus::ACCEPTED, 0.0));
+    model.publish_order(make_report("ORD_2", OrderStatus::ACCEPTED, 0.0));
+    ASSERT_TRUE(model.sync().orders);
+    ASSERT_EQ(model.order_updates().size(), 2u);
+    EXPECT_EQ(model.order_updates()[0].sequence, 1u);
+    EXPECT_EQ(model.order_updates()[1].sequence, 2u);
+
+    auto row = UIDataModel::to_row(model.order_updates()[0]);
+    EXPECT_EQ(row.side, "BUY");
+    EXPECT_EQ(row.type, "LIMIT");
+    EXPECT_EQ(row.status, "ACCEPTED");
+
+    // Only what was published since the last sync
+    model.publish_order(make_report("ORD_1", OrderStatus::FILLED, 100.0));
+    ASSERT_TRUE(model.sync().orders);
+    ASSERT_EQ(model.order_updates().size(), 1u);
+    EXPECT_EQ(model.order_updates()[0].order_id, "ORD_1");
+    EXPECT_EQ(model.order_updates()[0].status, OrderStatus::FILLED);
+    EXPECT_EQ(model.order_updates()[0].sequence, 3u);
+
+    EXPECT_FALSE(model.sync().orders);
+    EXPECT_TRUE(model.order_updates().empty());
+}
+
+TEST(UIDataModelTest, EachTradeIsDeliveredExactlyOnce) {
+    UIDataModel model;
+    std::vector<std::string> received;
+    for (int i = 0; i < 50; ++i) {
+        model.publish_trade(Trade("TRD_" + std::to_string(i), "ORD_" + std::to_string(i), "AAPL",
+                                  OrderSide::SELL, 10.0, 150.0 + i));
+        if (i % 3 == 0) {
+            model.sync();
+            for (const auto& trade : model.new_trades()) {
+                received.push_back(trade.trade_id);
+            }
+        }
+    }
+    model.sync();
+    for (const auto& trade : model.new_trades()) {
+        received.push_back(trade.trade_id);
+    }
+
+    ASSERT_EQ(received.size(), 50u);
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ(received[static_cast<size_t>(i)], "TRD_" + std::to_string(i));
+    }
+}
+
+TEST(UIDataModelTest, ConcurrentTradesAreNeitherLostNorRepeated) {
+    UIDataModel model;
+    constexpr int per_thread = 5000;
+    std::atomic<int> finished{0};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 2; ++t) {
+        producers.emplace_back([&model, &finished, t]() {
+            for (int i = 0; i < per_thread; ++i) {
+                model.publish_trade(Trade("TRD_" + std::to_string(t) + "_" + std::to_string(i), "ORD", "AAPL",
+                                          OrderSide::BUY, 1.0, 100.0));
+            }
+            finished.fetch_add(1);
+        });
+    }
+
+    size_t received = 0;
+    uint64_t last_sequence = 0;
+    auto drain = [&]() {
+        model.sync();
+        for (const auto& trade : model.new_trades()) {
+            ASSERT_GT(trade.sequence, last_sequence);
+            last_sequence = trade.sequence;
+            ++received;
+        }
+    };
+    while (finished.load() < 2) {
+        drain();
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    drain();
+    EXPECT_EQ(received, static_cast<size_t>(2 * per_thread));
+    EXPECT_EQ(last_sequence, static_cast<uint64_t>(2 * per_thread));
+}
+
+TEST(UIDataModelTest, UnsyncedDeltasAreCappedKeepingTheNewest) {
+    UIDataModel model;
+    const size_t published = UIDataModel::MAX_PENDING_DELTAS + 100;
+    for (size_t i = 1; i <= published; ++i) {
+        model.publish_trade(Trade("TRD_" + std::to_string(i), "ORD", "AAPL", OrderSide::BUY, 1.0, 100.0));
+    }
+
+    ASSERT_TRUE(model.sync().trades);
+    auto trades = model.new_trades();
+    ASSERT_EQ(trades.size(), UIDataModel::MAX_PENDING_DELTAS);
+    EXPECT_EQ(trades.front().sequence, published - UIDataModel::MAX_PENDING_DELTAS + 1);
+    EXPECT_EQ(trades.back().trade_id, "TRD_" + std::to_string(published));
+
+    // Once acknowledged, later publishes carry only the new delta
+    model.publish_trade(Trade("TRD_NEXT", "ORD", "AAPL", OrderSide::BUY, 1.0, 100.0));
+    ASSERT_TRUE(model.sync().trades);
+    ASSERT_EQ(model.new_trades().size(), 1u);
+    EXPECT_EQ(model.new_trades().front().trade_id, "TRD_NEXT");
+}
+
+TEST(UIDataModelTest, PositionRowsValueAtCurrentPrice) {
+    UIDataModel model;
+    Position position("AAPL");
+    position.add_trade(100.0, 150.0);
+    model.publish_position(position);
+    ASSERT_TRUE(model.sync().positions);
+    ASSERT_EQ(model.positions().size(), 1u);
+
+    auto row = UIDataModel::to_row(model.positions()[0], 155.0);
+    EXPECT_DOUBLE_EQ(row.market_value, 15500.0);
+    EXPECT_DOUBLE_EQ(row.unrealized_pnl, 500.0);
+    EXPECT_DOUBLE_EQ(row.total_pnl, 500.0);
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+
+#include "utils/async_logging.hpp"
+
+using namespace trading;
+
+namespace {
+
+template<typename... Args>
+LogRecord make_record(const char* format, const Args&... args) {
+    LogRecord record;
+    record.format = format;
+    (record.add(args), ...);
+    return record;
+}
+
+} // namespace
+
+TEST(AsyncLoggingTest, RecordFormatsCapturedArguments) {
+    std::string order_id = "ORD_42";
+    auto record = make_record("Order {} {}: qty={} px={} ok={} side={} {{literal}}", order_id, "filled",
+                              static_cast<uint64_t>(100), 150.25, true, 'B');
+    EXPECT_EQ(record.to_string(), "Order ORD_42 filled: qty=100 px=150.25 ok=true side=B {literal}");
+
+    // Missing arguments leave the placeholder in place
+    EXPECT_EQ(make_record("{} and {}", -7).to_string(), "-7 and {}");
+}
+
+TEST(AsyncLoggingTest, RecordTruncatesTextAndArguments) {
+    std::string long_text(LogRecord::TEXT_CAPACITY + 50, 'x');
+    auto record = make_record("{}|{}", long_text, "dropped");
+    EXPECT_EQ(record.to_string(), std::string(LogRecord::TEXT_CAPACITY, 'x') + "|");
+
+    auto many = make_record("{}{}{}{}{}{}{}{}{}", 1, 2, 3, 4, 5, 6, 7, 8, 9);
+    EXPECT_EQ(many.arg_count, LogRecord::MAX_ARGS);
+    EXPECT_EQ(many.to_string(), "12345678{}");
+}
+
+TEST(AsyncLoggingTest, RecordReportsSuppressedCount) {
+    auto record = make_record("Rejected {}", "ORD_1");
+    record.suppressed = 12;
+    EXPECT_EQ(record.to_string(), "Rejected ORD_1 [12 similar messages suppressed]");
+}
+
+TEST(AsyncLoggingTest, RateLimiterCountsSuppressedCalls) {
+    LogRateLimiter limiter(3);
+    uint32_t suppressed = 99;
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(limiter.allow(suppressed));
+        EXPECT_EQ(suppressed, 0u);
+    }
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_FALSE(limiter.allow(suppressed));
+    }
+}
+
+TEST(AsyncLoggingTest, StartStopAndFlushAreIdempotent) {
+    ASSERT_TRUE(AsyncLogger::start());
+    EXPECT_TRUE(AsyncLogger::is_running());
+    EXPECT_TRUE(AsyncLogger::start());
+
+    // With no sinks configured nothing is queued, so flush returns at once
+    ASYNC_LOG_INFO("Order {} accepted", "ORD_1");
+    EXPECT_TRUE(AsyncLogger::flush(std::chrono::milliseconds(100)));
+
+    AsyncLogger::stop();
+    AsyncLogger::stop();
+    EXPECT_FALSE(AsyncLogger::is_running());
+    EXPECT_EQ(AsyncLogger::get_statistics().records_dropped, 0u);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "utils/binary_event_log.hpp"
+
+using namespace trading;
+
+class BinaryEventLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory_ = std::filesystem::temp_directory_path() /
+                     ("binary_event_log_test_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        config_.directory = directory_.string();
+        config_.segment_size_bytes = 64 * 1024;
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(directory_, ec);
+    }
+
+    // Every record in every segment, oldest first
+    std::vector<std::pair<EventRecordHeader, std::vector<std::uint8_t>>> read_all() const {
+        std::vector<std::pair<EventRecordHeader, std::vector<std::uint8_t>>> records;
+        for (const auto& segment : BinaryEventLog::list_segments(config_.directory)) {
+            EXPECT_TRUE(BinaryEventLog::read_segment(segment, [&](const EventRecordHeader& header,
+                                                                   const std::uint8_t* payload) {
+                records.emplace_back(header, std::vector<std::uint8_t>(payload, payload + header.size - sizeof(header)));
+                return true;
+            }));
+        }
+        return records;
+    }
+
+    std::filesystem::path directory_;
+    BinaryEventLog::Config config_;
+};
+
+TEST_F(BinaryEventLogTest, RecordsRoundTripThroughSegment) {
+    BinaryEventLog log(config_);
+    ASSERT_TRUE(log.open());
+    EXPECT_TRUE(log.log_order("ORD_1", "AAPL", 0, 1, 2, 100.0, 150.25, 40.0));
+    EXPECT_TRUE(log.log_trade("TRD_1", "ORD_1", "AAPL", 0, 0, 40.0, 150.25));
+    EXPECT_TRUE(log.log_market_data("MSFT", 299.5, 300.5, 300.0, 1200.0,
+                                    std::chrono::system_clock::time_point(std::chrono::nanoseconds(42))));
+    log.close();
+
+    auto records = read_all();
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_EQ(records[0].first.schema_id, static_cast<std::uint16_t>(EventSchema::ORDER));
+    EXPECT_EQ(records[0].first.size % 8, 0u);
+
+    OrderEventFields order;
+    std::memcpy(&order, records[0].second.data(), sizeof(order));
+    EXPECT_STREQ(order.order_id, "ORD_1");
+    EXPECT_STREQ(order.symbol, "AAPL");
+    EXPECT_EQ(order.status, 2);
+    EXPECT_DOUBLE_EQ(order.filled_quantity, 40.0);
+
+    EXPECT_EQ(records[1].first.schema_id, static_cast<std::uint16_t>(EventSchema::TRADE));
+    MarketDataFields tick;
+    std::memcpy(&tick, records[2].second.data(), sizeof(tick));
+    EXPECT_STREQ(tick.symbol, "MSFT");
+    EXPECT_EQ(tick.exchange_time_ns, 42);
+
+    // Closing trims the preallocated segment to the records written
+    auto segments = BinaryEventLog::list_segments(config_.directory);
+    ASSERT_EQ(segments.size(), 1u);
+    EXPECT_EQ(std::filesystem::file_size(segments[0]),
+              sizeof(EventLogFileHeader) + records[0].first.size + records[1].first.size + records[2].first.size);
+}
+
+TEST_F(BinaryEventLogTest, FormatsTextAndCsv) {
+    OrderEventFields fields{};
+    std::strcpy(fields.order_id, "ORD,\"7\"");
+    std::strcpy(fields.symbol, "AAPL");
+    fields.side = 1;
+    fields.quantity = 100.0;
+    fields.price = 150.5;
+
+    EventRecordHeader header{};
+    header.schema_id = static_cast<std::uint16_t>(EventSchema::ORDER);
+    header.size = sizeof(header) + sizeof(fields);
+    header.timestamp_ns = 1700000000123456789LL;
+    const auto* payload = reinterpret_cast<const std::uint8_t*>(&fields);
+
+    EXPECT_EQ(BinaryEventLog::format_text(header, payload),
+              "2023-11-14 22:13:20.123456789 order order_id=ORD,\"7\" symbol=AAPL side=1 type=0 status=0 "
+              "quantity=100 price=150.5 filled_quantity=0");
+
+    const auto* schema = BinaryEventLog::find_schema("order");
+    ASSERT_NE(schema, nullptr);
+    EXPECT_EQ(BinaryEventLog::format_csv_header(*schema),
+              "timestamp_ns,order_id,symbol,side,type,status,quantity,price,filled_quantity");
+    EXPECT_EQ(BinaryEventLog::format_csv_row(header, payload),
+              "1700000000123456789,\"ORD,\"\"7\"\"\",AAPL,1,0,0,100,150.5,0");
+    EXPECT_EQ(BinaryEventLog::find_schema("unknown"), nullptr);
+}
+
+TEST_F(BinaryEventLogTest, RollsOverToNewSegmentsWhenFull) {
+    BinaryEventLog log(config_);
+    ASSERT_TRUE(log.open());
+    const int count = 2000;
+    for (int i = 0; i < count; ++i) {
+        ASSERT_TRUE(log.log_order("ORD_" + std::to_string(i), "AAPL", 0, 1, 0, 100.0, 150.0, 0.0));
+    }
+    auto stats = log.get_statistics();
+    log.close();
+
+    EXPECT_EQ(stats.records_written, static_cast<uint64_t>(count));
+    EXPECT_GT(stats.segments_created, 1u);
+    EXPECT_EQ(BinaryEventLog::list_segments(config_.directory).size(), stats.segments_created);
+
+    // Segments read back in order with nothing lost at the boundaries
+    auto records = read_all();
+    ASSERT_EQ(records.size(), static_cast<size_t>(count));
+    OrderEventFields last;
+    std::memcpy(&last, records.back().second.data(), sizeof(last));
+    EXPECT_STREQ(last.order_id, ("ORD_" + std::to_string(count - 1)).c_str());
+}
+
+TEST_F(BinaryEventLogTest, DropsRecordsWhenClosed) {
+    BinaryEventLog log(config_);
+    EXPECT_FALSE(log.log_trade("TRD_1", "ORD_1", "AAPL", 0, 0, 1.0, 1.0));
+    EXPECT_EQ(log.get_statistics().records_dropped, 1u);
+}
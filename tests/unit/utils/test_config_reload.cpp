@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "utils/config.hpp"
+#include "utils/config_watcher.hpp"
+
+using namespace trading;
+using namespace std::chrono_literals;
+
+// The section macros hand back copies; a reference into a temporary snapshot would dangle
+static_assert(std::is_same_v<decltype((TRADING_CONFIG())), TradingSystemConfig>);
+static_assert(std::is_same_v<decltype((MARKET_DATA_CONFIG())), MarketDataConfig>);
+static_assert(std::is_same_v<decltype((RISK_CONFIG())), RiskManagementConfig>);
+static_assert(std::is_same_v<decltype((UI_CONFIG())), UIConfig>);
+static_assert(std::is_same_v<decltype((PERSISTENCE_CONFIG())), PersistenceConfig>);
+static_assert(std::is_same_v<decltype((LOGGING_CONFIG())), LoggingConfig>);
+
+class ConfigReloadTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory_ = std::filesystem::temp_directory_path() /
+                     ("config_reload_test_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        std::filesystem::create_directories(directory_);
+        path_ = (directory_ / "trading_system.json").string();
+        write_config(TradingSystemConfig{});
+        manager_ = std::make_shared<ConfigurationManager>(path_);
+        ASSERT_TRUE(manager_->load_configuration());
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(directory_, ec);
+    }
+
+    void write_config(const TradingSystemConfig& config) const {
+        nlohmann::json j;
+        config.to_json(j);
+        std::ofstream(path_) << j.dump(4);
+    }
+
+    std::filesystem::path directory_;
+    std::string path_;
+    std::shared_ptr<ConfigurationManager> manager_;
+};
+
+TEST_F(ConfigReloadTest, SnapshotsAreImmutableAndShared) {
+    auto before = manager_->get_snapshot();
+    EXPECT_EQ(before, manager_->get_snapshot());
+
+    RiskManagementConfig risk = before->risk_management;
+    risk.max_order_size = 250.0;
+    ASSERT_TRUE(manager_->update_risk_management_config(risk));
+
+    // Readers holding the old snapshot keep seeing it
+    EXPECT_DOUBLE_EQ(before->risk_management.max_order_size, RiskManagementConfig{}.max_order_size);
+    EXPECT_DOUBLE_EQ(manager_->get_snapshot()->risk_management.max_order_size, 250.0);
+    EXPECT_NE(before, manager_->get_snapshot());
+}
+
+TEST_F(ConfigReloadTest, ReloadNotifiesOnlyChangedSections) {
+    std::vector<ConfigSection> notified;
+    double new_limit = 0.0;
+    for (auto section : {ConfigSection::MARKET_DATA, ConfigSection::RISK_MANAGEMENT, ConfigSection::UI}) {
+        manager_->subscribe(section, [&, section](const TradingSystemConfig&, const TradingSystemConfig& current) {
+            notified.push_back(section);
+            new_limit = current.risk_management.max_position_size;
+        });
+    }
+
+    TradingSystemConfig edited;
+    edited.risk_management.max_position_size = 1234.0;
+    write_config(edited);
+    ASSERT_TRUE(manager_->reload_configuration());
+    ASSERT_EQ(notified.size(), 1u);
+    EXPECT_EQ(notified[0], ConfigSection::RISK_MANAGEMENT);
+    EXPECT_DOUBLE_EQ(new_limit, 1234.0);
+
+    // Unchanged file: nothing to publish
+    ASSERT_TRUE(manager_->reload_configuration());
+    EXPECT_EQ(notified.size(), 1u);
+}
+
+TEST_F(ConfigReloadTest, InvalidReloadKeepsCurrentConfig) {
+    int notifications = 0;
+    size_t id = manager_->subscribe(ConfigSection::UI,
+                                    [&](const TradingSystemConfig&, const TradingSystemConfig&) { ++notifications; });
+
+    TradingSystemConfig invalid;
+    invalid.ui.precision = -5;
+    write_config(invalid);
+    EXPECT_FALSE(manager_->reload_configuration());
+    EXPECT_EQ(manager_->get_snapshot()->ui.precision, UIConfig{}.precision);
+
+    std::ofstream(path_) << "{ not json";
+    EXPECT_FALSE(manager_->reload_configuration());
+    EXPECT_EQ(notifications, 0);
+
+    manager_->unsubscribe(id);
+    TradingSystemConfig valid;
+    valid.ui.precision = 4;
+    write_config(valid);
+    EXPECT_TRUE(manager_->reload_configuration());
+    EXPECT_EQ(manager_->get_snapshot()->ui.precision, 4);
+    EXPECT_EQ(notifications, 0);
+}
+
+TEST_F(ConfigReloadTest, WatcherAppliesFileEdits) {
+    ConfigWatcher::Config watcher_config;
+    watcher_config.settle_delay = 20ms;
+    watcher_config.poll_interval = 50ms;
+    ConfigWatcher watcher(manager_, watcher_config);
+    ASSERT_TRUE(watcher.start());
+
+    TradingSystemConfig edited;
+    edited.market_data.symbols = {"AAPL", "NVDA"};
+    write_config(edited);
+
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (manager_->get_snapshot()->market_data.symbols != edited.market_data.symbols &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(10ms);
+    }
+    EXPECT_EQ(manager_->get_snapshot()->market_data.symbols, edited.market_data.symbols);
+
+    watcher.stop();
+    EXPECT_FALSE(watcher.is_running());
+    EXPECT_GE(watcher.get_statistics().reloads_applied, 1u);
+}
+
+TEST_F(ConfigReloadTest, ServiceModeSettingsRoundTrip) {
+    TradingSystemConfig service;
+    service.headless = true;
+    service.stats_interval_seconds = 15;
+    write_config(service);
+    ASSERT_TRUE(manager_->reload_configuration());
+    EXPECT_TRUE(manager_->get_snapshot()->headless);
+    EXPECT_EQ(manager_->get_snapshot()->stats_interval_seconds, 15);
+
+    service.stats_interval_seconds = -1;
+    write_config(service);
+    EXPECT_FALSE(manager_->reload_configuration());
+    EXPECT_EQ(manager_->get_snapshot()->stats_interval_seconds, 15);
+}